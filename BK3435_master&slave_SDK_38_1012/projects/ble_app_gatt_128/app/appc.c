@@ -133,8 +133,9 @@ void appc_le_data_length_update_req(uint8_t conidx,uint16_t max_tx_octets,uint16
 
 /*********************************************************
 FN: 
+RT: GAP_ERR_NO_ERROR - the request is sent, the result comes in gapc_cmp_evt
 */
-void appc_update_param(uint8_t conidx,uint16_t intv_min,uint16_t intv_max,uint16_t latency,uint16_t time_out)
+uint8_t appc_update_param(uint8_t conidx,uint16_t intv_min,uint16_t intv_max,uint16_t latency,uint16_t time_out)
 {
     if((ke_state_get(KE_BUILD_ID(TASK_APPC,conidx)) == APPC_LINK_CONNECTED) ||(ke_state_get(KE_BUILD_ID(TASK_APPC,conidx)) == APPC_SDP_DISCOVERING)\
             ||(ke_state_get(KE_BUILD_ID(TASK_APPC,conidx)) == APPC_SERVICE_CONNECTED) )
@@ -155,9 +156,11 @@ void appc_update_param(uint8_t conidx,uint16_t intv_min,uint16_t intv_max,uint16
 //        cmd->intv_min,cmd->intv_max,cmd->latency,cmd->time_out);
         // Send the message
         ke_msg_send(cmd);
+        return GAP_ERR_NO_ERROR;
     }
     else {
         SUBLE_PRINTF("%s can't pro. cur state :%d",ke_state_get(KE_BUILD_ID(TASK_APPC,conidx)));
+        return GAP_ERR_COMMAND_DISALLOWED;
     }
 }
 
@@ -58,7 +58,7 @@ extern struct appc_env_tag *appc_env[APPC_IDX_MAX];
 /*********************************************************************
  * EXTERNAL FUNCTION
  */
-void appc_update_param(uint8_t conidx,uint16_t intv_min,uint16_t intv_max,uint16_t latency,uint16_t time_out);
+uint8_t appc_update_param(uint8_t conidx,uint16_t intv_min,uint16_t intv_max,uint16_t latency,uint16_t time_out);
 uint8_t appc_get_peer_dev_info(uint8_t conidx,uint8_t type);
 
 void appc_init(void);
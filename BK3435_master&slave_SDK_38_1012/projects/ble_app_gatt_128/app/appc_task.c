@@ -83,6 +83,7 @@ static int gapc_cmp_evt_handler(ke_msg_id_t const msgid,
 			{
 				SUBLE_PRINTF("gapc update params ok !");
 			}
+			suble_gap_link_param_result(conidx, (param->status == GAP_ERR_NO_ERROR));
 			
     	} break;
 
@@ -217,11 +218,13 @@ static int gattc_cmp_evt_handler(ke_msg_id_t const msgid,  struct gattc_cmp_evt
     }
     
     if(param->operation == GATTC_REGISTER) {
-        appc_write_service_ntf_cfg_req(conidx,appc_env[conidx]->svc_notif_handle, 0x01);//if slave devce no response, Cause problems
+        suble_svc_c_ntf_cfg_enable(conidx);//if slave devce no response, Cause problems
     }
     
     if(param->operation == GATTC_WRITE) {
-        suble_svc_c_discovery_complete();
+        if(suble_svc_c_cache_check(conidx, param->status) == SUBLE_SUCCESS) {
+            suble_svc_c_discovery_complete();
+        }
     }
     
     if(param->operation == GATTC_UNREGISTER) {
@@ -315,10 +318,17 @@ static int appc_check_device_link_timer_handler(ke_msg_id_t const msgid, void co
         
         if(appc_env[conidx]->role == ROLE_MASTER) {
             appc_get_peer_dev_info(conidx, GAPC_GET_PEER_VERSION);
-//            sdp_discover_service(conidx,slave_device.serv_uuid, ATT_UUID_128_LEN);
-            sdp_discover_all_service(conidx);
-            ke_state_set(TASK_APPM, APPM_SDP_DISCOVERING);
-            ke_state_set(KE_BUILD_ID(TASK_APPC, conidx), APPC_SDP_DISCOVERING);
+            //known slave, add its service from the cached handles
+            if(suble_svc_c_cache_restore(conidx) == SUBLE_SUCCESS) {
+                ke_state_set(TASK_APPM, APPM_CONNECTED);
+                ke_state_set(KE_BUILD_ID(TASK_APPC, conidx), APPC_SERVICE_CONNECTED);
+                appm_scan_adv_con_schedule();
+            } else {
+//                sdp_discover_service(conidx,slave_device.serv_uuid, ATT_UUID_128_LEN);
+                sdp_discover_all_service(conidx);
+                ke_state_set(TASK_APPM, APPM_SDP_DISCOVERING);
+                ke_state_set(KE_BUILD_ID(TASK_APPC, conidx), APPC_SDP_DISCOVERING);
+            }
         }
     }
     
@@ -83,37 +83,11 @@ static uint8_t appm_get_handler(const struct ke_state_handler *handler_list,
 /*********************************************************
 FN:
 */
-SUBLE_TIMERX_HANDLER(0);
-SUBLE_TIMERX_HANDLER(1);
-SUBLE_TIMERX_HANDLER(2);
-SUBLE_TIMERX_HANDLER(3);
-SUBLE_TIMERX_HANDLER(4);
-SUBLE_TIMERX_HANDLER(5);
-SUBLE_TIMERX_HANDLER(6);
-SUBLE_TIMERX_HANDLER(7);
-SUBLE_TIMERX_HANDLER(8);
-SUBLE_TIMERX_HANDLER(9);
-SUBLE_TIMERX_HANDLER(10);
-SUBLE_TIMERX_HANDLER(11);
-SUBLE_TIMERX_HANDLER(12);
-SUBLE_TIMERX_HANDLER(13);
-SUBLE_TIMERX_HANDLER(14);
-SUBLE_TIMERX_HANDLER(15);
-SUBLE_TIMERX_HANDLER(16);
-SUBLE_TIMERX_HANDLER(17);
-SUBLE_TIMERX_HANDLER(18);
-SUBLE_TIMERX_HANDLER(19);
-SUBLE_TIMERX_HANDLER(100);
-SUBLE_TIMERX_HANDLER(101);
-SUBLE_TIMERX_HANDLER(102);
-SUBLE_TIMERX_HANDLER(103);
-SUBLE_TIMERX_HANDLER(104);
-SUBLE_TIMERX_HANDLER(105);
-SUBLE_TIMERX_HANDLER(106);
-SUBLE_TIMERX_HANDLER(107);
-SUBLE_TIMERX_HANDLER(108);
-SUBLE_TIMERX_HANDLER(109);
-SUBLE_TIMERX_HANDLER(200);
+static int suble_timer_wheel_handler(ke_msg_id_t const msgid, void *param, ke_task_id_t const dest_id, ke_task_id_t const src_id)
+{
+    suble_timer_handler();
+    return KE_MSG_CONSUMED;
+}
 
 /*********************************************************
 FN: 
@@ -425,6 +399,7 @@ static int gapc_param_updated_ind_handler (ke_msg_id_t const msgid,
         (uint16_t)(param->con_interval*1.25),   \
         (uint16_t)(param->con_latency),         \
         (uint16_t)(param->sup_to*10) );
+    suble_gap_link_param_updated(conidx, param->con_interval, param->con_latency);
     return KE_MSG_CONSUMED;
 }
 
@@ -759,37 +734,7 @@ const struct ke_msg_handler appm_default_state[] =
     {APPM_CON_TIMEOUT_TIMER,        (ke_msg_func_t)appm_con_dev_timerout_handler},
     {APPM_STOP_ADV_TIMER,           (ke_msg_func_t)appm_stop_adv_timerout_handler},
 
-    {SUBLE_TIMER0,                  (ke_msg_func_t)suble_timer0_handler},
-    {SUBLE_TIMER1,                  (ke_msg_func_t)suble_timer1_handler},
-    {SUBLE_TIMER2,                  (ke_msg_func_t)suble_timer2_handler},
-    {SUBLE_TIMER3,                  (ke_msg_func_t)suble_timer3_handler},
-    {SUBLE_TIMER4,                  (ke_msg_func_t)suble_timer4_handler},
-    {SUBLE_TIMER5,                  (ke_msg_func_t)suble_timer5_handler},
-    {SUBLE_TIMER6,                  (ke_msg_func_t)suble_timer6_handler},
-    {SUBLE_TIMER7,                  (ke_msg_func_t)suble_timer7_handler},
-    {SUBLE_TIMER8,                  (ke_msg_func_t)suble_timer8_handler},
-    {SUBLE_TIMER9,                  (ke_msg_func_t)suble_timer9_handler},
-    {SUBLE_TIMER10,                 (ke_msg_func_t)suble_timer10_handler},
-    {SUBLE_TIMER11,                 (ke_msg_func_t)suble_timer11_handler},
-    {SUBLE_TIMER12,                 (ke_msg_func_t)suble_timer12_handler},
-    {SUBLE_TIMER13,                 (ke_msg_func_t)suble_timer13_handler},
-    {SUBLE_TIMER14,                 (ke_msg_func_t)suble_timer14_handler},
-    {SUBLE_TIMER15,                 (ke_msg_func_t)suble_timer15_handler},
-    {SUBLE_TIMER16,                 (ke_msg_func_t)suble_timer16_handler},
-    {SUBLE_TIMER17,                 (ke_msg_func_t)suble_timer17_handler},
-    {SUBLE_TIMER18,                 (ke_msg_func_t)suble_timer18_handler},
-    {SUBLE_TIMER19,                 (ke_msg_func_t)suble_timer19_handler},
-    {SUBLE_TIMER100,                (ke_msg_func_t)suble_timer100_handler},
-    {SUBLE_TIMER101,                (ke_msg_func_t)suble_timer101_handler},
-    {SUBLE_TIMER102,                (ke_msg_func_t)suble_timer102_handler},
-    {SUBLE_TIMER103,                (ke_msg_func_t)suble_timer103_handler},
-    {SUBLE_TIMER104,                (ke_msg_func_t)suble_timer104_handler},
-    {SUBLE_TIMER105,                (ke_msg_func_t)suble_timer105_handler},
-    {SUBLE_TIMER106,                (ke_msg_func_t)suble_timer106_handler},
-    {SUBLE_TIMER107,                (ke_msg_func_t)suble_timer107_handler},
-    {SUBLE_TIMER108,                (ke_msg_func_t)suble_timer108_handler},
-    {SUBLE_TIMER109,                (ke_msg_func_t)suble_timer109_handler},
-    {SUBLE_TIMER200,                (ke_msg_func_t)suble_timer200_handler},
+    {SUBLE_TIMER_WHEEL,             (ke_msg_func_t)suble_timer_wheel_handler},
 };
 //ָϢб
 const struct ke_state_handler appm_default_handler = KE_STATE_HANDLER(appm_default_state);
@@ -70,45 +70,10 @@ enum appm_msg
 	APP_PERIOD_TIMER,
 	APP_SEND_SMPREQ_TIMER,
 
-    SUBLE_TIMER0,
-    SUBLE_TIMER1,
-    SUBLE_TIMER2,
-    SUBLE_TIMER3,
-    SUBLE_TIMER4,
-    SUBLE_TIMER5,
-    SUBLE_TIMER6,
-    SUBLE_TIMER7,
-    SUBLE_TIMER8,
-    SUBLE_TIMER9,
-    SUBLE_TIMER10,
-    SUBLE_TIMER11,
-    SUBLE_TIMER12,
-    SUBLE_TIMER13,
-    SUBLE_TIMER14,
-    SUBLE_TIMER15,
-    SUBLE_TIMER16,
-    SUBLE_TIMER17,
-    SUBLE_TIMER18,
-    SUBLE_TIMER19,
-    SUBLE_TIMER100,
-    SUBLE_TIMER101,
-    SUBLE_TIMER102,
-    SUBLE_TIMER103,
-    SUBLE_TIMER104,
-    SUBLE_TIMER105,
-    SUBLE_TIMER106,
-    SUBLE_TIMER107,
-    SUBLE_TIMER108,
-    SUBLE_TIMER109,
-    SUBLE_TIMER200,
-    SUBLE_TIMER_MAX,
+    //all suble timers share this one, see suble_timer.c
+    SUBLE_TIMER_WHEEL,
 };
 
-#define SUBLE_TIMERX_HANDLER(x) \
-                static int suble_timer##x##_handler(ke_msg_id_t const msgid, void *param, ke_task_id_t const dest_id, ke_task_id_t const src_id) { \
-                    suble_timer_handler(SUBLE_TIMER##x); \
-                    return KE_MSG_CONSUMED; \
-                }
 
 /*********************************************************************
  * STRUCT
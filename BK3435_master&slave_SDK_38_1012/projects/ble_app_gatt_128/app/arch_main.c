@@ -71,17 +71,17 @@ FN:
 */
 void assert_err(const char *condition, const char * file, int line)
 {
-	SUBLE_PRINTF("%s,condition %s,file %s,line = %d",__func__,condition,file,line);
+	TUYA_APP_LOG_ERROR("%s,condition %s,file %s,line = %d",__func__,condition,file,line);
 }
 
 void assert_param(int param0, int param1, const char * file, int line)
 {
-	SUBLE_PRINTF("%s,param0 = %d,param1 = %d,file = %s,line = %d",__func__,param0,param1,file,line);
+	TUYA_APP_LOG_ERROR("%s,param0 = %d,param1 = %d,file = %s,line = %d",__func__,param0,param1,file,line);
 }
 
 void assert_warn(int param0, int param1, const char * file, int line)
 {
-	SUBLE_PRINTF("%s,param0 = %d,param1 = %d,file = %s,line = %d",__func__,param0,param1,file,line);
+	TUYA_APP_LOG_WARNING("%s,param0 = %d,param1 = %d,file = %s,line = %d",__func__,param0,param1,file,line);
 }
 
 void dump_data(uint8_t* data, uint16_t length)
@@ -95,6 +95,8 @@ FN:
 void platform_reset(uint32_t error)
 {
 	SUBLE_PRINTF("error = %x", error);
+    // the log still buffered in RAM is lost by the reset
+    suble_log_flush();
 
     // Disable interrupts
     GLOBAL_INT_STOP();
@@ -159,7 +161,8 @@ void rw_app_enter(void)
     	GLOBAL_INT_DISABLE();
 
 #if SYSTEM_SLEEP
-        if(0)//(g_system_sleep)
+        // tickless, sleep until the next kernel timer or interrupt once the app queues are empty
+        if(suble_mainloop_is_idle())
         {
             // Check if the processor clock can be gated
             sleep_type = rwip_sleep();
@@ -50,6 +50,10 @@
 
 
 #define BLE_NB_PROFILES_ADD_MAX (BLE_NB_PROFILES - APPM_SVC_LIST_STOP)
+
+/// Max characteristics/descriptors kept in a cached service layout
+#define SDP_SVC_CACHE_CHARS_MAX (3)
+#define SDP_SVC_CACHE_DESCS_MAX (3)
 /*
  * ENUMERATIONS
  ****************************************************************************************
@@ -128,6 +132,23 @@ struct sdp_env_init_t
 };
 
 
+/// Discovered layout of the slave service, enough to add the profile again without discovery
+struct sdp_svc_cache
+{
+    /// service start/end handle
+    uint16_t shdl;
+    uint16_t ehdl;
+    /// handles picked by sdp_extract_svc_info
+    uint16_t write_hdl;
+    uint16_t notif_hdl;
+    
+    uint8_t chars_nb;
+    uint8_t descs_nb;
+    struct prf_char_inf chars[SDP_SVC_CACHE_CHARS_MAX];
+    struct prf_char_desc_inf descs[SDP_SVC_CACHE_DESCS_MAX];
+};
+
+
 /*
  * GLOBAL VARIABLE DECLARATIONS
  ****************************************************************************************
@@ -158,6 +179,8 @@ void sdp_discover_all_service(uint8_t conidx);
 void sdp_service_init(void);
 void sdp_add_profiles(uint8_t conidx,struct prf_sdp_db_env *env);
 uint8_t sdp_extract_svc_info(uint8_t conidx,struct gattc_sdp_svc_ind const *param);
+uint8_t sdp_export_svc_info(uint8_t conidx,struct sdp_svc_cache *cache);
+uint8_t sdp_restore_svc_info(uint8_t conidx,struct sdp_svc_cache const *cache);
 
 void sdp_enable_rsp_send(struct sdp_env_tag *basc_env, uint8_t conidx, uint8_t status);
 
@@ -620,6 +620,167 @@ uint8_t sdp_extract_svc_info(uint8_t conidx,struct gattc_sdp_svc_ind const *ind)
     return 0;
 }
 
+/**
+ ****************************************************************************************
+ * @brief Copy the service layout found by sdp_extract_svc_info on conidx into cache.
+ * @return GAP_ERR_NO_ERROR, or GAP_ERR_NOT_FOUND if there is nothing to cache.
+ ****************************************************************************************
+ */
+uint8_t sdp_export_svc_info(uint8_t conidx,struct sdp_svc_cache *cache)
+{
+    for(uint8_t idx = 0; idx < BLE_NB_PROFILES_ADD_MAX; idx++)
+    {
+        struct sdp_env_tag *sdp_env = &sdp_env_init.sdp_env[idx];
+        struct sdp_content *sdp_cont;
+        
+        if((sdp_env_init.used_status[idx] != USED_STATUS) || (sdp_env->conidx != conidx))
+        {
+            continue;
+        }
+        if((sdp_env->prf_db_env == NULL) || (sdp_env->prf_db_env->sdp_cont == NULL))
+        {
+            return GAP_ERR_NOT_FOUND;
+        }
+        sdp_cont = sdp_env->prf_db_env->sdp_cont;
+        if((sdp_cont->chars_descs_inf.chars_inf == NULL)
+            || ((sdp_cont->descs_nb != 0) && (sdp_cont->chars_descs_inf.descs_inf == NULL)))
+        {
+            return GAP_ERR_NOT_FOUND;
+        }
+        if((sdp_cont->chars_nb > SDP_SVC_CACHE_CHARS_MAX) || (sdp_cont->descs_nb > SDP_SVC_CACHE_DESCS_MAX))
+        {
+            UART_PRINTF("%s: service too large to cache\r\n",__func__);
+            return GAP_ERR_INSUFF_RESOURCES;
+        }
+        
+        memset(cache,0,sizeof(struct sdp_svc_cache));
+        cache->shdl = sdp_cont->svc.shdl;
+        cache->ehdl = sdp_cont->svc.ehdl;
+        cache->write_hdl = appc_env[conidx]->svc_write_handle;
+        cache->notif_hdl = appc_env[conidx]->svc_notif_handle;
+        cache->chars_nb = sdp_cont->chars_nb;
+        cache->descs_nb = sdp_cont->descs_nb;
+        memcpy(cache->chars,sdp_cont->chars_descs_inf.chars_inf,sizeof(struct prf_char_inf) * sdp_cont->chars_nb);
+        memcpy(cache->descs,sdp_cont->chars_descs_inf.descs_inf,sizeof(struct prf_char_desc_inf) * sdp_cont->descs_nb);
+        return GAP_ERR_NO_ERROR;
+    }
+    return GAP_ERR_NOT_FOUND;
+}
+
+/**
+ ****************************************************************************************
+ * @brief Check that every handle of a cached layout lies in the cached service range.
+ * @return GAP_ERR_NO_ERROR if the layout can be used.
+ ****************************************************************************************
+ */
+static uint8_t sdp_svc_cache_check(struct sdp_svc_cache const *cache)
+{
+    if((cache->chars_nb == 0) || (cache->chars_nb > SDP_SVC_CACHE_CHARS_MAX) || (cache->descs_nb > SDP_SVC_CACHE_DESCS_MAX))
+    {
+        return GAP_ERR_INVALID_PARAM;
+    }
+    if((cache->shdl == ATT_INVALID_HDL) || (cache->shdl > cache->ehdl))
+    {
+        return GAP_ERR_INVALID_PARAM;
+    }
+    if((cache->write_hdl <= cache->shdl) || (cache->write_hdl > cache->ehdl)
+        || (cache->notif_hdl <= cache->shdl) || (cache->notif_hdl > cache->ehdl))
+    {
+        return GAP_ERR_INVALID_PARAM;
+    }
+    for(uint8_t idx = 0; idx < cache->chars_nb; idx++)
+    {
+        struct prf_char_inf const *chars = &cache->chars[idx];
+        
+        if((chars->char_hdl <= cache->shdl) || (chars->val_hdl <= chars->char_hdl)
+            || (chars->val_hdl > cache->ehdl))
+        {
+            return GAP_ERR_INVALID_PARAM;
+        }
+    }
+    for(uint8_t idx = 0; idx < cache->descs_nb; idx++)
+    {
+        uint16_t desc_hdl = cache->descs[idx].desc_hdl;
+        
+        if((desc_hdl <= cache->shdl) || (desc_hdl > cache->ehdl))
+        {
+            return GAP_ERR_INVALID_PARAM;
+        }
+    }
+    return GAP_ERR_NO_ERROR;
+}
+
+/**
+ ****************************************************************************************
+ * @brief Add the slave service profile from a cached layout, skipping GATT discovery.
+ * The rest of the sequence (GATTC_REGISTER, ntf cfg write) is the same as after
+ * sdp_extract_svc_info.
+ ****************************************************************************************
+ */
+uint8_t sdp_restore_svc_info(uint8_t conidx,struct sdp_svc_cache const *cache)
+{
+    struct prf_sdp_db_env *prf_db_env;
+    uint8_t free_env_idx;
+    uint16_t malloc_size;
+    
+    if(sdp_svc_cache_check(cache) != GAP_ERR_NO_ERROR)
+    {
+        UART_PRINTF("%s: invalid cached layout\r\n",__func__);
+        return GAP_ERR_INVALID_PARAM;
+    }
+    
+    malloc_size = ((sizeof(struct prf_char_inf) * cache->chars_nb) + (sizeof(struct prf_char_desc_inf) * cache->descs_nb));
+    if(check_enough_mem_add_service(malloc_size))
+    {
+        UART_PRINTF("not enough mem to store profile!!!!!\r\n");
+        return GAP_ERR_INSUFF_RESOURCES;
+    }
+    
+    free_env_idx = sdp_service_free_env_find();
+    if(free_env_idx >= BLE_NB_PROFILES_ADD_MAX)
+    {
+        UART_PRINTF("not enough env to store profile!!!!!\r\n");
+        return GAP_ERR_INSUFF_RESOURCES;
+    }
+    
+    struct prf_char_inf *chars = (struct prf_char_inf *) ke_malloc(sizeof(struct prf_char_inf) * cache->chars_nb,KE_MEM_NON_RETENTION);
+    struct prf_char_desc_inf *descs = (struct prf_char_desc_inf *)ke_malloc(sizeof(struct prf_char_desc_inf) * cache->descs_nb ,KE_MEM_ATT_DB);
+    if((chars == NULL) || ((descs == NULL) && (cache->descs_nb != 0)))
+    {
+        if(chars != NULL)
+        {
+            ke_free(chars);
+        }
+        if(descs != NULL)
+        {
+            ke_free(descs);
+        }
+        UART_PRINTF("%s: malloc failed\r\n",__func__);
+        return GAP_ERR_INSUFF_RESOURCES;
+    }
+    memcpy(chars,cache->chars,sizeof(struct prf_char_inf) * cache->chars_nb);
+    memcpy(descs,cache->descs,sizeof(struct prf_char_desc_inf) * cache->descs_nb);
+    
+    prf_db_env = sdp_env_init.sdp_env[free_env_idx].prf_db_env;
+    sdp_env_init.sdp_env[free_env_idx].conidx = conidx;
+    sdp_env_init.used_status[free_env_idx] = USED_STATUS;
+    prf_db_env->prf_idx = free_env_idx;
+    prf_db_env->sdp_cont->chars_descs_inf.chars_inf = chars;
+    prf_db_env->sdp_cont->chars_descs_inf.descs_inf = descs;
+    prf_db_env->sdp_cont->svc.shdl = cache->shdl;
+    prf_db_env->sdp_cont->svc.ehdl = cache->ehdl;
+    prf_db_env->sdp_cont->chars_nb = cache->chars_nb;
+    prf_db_env->sdp_cont->char_idx = 0;
+    prf_db_env->sdp_cont->descs_nb = cache->descs_nb;
+    
+    appc_env[conidx]->svc_write_handle = cache->write_hdl;
+    appc_env[conidx]->svc_notif_handle = cache->notif_hdl;
+    UART_PRINTF("%s: svc_write_handle: 0x%02x,svc_notif_handle: 0x%02x\r\n",__func__,cache->write_hdl,cache->notif_hdl);
+    
+    sdp_add_profiles(conidx,prf_db_env);
+    return GAP_ERR_NO_ERROR;
+}
+
 void sdp_add_profiles(uint8_t conidx,struct prf_sdp_db_env *db_env)
 {
     UART_PRINTF("%s \r\n",__func__);
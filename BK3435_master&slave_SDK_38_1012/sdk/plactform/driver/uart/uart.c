@@ -30,6 +30,7 @@
 #include "reg_uart.h"   // uart register
 #include "reg_uart2.h"   // uart2 register
 #include "rwip.h"       // SW interface
+#include "ll.h"         // interrupt lock
 #include "h4tl.h"
 #include "nvds.h"       // NVDS
 
@@ -371,6 +372,22 @@ char uart2_buff[UART0_RX_FIFO_MAX_COUNT];
 static UART_RX_CALLBACK_T uart_rx_cb = NULL; 
 static UART_RX_CALLBACK_T usrt2_rx_cb = NULL;
 
+///TX queue drained by the TX FIFO need-write interrupt
+typedef struct
+{
+	unsigned char *buf;
+	volatile unsigned long *fifo_stat;
+	volatile unsigned long *port;
+	volatile unsigned long *int_enable;
+	volatile uint16_t head;   // next byte to the FIFO, moved by the isr
+	volatile uint16_t tail;   // next free byte, moved by uart_send_async
+	UART_TX_CALLBACK_T cb;
+} uart_tx_queue_t;
+
+// the tx buffers are only used by the console protocols, which do not run with the queue
+static uart_tx_queue_t uart_tx_queue = {uart_tx_buf, &REG_APB3_UART_FIFO_STAT, &REG_APB3_UART_PORT, &REG_APB3_UART_INT_ENABLE, 0, 0, NULL};
+static uart_tx_queue_t uart2_tx_queue = {uart2_tx_buf, &REG_APB3_UART2_FIFO_STAT, &REG_APB3_UART2_PORT, &REG_APB3_UART2_INT_ENABLE, 0, 0, NULL};
+
 /*
  * LOCAL FUNCTION DEFINITIONS
  ****************************************************************************************
@@ -802,6 +819,108 @@ void uart_write(uint8_t *bufptr, uint32_t size, void (*callback) (void*, uint8_t
 	}
 }
 
+static uint16_t uart_tx_queue_free(uart_tx_queue_t *queue)
+{
+	return (UART0_TX_FIFO_MAX_COUNT - 1) - ((queue->tail + UART0_TX_FIFO_MAX_COUNT - queue->head) % UART0_TX_FIFO_MAX_COUNT);
+}
+
+/*******************************************************************************
+ * Function: uart_tx_queue_fill
+ * Description: move queued bytes into the TX FIFO until it is full
+ * Return: 1 when the queue is empty
+*******************************************************************************/
+static uint8_t uart_tx_queue_fill(uart_tx_queue_t *queue)
+{
+	uint16_t head = queue->head;
+
+	while((head != queue->tail) && !(*queue->fifo_stat & 0x00010000))
+	{
+		*queue->port = queue->buf[head];
+		head = (head + 1) % UART0_TX_FIFO_MAX_COUNT;
+	}
+	queue->head = head;
+
+	return (head == queue->tail);
+}
+
+/*******************************************************************************
+ * Function: uart_tx_queue_isr
+ * Description: refill the FIFO, stop the interrupt and report once drained
+*******************************************************************************/
+static void uart_tx_queue_isr(uart_tx_queue_t *queue)
+{
+	if(!(*queue->int_enable & SET_TX_FIFO_NEED_WRITE_EN))
+	{
+		return;
+	}
+	if(uart_tx_queue_fill(queue))
+	{
+		*queue->int_enable &= ~SET_TX_FIFO_NEED_WRITE_EN;
+		if(queue->cb)
+		{
+			queue->cb();
+		}
+	}
+}
+
+/*******************************************************************************
+ * Function: uart_tx_queue_put
+ * Description: queue the whole buffer or nothing, and start the interrupt
+ * Return: len when queued, 0 when there is not enough room
+*******************************************************************************/
+static uint16_t uart_tx_queue_put(uart_tx_queue_t *queue, unsigned char *buff, uint16_t len)
+{
+	uint16_t tail;
+	uint16_t first;
+	uint16_t ret = 0;
+
+	if(len == 0)
+	{
+		return 0;
+	}
+
+	// the sync log may queue from an isr, the copy is short
+	GLOBAL_INT_DISABLE();
+	if(uart_tx_queue_free(queue) >= len)
+	{
+		tail = queue->tail;
+		first = UART0_TX_FIFO_MAX_COUNT - tail;
+		if(first > len)
+		{
+			first = len;
+		}
+		memcpy(&queue->buf[tail], buff, first);
+		memcpy(&queue->buf[0], buff + first, len - first);
+		queue->tail = (tail + len) % UART0_TX_FIFO_MAX_COUNT;
+		*queue->int_enable |= SET_TX_FIFO_NEED_WRITE_EN;
+		ret = len;
+	}
+	GLOBAL_INT_RESTORE();
+
+	return ret;
+}
+
+/*******************************************************************************
+ * Function: uart_tx_queue_flush
+ * Description: drain the queue by polling, keeps the order for blocking sends
+ *              and also works with interrupts disabled
+*******************************************************************************/
+static void uart_tx_queue_flush(uart_tx_queue_t *queue)
+{
+	if(queue->head == queue->tail)
+	{
+		return;
+	}
+
+	// lock each refill only, the isr may run in between
+	while(queue->head != queue->tail)
+	{
+		GLOBAL_INT_DISABLE();
+		uart_tx_queue_fill(queue);
+		GLOBAL_INT_RESTORE();
+	}
+}
+
 static void uart_send_byte(unsigned char data)
 {
 	while (!uart_tx_fifo_empty_getf());
@@ -818,16 +937,48 @@ static void uart2_send_byte(unsigned char data)
 
 void uart_send(unsigned char *buff, int len)
 {
+    uart_tx_queue_flush(&uart_tx_queue);
     while (len--)
         uart_send_byte(*buff++);
 }
 
 void uart2_send(unsigned char *buff, int len)
 {
+	uart_tx_queue_flush(&uart2_tx_queue);
 	while (len--)
 		uart2_send_byte(*buff++);
 }
 
+uint16_t uart_send_async(unsigned char *buff, uint16_t len)
+{
+	return uart_tx_queue_put(&uart_tx_queue, buff, len);
+}
+
+uint16_t uart2_send_async(unsigned char *buff, uint16_t len)
+{
+	return uart_tx_queue_put(&uart2_tx_queue, buff, len);
+}
+
+uint16_t uart_tx_free_get(void)
+{
+	return uart_tx_queue_free(&uart_tx_queue);
+}
+
+uint16_t uart2_tx_free_get(void)
+{
+	return uart_tx_queue_free(&uart2_tx_queue);
+}
+
+void uart_tx_cb_register(UART_TX_CALLBACK_T cb)
+{
+	uart_tx_queue.cb = cb;
+}
+
+void uart2_tx_cb_register(UART_TX_CALLBACK_T cb)
+{
+	uart2_tx_queue.cb = cb;
+}
+
 void uart_cb_register(UART_RX_CALLBACK_T cb)
 {
 	if(cb)
@@ -875,6 +1026,10 @@ void uart_isr(void)
 	uint32_t IntStat;
 	 
 	IntStat = uart_isr_stat_get();	
+	if(IntStat & bit_UART_TXFIFO_NEED_WRITE)
+	{
+		uart_tx_queue_isr(&uart_tx_queue);
+	}
 	if(uart_rx_fifo_need_rd_isr_getf() || uart_rx_end_isr_getf()|| uart_rxd_wakeup_isr_getf())
 	{
 		while((REG_APB3_UART_FIFO_STAT & (0x01 << 21)))
@@ -952,13 +1107,15 @@ void uart_isr(void)
 	}
 	else
 	{
+        //hand every drained span to the stream parser, a frame may take several
+        if(uart_rx_cb && uart_rx_index)
+        {
+            (*uart_rx_cb)(uart_rx_buf, uart_rx_index);
+            uart_rx_index = 0;
+        }
         if(uart_rx_end_isr_getf())
         {
             uart_rx_done = 1;
-            if(uart_rx_cb)
-            {
-                (*uart_rx_cb)(uart_rx_buf, uart_rx_index);
-            }
             uart_rx_index = 0;
         }
 	}
@@ -972,6 +1129,10 @@ void uart2_isr(void)
 	uint32_t IntStat;
 
 	IntStat = uart2_isr_stat_get();
+	if(IntStat & bit_UART_TXFIFO_NEED_WRITE)
+	{
+		uart_tx_queue_isr(&uart2_tx_queue);
+	}
 	if(uart2_rx_fifo_need_rd_isr_getf() || uart2_rx_end_isr_getf()|| uart2_rxd_wakeup_isr_getf())
 	{
 		while((REG_APB3_UART2_FIFO_STAT & (0x01 << 21)))
@@ -985,27 +1146,34 @@ void uart2_isr(void)
 	}
     
 	{
+        if(usrt2_rx_cb && uart2_rx_index)
+        {
+            (*usrt2_rx_cb)(uart2_rx_buf, uart2_rx_index);
+            uart2_rx_index = 0;
+        }
         if(uart2_rx_end_isr_getf())
         {
             uart2_rx_done = 1;
-            if(usrt2_rx_cb)
-            {
-                (*usrt2_rx_cb)(uart2_rx_buf, uart2_rx_index);
-            }
             uart2_rx_index = 0;
         }
 	}
 	uart2_isr_stat_set(IntStat);
 }
 
+// deep sleep stops the uart clocks, so both tx queues and fifos must have drained
 uint8_t check_uart_stop(void)
 {
-	return uart_tx_fifo_empty_getf();
+	if((uart_tx_queue.head != uart_tx_queue.tail) || (uart2_tx_queue.head != uart2_tx_queue.tail))
+	{
+		return 0;
+	}
+	return (uart_tx_fifo_empty_getf() && uart2_tx_fifo_empty_getf());
 }
 
 
 int fputc(int ch,FILE *f)
 {
+	uart_tx_queue_flush(&uart_tx_queue);
 	uart_send_byte(ch);
 	
 	return ch;
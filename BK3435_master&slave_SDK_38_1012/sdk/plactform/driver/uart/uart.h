@@ -183,6 +183,17 @@ void uart2_cb_register(UART_RX_CALLBACK_T cb);
 void uart_cb_clear(void);
 void uart2_cb_clear(void);
 
+typedef void (*UART_TX_CALLBACK_T)(void);
+
+/// queue a buffer for the TX interrupt, all or nothing, returns len or 0 when full
+uint16_t uart_send_async(unsigned char *buff, uint16_t len);
+uint16_t uart2_send_async(unsigned char *buff, uint16_t len);
+uint16_t uart_tx_free_get(void);
+uint16_t uart2_tx_free_get(void);
+/// called from the isr when the TX queue is drained
+void uart_tx_cb_register(UART_TX_CALLBACK_T cb);
+void uart2_tx_cb_register(UART_TX_CALLBACK_T cb);
+
 void Device_uart_rx(void);
 
 void send_bt_rx_data(void);
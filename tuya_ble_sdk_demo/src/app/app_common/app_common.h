@@ -32,6 +32,7 @@ extern "C"
 #include "math.h"
 //app common
 #include "app_port.h"
+#include "app_dp_batch.h"
 #include "app_flash.h"
 #include "app_ota.h"
 #include "app_active_report.h"
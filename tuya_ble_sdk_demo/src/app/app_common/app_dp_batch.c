@@ -0,0 +1,134 @@
+#include "app_dp_batch.h"
+
+
+
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+//dp_id, dp_type, dp_data_len
+#define APP_DP_BATCH_HEAD_LEN           3
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+static uint8_t  s_dp_batch_buf[APP_DP_BATCH_MAX_LEN];
+static uint32_t s_dp_batch_len = 0;
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static void app_dp_batch_timeout_handler(void* timer);
+
+/*********************************************************************
+ * VARIABLES
+ */
+static suble_timer_t s_dp_batch_timer = SUBLE_TIMER_DEF(app_dp_batch_timeout_handler);
+
+
+
+
+/*********************************************************
+FN: send the batched state dps as one frame
+*/
+uint32_t app_dp_batch_flush(void)
+{
+    uint32_t ret = APP_PORT_SUCCESS;
+    
+    suble_timer_stop_0(&s_dp_batch_timer);
+    if(s_dp_batch_len == 0) {
+        return APP_PORT_SUCCESS;
+    }
+    
+    if(app_port_get_connect_status() == BONDING_CONN)
+    {
+        TUYA_APP_LOG_HEXDUMP_INFO("dp_rsp_batch", s_dp_batch_buf, s_dp_batch_len);
+        ret = app_port_dp_report_send(s_dp_batch_buf, s_dp_batch_len);
+    } else {
+        ret = APP_PORT_ERROR_COMMON;
+    }
+    s_dp_batch_len = 0;
+    return ret;
+}
+
+static void app_dp_batch_timeout_handler(void* timer)
+{
+    app_dp_batch_flush();
+}
+
+/*********************************************************
+FN: remove the dp with dp_id from the batch
+*/
+static void app_dp_batch_remove(uint8_t dp_id)
+{
+    uint32_t offset = 0;
+    
+    while(offset + APP_DP_BATCH_HEAD_LEN <= s_dp_batch_len)
+    {
+        uint32_t dp_len = APP_DP_BATCH_HEAD_LEN + s_dp_batch_buf[offset+2];
+        if(s_dp_batch_buf[offset] == dp_id) {
+            memmove(&s_dp_batch_buf[offset], &s_dp_batch_buf[offset+dp_len], s_dp_batch_len - offset - dp_len);
+            s_dp_batch_len -= dp_len;
+            return;
+        }
+        offset += dp_len;
+    }
+}
+
+/*********************************************************
+FN: check that buf is one or more complete dps
+*/
+static uint32_t app_dp_batch_check(uint8_t *buf, uint32_t size)
+{
+    uint32_t offset = 0;
+    
+    if((buf == NULL) || (size == 0)) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    while(offset < size)
+    {
+        if(offset + APP_DP_BATCH_HEAD_LEN > size) {
+            return APP_PORT_ERROR_COMMON;
+        }
+        offset += APP_DP_BATCH_HEAD_LEN + buf[offset+2];
+    }
+    return (offset == size) ? APP_PORT_SUCCESS : APP_PORT_ERROR_COMMON;
+}
+
+/*********************************************************
+FN: add state dps to the batch, the last value of a dp wins
+    they are held for APP_DP_BATCH_WINDOW_MS and sent with the other state
+    dps of that window in one frame, a full batch is sent right away
+PM: buf - one or more dps, dp_id, dp_type, dp_data_len, dp_data
+RT: APP_PORT_ERROR_COMMON - buf is cut, nothing is added
+*/
+uint32_t app_dp_batch_add(uint8_t *buf, uint32_t size)
+{
+    uint32_t offset = 0;
+    
+    if(app_dp_batch_check(buf, size) != APP_PORT_SUCCESS) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    while(offset < size)
+    {
+        uint32_t dp_len = APP_DP_BATCH_HEAD_LEN + buf[offset+2];
+        
+        app_dp_batch_remove(buf[offset]);
+        if(s_dp_batch_len + dp_len > APP_DP_BATCH_MAX_LEN) {
+            app_dp_batch_flush();
+        }
+        memcpy(&s_dp_batch_buf[s_dp_batch_len], &buf[offset], dp_len);
+        s_dp_batch_len += dp_len;
+        offset += dp_len;
+    }
+    
+    if(!suble_timer_is_running(&s_dp_batch_timer)) {
+        suble_timer_start_0(&s_dp_batch_timer, APP_DP_BATCH_WINDOW_MS, 1);
+    }
+    return APP_PORT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+/**
+****************************************************************************
+* @file      app_dp_batch.h
+* @brief     app_dp_batch
+* @author    suding
+* @version   V1.0.0
+* @date      2019-09-11
+* @note
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2019 Tuya </center></h2>
+*/
+
+
+#ifndef __APP_DP_BATCH_H__
+#define __APP_DP_BATCH_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include "app_common.h"
+
+/*********************************************************************
+ * CONSTANTS
+ */
+//state dps reported within this window go out in one frame
+#define APP_DP_BATCH_WINDOW_MS          20
+#define APP_DP_BATCH_MAX_LEN            TUYA_BLE_REPORT_MAX_DP_DATA_LEN
+
+/*********************************************************************
+ * STRUCT
+ */
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL FUNCTION
+ */
+uint32_t app_dp_batch_add(uint8_t *buf, uint32_t size);
+uint32_t app_dp_batch_flush(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__APP_DP_BATCH_H__
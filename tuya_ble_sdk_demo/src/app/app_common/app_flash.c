@@ -23,6 +23,10 @@
 #define SETBIT(hardid)         (hardid_bitmap[hardid/8] |=  (1<<hardid%8))
 #define CLEARBIT(hardid)       (hardid_bitmap[hardid/8] &= ~(1<<hardid%8))
 
+//secondary index, hardid sorted by memberid/slaveid and then by hardid
+#define HARD_INDEX_MEMBER      0
+#define HARD_INDEX_SLAVE       1
+
 /*********************************************************************
  * LOCAL STRUCT
  */
@@ -38,9 +42,23 @@ static uint32_t s_evt_id = 0;
 static uint8_t hardid_array[HARDID_MAX_TOTAL];
 static uint8_t hardtype_array[HARDID_MAX_TOTAL];
 
+//secondary index, maintained together with hardid_bitmap
+static struct
+{
+    uint8_t  hard_type[HARDID_MAX_TOTAL];
+    uint8_t  member_id[HARDID_MAX_TOTAL];
+    uint16_t slaveid[HARDID_MAX_TOTAL];
+    uint8_t  order[2][HARDID_MAX_TOTAL]; //HARD_INDEX_MEMBER, HARD_INDEX_SLAVE
+    uint16_t num;
+} hard_index;
+
 /*********************************************************************
  * LOCAL FUNCTION
  */
+static void lock_hard_index_reset(void);
+static void lock_hard_index_add(lock_hard_t* hard);
+static void lock_hard_index_remove(uint8_t hardid);
+static uint32_t lock_hard_index_find(uint8_t index, uint32_t key);
 
 /*********************************************************************
  * VARIABLES
@@ -123,6 +141,36 @@ uint32_t lock_get_vaild_hardid_num(uint8_t hard_type)
     return num;
 }
 
+/*********************************************************
+FN: lookup the next valid hardid by hard_type
+PM: hard_type - open_meth_t
+    hardid - the lookup starts from this hardid (included)
+RT: HARD_ID_INVALID - no more valid hardid of this hard_type
+*/
+uint32_t lock_get_next_valid_hardid(uint8_t hard_type, uint32_t hardid)
+{
+    if(hard_type >= OPEN_METH_MAX) {
+        return HARD_ID_INVALID;
+    }
+    
+    if(hardid < hardid_start[hard_type]) {
+        hardid = hardid_start[hard_type];
+    }
+    while(hardid < hardid_start[hard_type+1]) {
+        //skip an empty byte of the bitmap at once
+        if(((hardid%8) == 0) && (hardid_bitmap[hardid/8] == 0)) {
+            hardid += 8;
+            continue;
+        }
+        //valid
+		if(SELECTBIT(hardid)) {
+            return hardid;
+        }
+        hardid++;
+    }
+    return HARD_ID_INVALID;
+}
+
 
 /*********************************************************
 FN: 
@@ -136,7 +184,11 @@ uint32_t lock_hard_save(lock_hard_t* hard)
     
 	uint32_t err_code = app_port_nv_set(SF_AREA_1, hardid, hard, sizeof(lock_hard_t));
 	if(err_code == APP_PORT_SUCCESS) {
+        if(SELECTBIT(hardid)) {
+            lock_hard_index_remove(hardid);
+        }
         SETBIT(hardid);
+        lock_hard_index_add(hard);
         return APP_PORT_SUCCESS;
 	}
     return APP_PORT_ERROR_COMMON;
@@ -219,21 +271,17 @@ FN:
 */
 uint32_t lock_hardid_load_by_memberid(uint8_t memberid, uint8_t* hardtype_array, uint8_t* hardid_array, uint8_t *hardid_num)
 {
-    lock_hard_t hard;
 	*hardid_num = 0;
     
-    for(uint32_t hardid=hardid_start[OPEN_METH_PASSWORD]; hardid<hardid_start[OPEN_METH_MAX]; hardid++) {
-        //valid
-		if(SELECTBIT(hardid)) {
-            //load hard member
-            if(lock_hard_load(hardid, &hard) == 0) {
-                if(hard.member_id == memberid) {
-                    hardid_array[*hardid_num] = hardid;
-                    hardtype_array[*hardid_num] = hard.hard_type;
-                    *hardid_num += 1;
-                }
-            }
+    //binary search the first one, the rest follow it, no flash access
+    for(uint32_t pos=lock_hard_index_find(HARD_INDEX_MEMBER, memberid<<8); pos<hard_index.num; pos++) {
+        uint8_t hardid = hard_index.order[HARD_INDEX_MEMBER][pos];
+        if(hard_index.member_id[hardid] != memberid) {
+            break;
         }
+        hardid_array[*hardid_num] = hardid;
+        hardtype_array[*hardid_num] = hard_index.hard_type[hardid];
+        *hardid_num += 1;
     }
 	return APP_PORT_SUCCESS;
 }
@@ -243,25 +291,88 @@ FN:
 */
 uint32_t lock_hardid_load_by_slaveid(uint16_t slaveid, uint8_t* hardtype_array, uint8_t* hardid_array, uint8_t *hardid_num)
 {
-    lock_hard_t hard;
 	*hardid_num = 0;
     
-    for(uint32_t hardid=hardid_start[OPEN_METH_PASSWORD]; hardid<hardid_start[OPEN_METH_MAX]; hardid++) {
-        //valid
-		if(SELECTBIT(hardid)) {
-            //load hard member
-            if(lock_hard_load(hardid, &hard) == 0) {
-                if(hard.slaveid == slaveid) {
-                    hardid_array[*hardid_num] = hardid;
-                    hardtype_array[*hardid_num] = hard.hard_type;
-                    *hardid_num += 1;
-                }
-            }
+    //binary search the first one, the rest follow it, no flash access
+    for(uint32_t pos=lock_hard_index_find(HARD_INDEX_SLAVE, (uint32_t)slaveid<<8); pos<hard_index.num; pos++) {
+        uint8_t hardid = hard_index.order[HARD_INDEX_SLAVE][pos];
+        if(hard_index.slaveid[hardid] != slaveid) {
+            break;
         }
+        hardid_array[*hardid_num] = hardid;
+        hardtype_array[*hardid_num] = hard_index.hard_type[hardid];
+        *hardid_num += 1;
     }
 	return APP_PORT_SUCCESS;
 }
 
+/*********************************************************
+FN: secondary index, memberid/slaveid -> hardid
+NT: both orders are sorted by (memberid or slaveid, hardid), a lookup costs a
+    binary search plus the hards that match, in the same order as a full hardid scan.
+    A save or delete moves the entries behind it, as the flash write does not happen often.
+*/
+static void lock_hard_index_reset(void)
+{
+    memset(&hard_index, 0, sizeof(hard_index));
+}
+
+static uint32_t lock_hard_index_key(uint8_t index, uint8_t hardid)
+{
+    uint32_t id = (index == HARD_INDEX_MEMBER) ? hard_index.member_id[hardid] : hard_index.slaveid[hardid];
+    return (id << 8) | hardid;
+}
+
+//position of the first entry whose key is not below key
+static uint32_t lock_hard_index_find(uint8_t index, uint32_t key)
+{
+    uint32_t low = 0;
+    uint32_t high = hard_index.num;
+    
+    while(low < high) {
+        uint32_t mid = (low + high) / 2;
+        if(lock_hard_index_key(index, hard_index.order[index][mid]) < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static void lock_hard_index_add(lock_hard_t* hard)
+{
+    uint8_t hardid = hard->hard_id;
+    
+    hard_index.hard_type[hardid] = hard->hard_type;
+    hard_index.member_id[hardid] = hard->member_id;
+    hard_index.slaveid[hardid] = hard->slaveid;
+    for(uint8_t index=HARD_INDEX_MEMBER; index<=HARD_INDEX_SLAVE; index++) {
+        uint8_t* order = hard_index.order[index];
+        uint32_t pos = lock_hard_index_find(index, lock_hard_index_key(index, hardid));
+        memmove(&order[pos+1], &order[pos], hard_index.num - pos);
+        order[pos] = hardid;
+    }
+    hard_index.num++;
+}
+
+static void lock_hard_index_remove(uint8_t hardid)
+{
+    uint32_t pos[2];
+    
+    for(uint8_t index=HARD_INDEX_MEMBER; index<=HARD_INDEX_SLAVE; index++) {
+        pos[index] = lock_hard_index_find(index, lock_hard_index_key(index, hardid));
+        if((pos[index] >= hard_index.num) || (hard_index.order[index][pos[index]] != hardid)) {
+            return; //not indexed
+        }
+    }
+    for(uint8_t index=HARD_INDEX_MEMBER; index<=HARD_INDEX_SLAVE; index++) {
+        uint8_t* order = hard_index.order[index];
+        memmove(&order[pos[index]], &order[pos[index]+1], hard_index.num - pos[index] - 1);
+    }
+    hard_index.num--;
+}
+
 /*********************************************************
 FN: delete lock hard in local flash
 */
@@ -273,6 +384,9 @@ uint32_t lock_hard_delete(uint8_t hardid)
     
 	uint32_t err_code = app_port_nv_del(SF_AREA_1, hardid);
 	if(err_code == APP_PORT_SUCCESS) {
+        if(SELECTBIT(hardid)) {
+            lock_hard_index_remove(hardid);
+        }
         CLEARBIT(hardid);
         return APP_PORT_SUCCESS;
 	}
@@ -647,18 +761,45 @@ uint32_t lock_flash_erease_all(void)
 #define SLAVE_MAX_NUM                   10
 static slave_info_t s_slave_info[SLAVE_MAX_NUM] = {0};
 
+/*********************************************************
+FN: the mac belongs to a slave paired by the master logic
+PM: mac - in air order, the master logic may keep it reversed
+*/
+uint32_t lock_slave_mac_is_bound(uint8_t* mac)
+{
+    for(uint32_t idx=0; idx<SLAVE_MAX_NUM; idx++) {
+        uint8_t* slave_mac = s_slave_info[idx].mac;
+        
+        if(slave_mac[0] == 0 && slave_mac[1] == 0 && slave_mac[2] == 0
+            && slave_mac[3] == 0 && slave_mac[4] == 0 && slave_mac[5] == 0) {
+            continue; //free slot
+        }
+        if(memcmp(slave_mac, mac, 6) == 0) {
+            return 1;
+        }
+        if((slave_mac[0] == mac[5]) && (slave_mac[1] == mac[4]) && (slave_mac[2] == mac[3])
+            && (slave_mac[3] == mac[2]) && (slave_mac[4] == mac[1]) && (slave_mac[5] == mac[0])) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 /*********************************************************
 FN: 
 */
 uint32_t lock_flash_init(void)
 {
-    //init hardid_bitmap
+    //init hardid_bitmap and secondary index
+    lock_hard_index_reset();
 	for(uint32_t hardid=0; hardid<HARDID_MAX_TOTAL; hardid++)
 	{
         lock_hard_t hard;
 		if(lock_hard_load(hardid, &hard) == APP_PORT_SUCCESS)
 		{
+            hard.hard_id = hardid;
             SETBIT(hardid);
+            lock_hard_index_add(&hard);
 		}
 		else
 		{
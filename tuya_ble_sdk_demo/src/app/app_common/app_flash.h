@@ -110,6 +110,7 @@ extern lock_settings_t lock_settings;
 uint32_t lock_get_hardid(uint8_t hard_type);
 uint32_t lock_hardid_is_valid(uint32_t hardid);
 uint32_t lock_get_vaild_hardid_num(uint8_t hard_type);
+uint32_t lock_get_next_valid_hardid(uint8_t hard_type, uint32_t hardid);
 uint32_t lock_hard_save(lock_hard_t* hard);
 uint32_t lock_hard_load(uint8_t hardid, lock_hard_t* hard);
 uint32_t lock_hard_load_by_password(uint8_t password_len, uint8_t* password, lock_hard_t* hard);
@@ -145,6 +146,7 @@ uint32_t lock_settings_delete_and_default(void);
 /*********************************************************  init  *********************************************************/
 uint32_t lock_flash_erease_all(void);
 uint32_t lock_flash_init(void);
+uint32_t lock_slave_mac_is_bound(uint8_t* mac);
 
 #ifdef __cplusplus
 }
@@ -108,7 +108,7 @@ static uint32_t app_ota_enter(void)
     memset(&s_file, 0x00, sizeof(app_ota_file_info_storage_t));
     memset(&s_old_file, 0x00, sizeof(app_ota_file_info_storage_t));
     
-    suble_gap_conn_param_update(g_conn_info[0].condix, 15, 30, 0, 5000);
+    suble_gap_link_op_begin(SUBLE_LINK_OP_OTA);
 //    app_port_ble_conn_evt_ext();
     
     suble_flash_erase(APP_OTA_START_ADDR, APP_OTA_FILE_MAX_LEN/0x1000);
@@ -121,6 +121,7 @@ FN:
 */
 static uint32_t app_ota_exit(void)
 {
+    suble_gap_link_op_end(SUBLE_LINK_OP_OTA);
     app_ota_timer_creat_and_start();
     s_ota_state = TUYA_BLE_OTA_REQ;
     return SUBLE_SUCCESS;
@@ -1,4 +1,5 @@
 #include "app_port.h"
+#include "app_dp_batch.h"
 
 
 
@@ -190,14 +191,47 @@ uint32_t app_port_delay_ms(uint32_t ms)
 /*********************************************************  ble  *********************************************************/
 
 /*********************************************************
-FN: 
+FN: every frame without timestamp goes out here
+*/
+uint32_t app_port_dp_report_send(uint8_t *buf, uint32_t size)
+{
+    return tuya_ble_dp_data_report(buf, size);
+}
+
+/*********************************************************
+FN: sequence number of the last dp report, the first one is 1
+NT: the response to a report carries its number, dp_response_data.seq
+*/
+uint32_t app_port_dp_report_seq(void)
+{
+    return tuya_ble_dp_data_report_seq_get();
+}
+
+/*********************************************************
+FN: report state dps, e.g. battery or lock state, see app_dp_batch_add()
+    any other report flushes them first
+PM: buf - one or more dps, dp_id, dp_type, dp_data_len, dp_data
+*/
+uint32_t app_port_dp_state_report(uint8_t *buf, uint32_t size)
+{
+    if(app_port_get_connect_status() != BONDING_CONN)
+    {
+        TUYA_APP_LOG_HEXDUMP_INFO("dp_rsp_unconn", buf, size);
+        return APP_PORT_ERROR_COMMON;
+    }
+    return app_dp_batch_add(buf, size);
+}
+
+/*********************************************************
+FN: one frame per report, the response of each frame is counted by some callers
 */
 uint32_t app_port_dp_data_report(uint8_t *buf, uint32_t size)
 {
+    app_dp_batch_flush();
     if(app_port_get_connect_status() == BONDING_CONN)
     {
         TUYA_APP_LOG_HEXDUMP_INFO("dp_rsp", buf, size);
-        return tuya_ble_dp_data_report(buf, size);
+        return app_port_dp_report_send(buf, size);
     } else {
         TUYA_APP_LOG_HEXDUMP_INFO("dp_rsp_unconn", buf, size);
         return APP_PORT_ERROR_COMMON;
@@ -209,6 +243,7 @@ FN:
 */
 uint32_t app_port_dp_data_with_time_report(uint32_t timestamp, uint8_t *buf, uint32_t size)
 {
+    app_dp_batch_flush();
     if(app_port_get_connect_status() == BONDING_CONN)
     {
         TUYA_APP_LOG_INFO("timestamp: %d", timestamp);
@@ -263,11 +298,41 @@ void app_port_get_bt_mac_addr(uint8_t* addr)
 }
 
 /*********************************************************
-FN: 
+FN: goes around the link policy of suble_gap.c, which then takes the result for
+    the central's own choice, app_port_link_xxx() is the way for the app
 */
 uint32_t app_port_conn_param_update(uint16_t cMin, uint16_t cMax, uint16_t latency, uint16_t timeout)
 {
-    suble_gap_conn_param_update(g_conn_info[0].condix, cMin, cMax, latency, timeout);
+    if(suble_gap_conn_param_update(g_conn_info[0].condix, cMin, cMax, latency, timeout) != SUBLE_SUCCESS) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: bulk transfer, the link asks for a short connection interval until it ends
+*/
+uint32_t app_port_link_op_begin(suble_link_op_t op)
+{
+    suble_gap_link_op_begin(op);
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: 
+*/
+uint32_t app_port_link_op_end(suble_link_op_t op)
+{
+    suble_gap_link_op_end(op);
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: nothing more to move for now, the link may go to its idle parameters
+*/
+uint32_t app_port_link_relax(void)
+{
+    suble_gap_link_relax();
     return APP_PORT_SUCCESS;
 }
 
@@ -342,7 +407,7 @@ FN:
 */
 uint32_t app_port_uart_send_data(const uint8_t* buf,uint16_t size)
 {
-    suble_uart1_send(buf, size);
+    tuya_ble_uart_common_send_data(buf, size);
     return APP_PORT_SUCCESS;
 }
 
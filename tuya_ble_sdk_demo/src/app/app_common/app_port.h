@@ -36,6 +36,7 @@ extern "C"
 #include "tuya_ble_master.h"
 #include "tuya_ble_main.h" //tuya_ble_current_para
 #include "tuya_ble_unix_time.h" //tuya_ble_time_struct_data_t
+#include "tuya_ble_app_uart_common_handler.h" //tuya_ble_uart_common_send_data
 #include "tuya_ble_app_demo.h" //tuya_ble_time_struct_data_t
 //suble
 #include "suble_common.h"
@@ -115,12 +116,18 @@ uint32_t app_port_delay_ms(uint32_t ms);
 
 /*********************************************************  ble  *********************************************************/
 uint32_t app_port_dp_data_report(uint8_t *buf, uint32_t size);
+uint32_t app_port_dp_state_report(uint8_t *buf, uint32_t size);
+uint32_t app_port_dp_report_send(uint8_t *buf, uint32_t size);
+uint32_t app_port_dp_report_seq(void);
 uint32_t app_port_dp_data_with_time_report(uint32_t timestamp, uint8_t *buf, uint32_t size);
 uint32_t app_port_ota_rsp(tuya_ble_ota_response_t *rsp);
 tuya_ble_connect_status_t app_port_get_connect_status(void);
 void app_port_set_bt_mac_addr(uint8_t* addr);
 void app_port_get_bt_mac_addr(uint8_t* addr);
 uint32_t app_port_conn_param_update(uint16_t cMin, uint16_t cMax, uint16_t latency, uint16_t timeout);
+uint32_t app_port_link_op_begin(suble_link_op_t op);
+uint32_t app_port_link_op_end(suble_link_op_t op);
+uint32_t app_port_link_relax(void);
 uint32_t app_port_ble_gap_disconnect(void);
 uint32_t app_port_ble_conn_evt_ext(void);
 
@@ -628,6 +628,7 @@ static uint32_t open_meth_sync_new_handler(uint8_t cmd_dp_data_len, void* cmd_dp
         
         memset((void*)&g_sync_new, 0x00, sizeof(open_meth_sync_new_t));
         g_sync_new.flag = 1;
+        app_port_link_op_begin(SUBLE_LINK_OP_OPEN_METH_SYNC);
         g_sync_new.hard_type_len = cmd_dp_data_len;
         for(uint8_t idx=0; idx<cmd_dp_data_len; idx++) {
             g_sync_new.hard[idx].type = hard_type[idx];
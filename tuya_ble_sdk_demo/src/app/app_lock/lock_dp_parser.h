@@ -295,6 +295,11 @@ typedef struct
     uint8_t stage;
     uint8_t pkgs;
 } open_meth_sync_new_last_result_t;
+//pages reported before the first response comes back
+#define SYNC_NEW_PAGE_IN_FLIGHT     2
+//a page not answered in time is reported again, up to SYNC_NEW_RETRY_MAX times in a row
+#define SYNC_NEW_RESPONSE_OUTTIME_MS    3000
+#define SYNC_NEW_RETRY_MAX          3
 typedef struct
 {
     uint8_t type;
@@ -307,6 +312,9 @@ typedef struct
     uint8_t hard_type_len;
     uint8_t idx;
     uint8_t pkg_count;
+    uint8_t in_flight; //pages reported and not yet responded
+    uint8_t retry;     //timeouts since the last response
+    uint32_t page_seq[SYNC_NEW_PAGE_IN_FLIGHT]; //dp report seq of those pages, oldest first
     open_meth_sync_new_hard_t hard[OPEN_METH_MAX];
 } open_meth_sync_new_t;
 
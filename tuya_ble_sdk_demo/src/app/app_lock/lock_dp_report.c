@@ -260,24 +260,42 @@ void lock_offline_evt_report(uint8_t status)
         }
         memcpy(&g_rsp, buf+5, OFFLINE_RECORD_LEN);
         app_port_dp_data_with_time_report(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
+        app_port_link_op_begin(SUBLE_LINK_OP_OFFLINE_EVT);
+    }
+    else
+    {
+        //all offline events are up
+        app_port_link_op_end(SUBLE_LINK_OP_OFFLINE_EVT);
     }
     last_evt_id = lock_last_evtid(evt_id);
 }
 
 /*********************************************************
-FN: 
+FN: sync open method new
+NT: only occupied hardid are visited (hardid_bitmap), each page is packed up to
+    SYNC_NEW_NODE_MAX nodes and up to SYNC_NEW_PAGE_IN_FLIGHT pages are reported
+    before the first dp report response comes back.
+    A page is answered by the response that carries its report seq. If no page
+    is answered within SYNC_NEW_RESPONSE_OUTTIME_MS, the sync is reported again
+    from the oldest page not answered, a page that could not be reported is
+    tried again as well.
 */
+//dp_data_len is uint8_t, 2 bytes are used by the page header
+#define SYNC_NEW_NODE_MAX           ((255 - 2) / sizeof(open_meth_sync_node_new_t))
+
 volatile open_meth_sync_new_t g_sync_new;
+//the cursor before each page in flight, in the order of page_seq
+static open_meth_sync_new_t s_sync_new_page_cursor[SYNC_NEW_PAGE_IN_FLIGHT];
 
-void lock_open_meth_sync_new_report(uint8_t status)
+static uint32_t lock_open_meth_sync_new_page_report(void)
 {
-    if(status != 0)
-    {
-        return;
-    }
-    
     volatile open_meth_sync_new_hard_t* hard_type = g_sync_new.hard;
-    uint8_t* pIdx = (void*)&g_sync_new.idx; //hard_type_idx
+    open_meth_sync_new_t cursor;
+    uint32_t node_num = 0;
+    uint32_t ret;
+    
+    //keep the cursor, restore it if the page can't be reported
+    memcpy(&cursor, (void*)&g_sync_new, sizeof(open_meth_sync_new_t));
     
     g_rsp.dp_id = WR_BSC_OPEN_METH_SYNC_NEW;
     g_rsp.dp_type = APP_PORT_DT_RAW;
@@ -285,11 +303,21 @@ void lock_open_meth_sync_new_report(uint8_t status)
     g_rsp.dp_data[1] = g_sync_new.pkg_count;
     g_rsp.dp_data_len = 2;
     
-    //ѯÿӲö
-    for(uint8_t idx=hard_type[*pIdx].idx; idx<hardid_max[hard_type[*pIdx].type]; idx++)
+    while((g_sync_new.idx < g_sync_new.hard_type_len) && (node_num < SYNC_NEW_NODE_MAX))
     {
+        volatile open_meth_sync_new_hard_t* p_hard = &hard_type[g_sync_new.idx];
+        uint32_t hardid = lock_get_next_valid_hardid(p_hard->type, hardid_start[p_hard->type] + p_hard->idx);
+        
+        //this hard type is finished
+        if(hardid == HARD_ID_INVALID) {
+            p_hard->idx = hardid_max[p_hard->type];
+            g_sync_new.idx++;
+            continue;
+        }
+        p_hard->idx = hardid - hardid_start[p_hard->type] + 1;
+        
         lock_hard_t hard;
-        if(lock_hard_load(hardid_start[hard_type[*pIdx].type]+idx, &hard) == APP_PORT_SUCCESS)
+        if(lock_hard_load(hardid, &hard) == APP_PORT_SUCCESS)
         {
             open_meth_sync_node_new_t node_rsp;
             node_rsp.hardid = hard.hard_id;
@@ -300,52 +328,120 @@ void lock_open_meth_sync_new_report(uint8_t status)
             memcpy(&g_rsp.dp_data[g_rsp.dp_data_len], &node_rsp, sizeof(open_meth_sync_node_new_t));
             g_rsp.dp_data_len += sizeof(open_meth_sync_node_new_t);
             
-            hard_type[*pIdx].count++;
+            p_hard->count++;
+            node_num++;
         }
-        
-        //ÿӲ͵Ӳ
-        hard_type[*pIdx].idx++;
-        //ĳӲͱߴﵽ
-        if((hard_type[*pIdx].idx == hardid_max[hard_type[*pIdx].type])
-            || ((hard_type[*pIdx].count > 0) && ((hard_type[*pIdx].count % 20) == 0)))
+    }
+    
+    if(node_num == 0)
+    {
+        //all hard types are finished
+        open_meth_sync_new_last_result_t* rsp = (void*)g_rsp.dp_data;
+        rsp->stage = 0x01;
+        rsp->pkgs = g_sync_new.pkg_count;
+        g_rsp.dp_data_len = sizeof(open_meth_sync_new_last_result_t);
+    }
+    
+    ret = app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    if(ret != APP_PORT_SUCCESS) {
+        memcpy((void*)&g_sync_new, &cursor, sizeof(open_meth_sync_new_t));
+        return ret;
+    }
+    
+    memcpy(&s_sync_new_page_cursor[g_sync_new.in_flight], &cursor, sizeof(open_meth_sync_new_t));
+    g_sync_new.page_seq[g_sync_new.in_flight] = app_port_dp_report_seq();
+    g_sync_new.in_flight++;
+    if(node_num > 0) {
+        g_sync_new.pkg_count++;
+    } else {
+        g_sync_new.flag = 0;
+        app_port_link_op_end(SUBLE_LINK_OP_OPEN_METH_SYNC);
+    }
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: the sync is over, or given up
+*/
+static void lock_open_meth_sync_new_end(void)
+{
+    g_sync_new.flag = 0;
+    g_sync_new.in_flight = 0;
+    app_port_link_op_end(SUBLE_LINK_OP_OPEN_METH_SYNC);
+    lock_timer_stop(LOCK_TIMER_SYNC_NEW);
+}
+
+void lock_open_meth_sync_new_report(uint8_t status)
+{
+    if(status != 0)
+    {
+        //the app refused a page
+        lock_open_meth_sync_new_end();
+        return;
+    }
+    
+    while((g_sync_new.flag == 1) && (g_sync_new.in_flight < SYNC_NEW_PAGE_IN_FLIGHT))
+    {
+        if(lock_open_meth_sync_new_page_report() != APP_PORT_SUCCESS) {
+            break;
+        }
+    }
+    
+    //wait for the pages in flight, or try again the page that could not be reported
+    if((g_sync_new.flag == 1) || (g_sync_new.in_flight > 0)) {
+        lock_timer_start(LOCK_TIMER_SYNC_NEW);
+    } else {
+        lock_timer_stop(LOCK_TIMER_SYNC_NEW);
+    }
+}
+
+/*********************************************************
+FN: a dp report response came, only the responses to the sync pages move the sync on
+PM: seq - the report it answers, 0 if unknown, see tuya_ble_dp_data_report_seq_get()
+*/
+void lock_open_meth_sync_new_response(uint8_t status, uint32_t seq)
+{
+    for(uint32_t idx=0; idx<g_sync_new.in_flight; idx++)
+    {
+        if((seq != 0) && (g_sync_new.page_seq[idx] == seq))
         {
-            bool is_break = false;
-            
-            if(hard_type[*pIdx].count > 0) {
-                g_sync_new.pkg_count++;
-                app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
-                is_break = true;
-            }
-            
-            //ĳӲͱ
-            if(hard_type[*pIdx].idx == hardid_max[hard_type[*pIdx].type]) {
-                //Ӳ͸
-                (*pIdx)++;
-                idx=hard_type[*pIdx].idx - 1;
-//                TUYA_APP_LOG_INFO("hard_type_idx: %d", *pIdx);
-                if((*pIdx) == g_sync_new.hard_type_len)
-                {
-                    g_rsp.dp_id = WR_BSC_OPEN_METH_SYNC_NEW;
-                    g_rsp.dp_type = APP_PORT_DT_RAW;
-                    g_rsp.dp_data_len = sizeof(open_meth_sync_new_last_result_t);
-                    
-                    open_meth_sync_new_last_result_t* rsp = (void*)g_rsp.dp_data;
-                    rsp->stage = 0x01;
-                    rsp->pkgs = g_sync_new.pkg_count;
-                    
-                    app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
-                    g_sync_new.flag = 0;
-                    is_break = true;
-                }
-            }
-            
-            if(is_break) {
-                break;
-            }
+            g_sync_new.in_flight--;
+            memmove((void*)&g_sync_new.page_seq[idx], (void*)&g_sync_new.page_seq[idx+1], (g_sync_new.in_flight - idx) * sizeof(uint32_t));
+            memmove(&s_sync_new_page_cursor[idx], &s_sync_new_page_cursor[idx+1], (g_sync_new.in_flight - idx) * sizeof(open_meth_sync_new_t));
+            g_sync_new.retry = 0;
+            lock_open_meth_sync_new_report(status);
+            return;
         }
     }
 }
 
+/*********************************************************
+FN: no page was answered in time, LOCK_TIMER_SYNC_NEW
+*/
+void lock_open_meth_sync_new_outtime_handler(void)
+{
+    if((g_sync_new.flag == 0) && (g_sync_new.in_flight == 0)) {
+        return;
+    }
+    
+    if(g_sync_new.retry >= SYNC_NEW_RETRY_MAX) {
+        TUYA_APP_LOG_INFO("open meth sync given up");
+        lock_open_meth_sync_new_end();
+        return;
+    }
+    
+    if(g_sync_new.in_flight > 0) {
+        //a page or its response is lost, report again from the oldest page not answered
+        uint8_t retry = g_sync_new.retry;
+        memcpy((void*)&g_sync_new, &s_sync_new_page_cursor[0], sizeof(open_meth_sync_new_t));
+        g_sync_new.retry = retry;
+        g_sync_new.in_flight = 0;
+        app_port_link_op_begin(SUBLE_LINK_OP_OPEN_METH_SYNC);
+    }
+    g_sync_new.retry++;
+    lock_open_meth_sync_new_report(0x00);
+}
+
 
 
 
@@ -358,32 +454,31 @@ PM: dp_id - defined in "lock_dp_parser.h"
 */
 uint32_t lock_state_sync_report(uint8_t dp_id, uint32_t data)
 {
-    g_rsp.dp_id = dp_id;
+    uint32_t size = 0;
+    mtp_ret ret = MTP_INVALID_PARAM;
     
     switch(dp_id)
     {
-        //dp_type = value
+        //dp_type = value, klv_data_put changes it to big-end
         case OR_STS_BATTERY_PERCENT: {
-            g_rsp.dp_type = APP_PORT_DT_VALUE;
-            g_rsp.dp_data_len = APP_PORT_DT_VALUE_LEN;
-            g_rsp.dp_data[0] = data>>24;
-            g_rsp.dp_data[1] = data>>16;
-            g_rsp.dp_data[2] = data>>8;
-            g_rsp.dp_data[3] = data;
+            ret = klv_data_put((void*)&g_rsp, sizeof(lock_dp_t), &size, dp_id, APP_PORT_DT_VALUE, &data, APP_PORT_DT_VALUE_LEN, 0);
         } break;
         
         //dp_type = enum, but data is value, compatible with OR_BATTERY_PERCENT
         case OR_STS_BATTERY_POSITION: {
-            g_rsp.dp_type = APP_PORT_DT_ENUM;
-            g_rsp.dp_data_len = APP_PORT_DT_ENUM_LEN;
-            g_rsp.dp_data[0] = (data > 66) ? 0x00 : ((data > 33) ? 0x01 : 0x02);
+            uint8_t position = (data > 66) ? 0x00 : ((data > 33) ? 0x01 : 0x02);
+            ret = klv_data_put((void*)&g_rsp, sizeof(lock_dp_t), &size, dp_id, APP_PORT_DT_ENUM, &position, APP_PORT_DT_ENUM_LEN, 0);
         } break;
         
         default: {
         } break;
     }
-  
-    return app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    
+    //not a state dp, nothing is reported
+    if(ret != MTP_OK) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    return app_port_dp_state_report((void*)&g_rsp, size);
 }
 
 
@@ -53,6 +53,8 @@ uint32_t lock_open_record_report_offline_pwd(uint8_t dp_id, uint8_t* pwd);
 uint32_t lock_alarm_record_report(uint8_t alarm_reason);
 void lock_offline_evt_report(uint8_t status);
 void lock_open_meth_sync_new_report(uint8_t status);
+void lock_open_meth_sync_new_response(uint8_t status, uint32_t seq);
+void lock_open_meth_sync_new_outtime_handler(void);
 
 /*********************************************************  state sync  *********************************************************/
 uint32_t lock_state_sync_report(uint8_t dp_id, uint32_t data);
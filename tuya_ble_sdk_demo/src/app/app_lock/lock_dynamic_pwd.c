@@ -16,6 +16,15 @@
  */
 //static uint32_t s_last_dynamic_pwd = 0;
 
+static const uint32_t s_pow10[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+//hmac pads of the login key, rebuilt when the key changes
+static HMAC_SHA1Context s_hmac_ctx;
+static uint8_t s_hmac_key[LOGIN_KEY_LEN];
+static bool s_hmac_ctx_valid = false;
+
 /*********************************************************************
  * LOCAL FUNCTION
  */
@@ -32,15 +41,19 @@ FN: timeseq = (timestamp / DYNAMIC_PWD_TIME_STEP)
 */
 static int get_timer_string(unsigned int timeseq, int str_len, char *time_str)
 {
-    if ( (timeseq == 0) || (str_len == 0) || (time_str == NULL) ) {
+    static const char hex[] = "0123456789ABCDEF";
+
+    //"%08X", a 32 bit timeseq never takes more than 8 digits
+    if ( (timeseq == 0) || (str_len <= DYNAMIC_PWD_TOKEN_SIZE) || (time_str == NULL) ) {
         TUYA_APP_LOG_ERROR("get_timer_string paras err");
         return -1;
     }
 
-    snprintf(time_str, str_len, "%X", timeseq);
-    if (strlen(time_str) < DYNAMIC_PWD_TOKEN_SIZE) {
-        snprintf(time_str, str_len, "%08X", timeseq);
+    for (int idx=DYNAMIC_PWD_TOKEN_SIZE-1; idx>=0; idx--) {
+        time_str[idx] = hex[timeseq & 0x0F];
+        timeseq >>= 4;
     }
+    time_str[DYNAMIC_PWD_TOKEN_SIZE] = '\0';
 
     TUYA_APP_LOG_INFO(" get pass timer is %s", time_str);
     return 0;
@@ -63,14 +76,29 @@ static uint32_t TruncateSHA1(uint8_t *digest)
 /*********************************************************
 FN: 
 */
-static uint32_t TOTP(uint8_t *key, unsigned int key_len, uint8_t *msg, unsigned int msg_len, unsigned int digits) 
+static uint32_t TOTP(const HMAC_SHA1Context *ctx, uint8_t *msg, unsigned int msg_len, unsigned int digits) 
 {
 	uint8_t digest[20];
 	uint32_t dt;
 
-	HMAC_SHA1(key, key_len, msg, msg_len, digest);
+	HMAC_SHA1_Compute(ctx, msg, msg_len, digest);
 	dt = TruncateSHA1(digest);
-	return dt % (int)pow(10.0, digits);
+	return dt % s_pow10[digits];
+}
+
+/*********************************************************
+FN: 
+*/
+static const HMAC_SHA1Context* dynamic_pwd_hmac_ctx_get(uint8_t *key, unsigned int key_len)
+{
+    if ((key_len != LOGIN_KEY_LEN) || (!s_hmac_ctx_valid) || (memcmp(s_hmac_key, key, LOGIN_KEY_LEN) != 0)) {
+        HMAC_SHA1_Init(&s_hmac_ctx, key, key_len);
+        s_hmac_ctx_valid = (key_len == LOGIN_KEY_LEN);
+        if (s_hmac_ctx_valid) {
+            memcpy(s_hmac_key, key, LOGIN_KEY_LEN);
+        }
+    }
+    return &s_hmac_ctx;
 }
 
 /*********************************************************
@@ -98,10 +126,13 @@ static int verify_dynamic_pwd_token(uint8_t *key, unsigned int key_len, uint8_t
 {
 	uint32_t timestamp, timeseq;
 	uint32_t input_pwd, cal_dynamicpwd;
+    const HMAC_SHA1Context *hmac_ctx;
 
 	if ((key == NULL) || (pwd == NULL) || (pwd_len < DYNAMIC_PWD_TOKEN_SIZE) || (ts == 0))
 		return DYNAMIC_PWD_ERR_PARAS;
 
+    hmac_ctx = dynamic_pwd_hmac_ctx_get(key, key_len);
+
 	/* Convert pwd number to integer, Is dynamic pwd is used */
 	input_pwd = pwd_number_convert_to_integer(pwd, pwd_len);
 //	if (input_pwd == s_last_dynamic_pwd) {
@@ -124,7 +155,7 @@ static int verify_dynamic_pwd_token(uint8_t *key, unsigned int key_len, uint8_t
         if (get_timer_string(timeseq, sizeof(timeseq_str), timeseq_str))
             return DYNAMIC_PWD_ERR_PARAS;
 
-    	cal_dynamicpwd = TOTP(key, key_len, (uint8_t *)&timeseq_str, strlen(timeseq_str), 8);
+    	cal_dynamicpwd = TOTP(hmac_ctx, (uint8_t *)&timeseq_str, DYNAMIC_PWD_TOKEN_SIZE, DYNAMIC_PWD_TOKEN_SIZE);
     	TUYA_APP_LOG_INFO("calc dynamic pwd->[%d]-[%08d]", verify_cnt, cal_dynamicpwd);
     	if (input_pwd == cal_dynamicpwd) {
 //    		s_last_dynamic_pwd = cal_dynamicpwd;
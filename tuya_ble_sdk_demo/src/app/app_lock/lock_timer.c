@@ -33,7 +33,8 @@ FN:
 */
 void conn_param_update_outtime_cb_handler(void)
 {
-    app_port_conn_param_update(SUBLE_CONN_INTERVAL_MIN, SUBLE_CONN_INTERVAL_MAX, SUBLE_SLAVE_LATENCY, SUBLE_CONN_SUP_TIMEOUT);
+    //through the link policy, a request of our own would be taken for the central's choice
+    app_port_link_relax();
 }
 static void conn_param_update_outtime_cb(void* timer)
 {
@@ -139,6 +140,18 @@ static void communication_monitor_outtime_cb(tuya_ble_timer_t timer)
     tuya_ble_app_evt_send(APP_EVT_TIMER_9);
 }
 
+/*********************************************************
+FN: 
+*/
+void sync_new_outtime_cb_handler(void)
+{
+    lock_open_meth_sync_new_outtime_handler();
+}
+static void sync_new_outtime_cb(void* timer)
+{
+    tuya_ble_app_evt_send(APP_EVT_TIMER_10);
+}
+
 /*********************************************************
 FN: 
 */
@@ -154,6 +167,7 @@ uint32_t lock_timer_creat(void)
     ret += app_port_timer_create(&lock_timer[LOCK_TIMER_ACTIVE_REPORT], 30000, SUBLE_TIMER_SINGLE_SHOT, app_active_report_outtime_cb);
     ret += app_port_timer_create(&lock_timer[LOCK_TIMER_RESET_WITH_DISCONN2], 1000, SUBLE_TIMER_SINGLE_SHOT, reset_with_disconn2_outtime_cb);
 	ret += app_port_timer_create(&lock_timer[LOCK_TIMER_COMMUNICATION_MONITOR], 120000, TUYA_BLE_TIMER_SINGLE_SHOT, communication_monitor_outtime_cb);
+    ret += app_port_timer_create(&lock_timer[LOCK_TIMER_SYNC_NEW], SYNC_NEW_RESPONSE_OUTTIME_MS, SUBLE_TIMER_SINGLE_SHOT, sync_new_outtime_cb);
     //tuya_ble_xtimer_connect_monitor
     return ret;
 }
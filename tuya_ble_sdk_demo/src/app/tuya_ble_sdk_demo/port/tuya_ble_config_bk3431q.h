@@ -97,6 +97,16 @@ extern "C"
 
 #define TUYA_BLE_GATT_SEND_DATA_QUEUE_SIZE   20
 
+/*
+ * if 1 ,sending resumes from the notify complete event of the stack
+ */
+#define TUYA_BLE_GATT_SEND_ON_TX_COMPLETE    1
+
+/*
+ * an unfinished frame is freed when the app stops sending sub packages for this time
+ */
+#define TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS   2000
+
 
 
 /*
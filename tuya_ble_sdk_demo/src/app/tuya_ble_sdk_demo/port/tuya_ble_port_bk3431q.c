@@ -1,4 +1,5 @@
 #include "tuya_ble_port_bk3431q.h"
+#include "tuya_ble_app_uart_common_handler.h"
 
 
 
@@ -56,7 +57,9 @@ tuya_ble_status_t tuya_ble_gatt_send_data(const uint8_t *p_data,uint16_t len)
         data_len = TUYA_BLE_DATA_MTU_MAX;
     }
     
-    suble_svc_notify((void*)p_data, len);
+    if(!suble_svc_notify((void*)p_data, data_len)) {
+        return TUYA_BLE_ERR_BUSY;
+    }
     return TUYA_BLE_SUCCESS;
 }
 
@@ -65,12 +68,19 @@ FN:
 */
 tuya_ble_status_t tuya_ble_common_uart_init(void)
 {    
+    suble_uart1_tx_cb_register(tuya_ble_uart_common_tx_complete);
     return TUYA_BLE_SUCCESS;
 }
 
+/*********************************************************
+FN: 
+RT: TUYA_BLE_ERR_BUSY - the uart tx queue has no room, retry once it is drained
+*/
 tuya_ble_status_t tuya_ble_common_uart_send_data(const uint8_t *p_data,uint16_t len)
 {
-    suble_uart1_send(p_data, len);
+    if(!suble_uart1_send(p_data, len)) {
+        return TUYA_BLE_ERR_BUSY;
+    }
     return TUYA_BLE_SUCCESS;
 }
 
@@ -121,18 +131,7 @@ FN:
 */
 tuya_ble_status_t tuya_ble_rand_generator(uint8_t* p_buf, uint8_t len)
 {
-    uint32_t cnt=len/4;
-    uint8_t  remain = len%4;
-    int32_t temp;
-    for(uint32_t i=0; i<cnt; i++)
-    {
-        temp = rand();
-        memcpy(p_buf,(uint8_t *)&temp,4);
-        p_buf += 4;
-    }
-    temp = rand();
-    memcpy(p_buf,(uint8_t *)&temp,remain);
-
+    suble_rand_bytes(p_buf, len);
     return TUYA_BLE_SUCCESS;
 }
 
@@ -315,42 +314,112 @@ bool tuya_ble_aes128_ecb_decrypt(uint8_t *key,uint8_t *input,uint16_t input_len,
     return true;
 }
 
+/*********************************************************
+FN: cbc key schedules, kept per session key
+    the session key is fixed for a whole connection, so the key expansion only
+    runs when a new key shows up, one slot per link (slave and master session)
+*/
+#define TUYA_BLE_AES_CBC_CACHE_NUM      2
+
+typedef struct {
+    uint8_t key[16];
+    bool    valid;
+    bool    enc_valid;
+    bool    dec_valid;
+    uint32_t used;
+    //rk points into the context itself, the contexts are never copied
+    mbedtls_aes_context enc_ctx;
+    mbedtls_aes_context dec_ctx;
+} tuya_ble_aes_cbc_cache_t;
+
+static tuya_ble_aes_cbc_cache_t s_aes_cbc_cache[TUYA_BLE_AES_CBC_CACHE_NUM];
+static uint32_t s_aes_cbc_cache_used = 0;
+
+static tuya_ble_aes_cbc_cache_t* tuya_ble_aes128_cbc_cache_get(uint8_t *key)
+{
+    tuya_ble_aes_cbc_cache_t* entry = &s_aes_cbc_cache[0];
+    
+    for(uint32_t idx=0; idx<TUYA_BLE_AES_CBC_CACHE_NUM; idx++) {
+        if(s_aes_cbc_cache[idx].valid && (memcmp(s_aes_cbc_cache[idx].key, key, 16) == 0)) {
+            entry = &s_aes_cbc_cache[idx];
+            entry->used = ++s_aes_cbc_cache_used;
+            return entry;
+        }
+        //replace a free slot, else the least recently used one
+        if(!entry->valid) {
+            continue;
+        }
+        if((!s_aes_cbc_cache[idx].valid) || (s_aes_cbc_cache[idx].used < entry->used)) {
+            entry = &s_aes_cbc_cache[idx];
+        }
+    }
+    
+    if(entry->valid) {
+        mbedtls_aes_free(&entry->enc_ctx);
+        mbedtls_aes_free(&entry->dec_ctx);
+    }
+    memcpy(entry->key, key, 16);
+    entry->valid = true;
+    entry->enc_valid = false;
+    entry->dec_valid = false;
+    entry->used = ++s_aes_cbc_cache_used;
+    return entry;
+}
+
+/*********************************************************
+FN: drop all cached key schedules, called on disconnect
+*/
+void tuya_ble_aes128_cbc_cache_clear(void)
+{
+    for(uint32_t idx=0; idx<TUYA_BLE_AES_CBC_CACHE_NUM; idx++) {
+        if(s_aes_cbc_cache[idx].valid) {
+            mbedtls_aes_free(&s_aes_cbc_cache[idx].enc_ctx);
+            mbedtls_aes_free(&s_aes_cbc_cache[idx].dec_ctx);
+        }
+        memset(&s_aes_cbc_cache[idx], 0, sizeof(tuya_ble_aes_cbc_cache_t));
+    }
+}
+
 bool tuya_ble_aes128_cbc_encrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_t input_len,uint8_t *output)
 {
-    mbedtls_aes_context aes_ctx;
+    tuya_ble_aes_cbc_cache_t* entry;
     //
     if(input_len%16)
     {
         return false;
     }
 
-    mbedtls_aes_init(&aes_ctx);
-
-    mbedtls_aes_setkey_enc(&aes_ctx, key, 128);
+    entry = tuya_ble_aes128_cbc_cache_get(key);
+    if(!entry->enc_valid)
+    {
+        mbedtls_aes_init(&entry->enc_ctx);
+        mbedtls_aes_setkey_enc(&entry->enc_ctx, key, 128);
+        entry->enc_valid = true;
+    }
     
-    mbedtls_aes_crypt_cbc(&aes_ctx,MBEDTLS_AES_ENCRYPT,input_len,iv,input,output);
-    //
-    mbedtls_aes_free(&aes_ctx);
+    mbedtls_aes_crypt_cbc(&entry->enc_ctx,MBEDTLS_AES_ENCRYPT,input_len,iv,input,output);
 
     return true;
 }
 
 bool tuya_ble_aes128_cbc_decrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_t input_len,uint8_t *output)
 {
-    mbedtls_aes_context aes_ctx;
+    tuya_ble_aes_cbc_cache_t* entry;
     //
     if(input_len%16)
     {
         return false;
     }
 
-    mbedtls_aes_init(&aes_ctx);
-
-    mbedtls_aes_setkey_dec(&aes_ctx, key, 128);
+    entry = tuya_ble_aes128_cbc_cache_get(key);
+    if(!entry->dec_valid)
+    {
+        mbedtls_aes_init(&entry->dec_ctx);
+        mbedtls_aes_setkey_dec(&entry->dec_ctx, key, 128);
+        entry->dec_valid = true;
+    }
     
-    mbedtls_aes_crypt_cbc(&aes_ctx,MBEDTLS_AES_DECRYPT,input_len,iv,input,output);
-    //
-    mbedtls_aes_free(&aes_ctx);
+    mbedtls_aes_crypt_cbc(&entry->dec_ctx,MBEDTLS_AES_DECRYPT,input_len,iv,input,output);
 
     return true;
 }
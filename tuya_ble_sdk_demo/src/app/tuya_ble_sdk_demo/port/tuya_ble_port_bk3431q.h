@@ -33,12 +33,20 @@ extern "C"
 #include "hmac.h"
 #include "tuya_ble_config.h"
 #include "tuya_ble_type.h"
+#include "elog.h"
 
 /*********************************************************************
  * CONSTANT
  */
-#if (TUYA_BLE_LOG_ENABLE||TUYA_APP_LOG_ENABLE)
+#if ((TUYA_BLE_LOG_ENABLE||TUYA_APP_LOG_ENABLE) && defined(ELOG_BIN_OUTPUT_ENABLE))
+    #define TUYA_BLE_PRINTF(...)            elog_bin_printf(ELOG_LVL_DEBUG, __VA_ARGS__)
+    #define TUYA_BLE_PRINTF_ERROR(...)      elog_bin_printf(ELOG_LVL_ERROR, __VA_ARGS__)
+    #define TUYA_BLE_PRINTF_WARNING(...)    elog_bin_printf(ELOG_LVL_WARN, __VA_ARGS__)
+    #define TUYA_BLE_HEXDUMP(...)           suble_log_hexdump_for_tuya_ble_sdk("", 8, __VA_ARGS__)
+#elif (TUYA_BLE_LOG_ENABLE||TUYA_APP_LOG_ENABLE)
     #define TUYA_BLE_PRINTF(...)            log_d(__VA_ARGS__)
+    #define TUYA_BLE_PRINTF_ERROR(...)      log_e(__VA_ARGS__)
+    #define TUYA_BLE_PRINTF_WARNING(...)    log_w(__VA_ARGS__)
     #define TUYA_BLE_HEXDUMP(...)           suble_log_hexdump_for_tuya_ble_sdk("", 8, __VA_ARGS__)
 #else
     #define TUYA_BLE_PRINTF(...)
@@ -57,6 +65,7 @@ extern "C"
 /*********************************************************************
  * EXTERNAL FUNCTION
  */
+void tuya_ble_aes128_cbc_cache_clear(void);
 
 
 #ifdef __cplusplus
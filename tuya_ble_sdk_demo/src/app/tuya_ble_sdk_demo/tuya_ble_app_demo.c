@@ -111,9 +111,9 @@ static void tuya_ble_sdk_callback(tuya_ble_cb_evt_param_t* event)
         
         //response - dp report
         case TUYA_BLE_CB_EVT_DP_DATA_REPORT_RESPONSE: {
-            if(g_sync_new.flag == 1)
+            if(g_sync_new.in_flight > 0)
             {
-                lock_open_meth_sync_new_report(event->dp_response_data.status);
+                lock_open_meth_sync_new_response(event->dp_response_data.status, event->dp_response_data.seq);
             }
             lock_timer_start(LOCK_TIMER_COMMUNICATION_MONITOR);
         } break;
@@ -280,6 +280,7 @@ static void tuya_ble_app_data_process(int32_t evt_id, void *data)
         } break;
         
         case APP_EVT_TIMER_10: {
+            sync_new_outtime_cb_handler();
         } break;
         
         case APP_EVT_TIMER_11: {
@@ -1,4 +1,55 @@
 #include "tuya_ble_app_uart_module_handler.h"
+#include "tuya_ble_utils.h"
+#include "tuya_ble_port.h"
+#include "tuya_ble_app_uart_common_handler.h"
+
+
+
+
+/*********************************************************
+FN: 
+*/
+static void tuya_ble_custom_app_uart_common_send(uint8_t cmd, uint8_t* buf, uint8_t len)
+{
+    static uint8_t s_send_buf[7 + 255];
+    
+    s_send_buf[0] = 0x55;
+    s_send_buf[1] = 0xAA;
+    s_send_buf[2] = 0x00;
+    s_send_buf[3] = cmd;
+    s_send_buf[4] = 0x00;
+    s_send_buf[5] = len;
+    memcpy(&s_send_buf[6], buf, len);
+    s_send_buf[6 + len] = tuya_ble_check_sum(s_send_buf, 6 + len);
+    
+    tuya_ble_uart_common_send_data(s_send_buf, 7 + len);
+}
+
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+/*********************************************************
+FN: one page of the flash log for every request, the host walks the slots
+*/
+static void tuya_ble_custom_app_uart_common_log_dump(uint8_t slot)
+{
+    static uint8_t s_rsp[1 + 4 + ELOG_FLASH_BUF_SIZE];
+    uint32_t seq = 0;
+    size_t len;
+    
+    s_rsp[0] = slot;
+    if(slot >= elog_flash_port_get_page_num()) {
+        tuya_ble_custom_app_uart_common_send(TUYA_BLE_UART_COMMON_LOG_DUMP, s_rsp, 1);
+        return;
+    }
+    
+    //a blank or broken page answers with no log
+    len = elog_flash_port_read_page(slot, &seq, &s_rsp[5]);
+    s_rsp[1] = seq>>24;
+    s_rsp[2] = seq>>16;
+    s_rsp[3] = seq>>8;
+    s_rsp[4] = seq;
+    tuya_ble_custom_app_uart_common_send(TUYA_BLE_UART_COMMON_LOG_DUMP, s_rsp, 5 + len);
+}
+#endif
 
 
 
@@ -63,6 +114,16 @@ void tuya_ble_custom_app_uart_common_process(uint8_t* p_in_data, uint16_t in_len
         case TUYA_BLE_UART_COMMON_BLE_OTA_STATUS: {
         } break;
         
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+        case TUYA_BLE_UART_COMMON_LOG_DUMP: {
+            //the slot byte must be there, head(6) + slot(1)
+            if((in_len < 7) || (((p_in_data[4]<<8) + p_in_data[5]) < 1)) {
+                break;
+            }
+            tuya_ble_custom_app_uart_common_log_dump(p_in_data[6]);
+        } break;
+#endif
+        
         default: {
         } break;
     }
@@ -51,6 +51,8 @@ extern "C"
 
 //#define TUYA_BLE_UART_COMMON_MODIFY_BLE_CONN_INTERVER       
 #define TUYA_BLE_UART_COMMON_BLE_OTA_STATUS            	    0xF0
+//data: | slot |, reply: | slot | seq(4) | log |, only | slot | past the last slot
+#define TUYA_BLE_UART_COMMON_LOG_DUMP                       0xF1
 
 
 /*********************************************************************
@@ -160,6 +160,7 @@ typedef struct {
 /* EasyLogger error code */
 typedef enum {
     ELOG_NO_ERR,
+    ELOG_FLASH_FULL_ERR,
 } ElogErrCode;
 
 /* elog.c */
@@ -245,6 +246,17 @@ void elog_flush(void);
 void elog_async_enabled(bool enabled);
 size_t elog_async_get_log(char *log, size_t size);
 size_t elog_async_get_line_log(char *log, size_t size);
+size_t elog_async_get_drop_size(void);
+bool elog_async_is_pending(void);
+
+/* elog_bin.c */
+void elog_bin_printf(uint8_t level, const char *format, ...);
+void elog_bin_hexdump(const char *name, uint8_t width, uint8_t *buf, uint16_t size);
+
+/* elog_port.c */
+void elog_port_output_poll(void);
+bool elog_port_output_pending(void);
+void elog_port_output_flush(void);
 
 /* elog_utils.c */
 size_t elog_strcpy(size_t cur_len, char *dst, const char *src);
@@ -57,19 +57,29 @@
 #define ELOG_COLOR_VERBOSE                       (F_BLUE B_NULL S_NORMAL)
 /*---------------------------------------------------------------------------*/
 /* enable asynchronous output mode */
-//#define ELOG_ASYNC_OUTPUT_ENABLE
+#define ELOG_ASYNC_OUTPUT_ENABLE
 /* the highest output level for async mode, other level will sync output */
-#define ELOG_ASYNC_OUTPUT_LVL                    ELOG_LVL_ASSERT
+#define ELOG_ASYNC_OUTPUT_LVL                    ELOG_LVL_ERROR
 /* buffer size for asynchronous output mode */
-#define ELOG_ASYNC_OUTPUT_BUF_SIZE               (ELOG_LINE_BUF_SIZE * 3)
+#define ELOG_ASYNC_OUTPUT_BUF_SIZE               (ELOG_LINE_BUF_SIZE * 2)
 /* each asynchronous output's log which must end with newline sign */
 #define ELOG_ASYNC_LINE_OUTPUT
 /* asynchronous output mode using POSIX pthread implementation */
-#define ELOG_ASYNC_OUTPUT_USING_PTHREAD
+//#define ELOG_ASYNC_OUTPUT_USING_PTHREAD
+/* log size drained on every main loop poll when pthread is not used */
+#define ELOG_ASYNC_POLL_GET_LOG_BUF_SIZE         64
 /*---------------------------------------------------------------------------*/
 /* enable buffered output mode */
 //#define ELOG_BUF_OUTPUT_ENABLE
 /* buffer size for buffered output mode */
 #define ELOG_BUF_OUTPUT_BUF_SIZE                 (ELOG_LINE_BUF_SIZE * 10)
+/*---------------------------------------------------------------------------*/
+/* enable binary tokenized output for the app log, decode it with tools/elog_bin_decode */
+//#define ELOG_BIN_OUTPUT_ENABLE
+/*---------------------------------------------------------------------------*/
+/* save the log into the flash log ring, see plugins/flash */
+//#define ELOG_FLASH_OUTPUT_ENABLE
+/* the highest level saved into the flash log, raw and assert logs are always saved */
+#define ELOG_FLASH_OUTPUT_LVL                    ELOG_LVL_WARN
 
 #endif /* _ELOG_CFG_H_ */
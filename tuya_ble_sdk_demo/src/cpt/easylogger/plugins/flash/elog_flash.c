@@ -29,7 +29,6 @@
 #define LOG_TAG    "elog.flash"
 
 #include "elog_flash.h"
-#include <easyflash.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -87,9 +86,9 @@ ElogErrCode elog_flash_init(void) {
 void elog_flash_output(size_t index, size_t size) {
     /* 128 bytes buffer */
     uint32_t buf[32] = { 0 };
-    size_t log_total_size = ef_log_get_used_size();
+    size_t log_total_size = elog_flash_port_get_used_size();
     size_t buf_size = sizeof(buf);
-    size_t read_size = 0, read_overage_size = 0;
+    size_t read_size = 0;
 
     /* word alignment for index */
     index = index / 4 * 4;
@@ -104,18 +103,13 @@ void elog_flash_output(size_t index, size_t size) {
     /* output all flash saved log. It will use filter */
     while (true) {
         if (read_size + buf_size < size) {
-            ef_log_read(index + read_size, buf, buf_size);
+            elog_flash_port_read(index + read_size, buf, buf_size);
             elog_flash_port_output((const char*)buf, buf_size);
             read_size += buf_size;
         } else {
-            /* flash read is word alignment */
-            if ((size - read_size) % 4 == 0) {
-                read_overage_size = 0;
-            } else {
-                read_overage_size = 4 - ((size - read_size) % 4);
-            }
-            ef_log_read(index + read_size, buf, size - read_size + read_overage_size);
-            elog_flash_port_output((const char*) buf + read_overage_size, size - read_size);
+            /* the port reads byte by byte, no word alignment overage */
+            elog_flash_port_read(index + read_size, buf, size - read_size);
+            elog_flash_port_output((const char*) buf, size - read_size);
             /* output newline sign */
             elog_flash_port_output(ELOG_NEWLINE_SIGN, strlen(ELOG_NEWLINE_SIGN));
             break;
@@ -129,7 +123,7 @@ void elog_flash_output(size_t index, size_t size) {
  * Read and output all log which saved in flash.
  */
 void elog_flash_output_all(void) {
-    elog_flash_output(0, ef_log_get_used_size());
+    elog_flash_output(0, elog_flash_port_get_used_size());
 }
 
 /**
@@ -138,7 +132,7 @@ void elog_flash_output_all(void) {
  * @param size recent log size
  */
 void elog_flash_output_recent(size_t size) {
-    size_t max_size = ef_log_get_used_size();
+    size_t max_size = elog_flash_port_get_used_size();
 
     if (size == 0) {
         return;
@@ -163,13 +157,15 @@ void elog_flash_write(const char *log, size_t size) {
     size_t write_size = 0, write_index = 0;
 #else
     size_t write_size_temp = 0;
-    EfErrCode result = EF_NO_ERR;
+    ElogErrCode result = ELOG_NO_ERR;
     /* write some '\r' for word alignment */
     char write_overage_c[4] = { '\r', '\r', '\r', '\r' };
 #endif
 
-    /* must be call this function after initialize OK */
-    ELOG_ASSERT(init_ok);
+    /* logs before the initialize are not saved, an assert here would log again */
+    if (!init_ok) {
+        return;
+    }
 
     /* lock flash log buffer */
     log_buf_lock();
@@ -198,11 +194,11 @@ void elog_flash_write(const char *log, size_t size) {
     /* calculate the word alignment write size */
     write_size_temp = size / 4 * 4;
     /* write log to flash */
-    result = ef_log_write((uint32_t *) log, write_size_temp);
+    result = elog_flash_port_write(log, write_size_temp);
     /* write last word alignment data */
-    if ((result == EF_NO_ERR) && (write_size_temp != size)) {
+    if ((result == ELOG_NO_ERR) && (write_size_temp != size)) {
         elog_memcpy(write_overage_c, log + write_size_temp, size - write_size_temp);
-        ef_log_write((uint32_t *) write_overage_c, 4);
+        elog_flash_port_write(write_overage_c, 4);
     }
 #endif
 
@@ -217,8 +213,10 @@ void elog_flash_write(const char *log, size_t size) {
 void elog_flash_flush(void) {
     size_t write_overage_size = 0;
 
-    /* must be call this function after initialize OK */
-    ELOG_ASSERT(init_ok);
+    /* also called on the fault path, which may come before the initialize */
+    if (!init_ok) {
+        return;
+    }
     /* lock flash log buffer */
     log_buf_lock();
     /* flash write is word alignment */
@@ -228,7 +226,7 @@ void elog_flash_flush(void) {
     /* fill '\r' for word alignment */
     memset(log_buf + cur_buf_size, '\r', write_overage_size);
     /* write all buffered log to flash */
-    ef_log_write((uint32_t *) log_buf, cur_buf_size + write_overage_size);
+    elog_flash_port_write(log_buf, cur_buf_size + write_overage_size);
     /* reset position */
     cur_buf_size = 0;
     /* unlock flash log buffer */
@@ -240,14 +238,14 @@ void elog_flash_flush(void) {
  * clean all log which in flash and ram buffer
  */
 void elog_flash_clean(void) {
-    EfErrCode clean_result = EF_NO_ERR;
+    ElogErrCode clean_result = ELOG_NO_ERR;
 
     /* must be call this function after initialize OK */
     ELOG_ASSERT(init_ok);
     /* lock flash log buffer */
     log_buf_lock();
     /* clean all log which in flash */
-    clean_result = ef_log_clean();
+    clean_result = elog_flash_port_clean();
 
 #ifdef ELOG_FLASH_USING_BUF_MODE
     /* reset position */
@@ -257,7 +255,7 @@ void elog_flash_clean(void) {
     /* unlock flash log buffer */
     log_buf_unlock();
 
-    if(clean_result == EF_NO_ERR) {
+    if(clean_result == ELOG_NO_ERR) {
         log_i("All logs which in flash is clean OK.");
     } else {
         log_e("Clean logs which in flash has an error!");
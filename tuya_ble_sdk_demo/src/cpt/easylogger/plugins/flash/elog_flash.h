@@ -62,6 +62,16 @@ ElogErrCode elog_flash_port_init(void);
 void elog_flash_port_output(const char *log, size_t size);
 void elog_flash_port_lock(void);
 void elog_flash_port_unlock(void);
+ElogErrCode elog_flash_port_write(const char *log, size_t size);
+void elog_flash_port_read(size_t index, void *buf, size_t size);
+size_t elog_flash_port_get_used_size(void);
+ElogErrCode elog_flash_port_clean(void);
+void elog_flash_port_poll(void);
+void elog_flash_port_sync(void);
+size_t elog_flash_port_get_page_num(void);
+size_t elog_flash_port_read_page(size_t order, uint32_t *seq, void *buf);
+size_t elog_flash_port_get_drop_size(void);
+bool elog_flash_port_is_pending(void);
 
 #ifdef __cplusplus
 }
@@ -31,7 +31,7 @@
 
 /* EasyLogger flash log plugin's using buffer mode */
 #define ELOG_FLASH_USING_BUF_MODE
-/* EasyLogger flash log plugin's RAM buffer size */
-#define ELOG_FLASH_BUF_SIZE                  /* @note you must define it for a value */
+/* EasyLogger flash log plugin's RAM buffer size, one flash page payload, see elog_flash_port.c */
+#define ELOG_FLASH_BUF_SIZE                  248
 
 #endif /* _ELOG_FLASH_CFG_H_ */
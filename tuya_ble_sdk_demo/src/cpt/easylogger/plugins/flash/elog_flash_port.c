@@ -26,17 +26,173 @@
  * Created on: 2015-07-28
  */
 
+/*
+ * The log is kept in a ring of flash pages on SUBLE_FLASH_LOG_START_ADDR.
+ * Every page holds one flushed RAM buffer:
+ *
+ * | magic(2) | len(1) | sum(1) | seq(4) | log[len] |
+ *
+ * sum is the byte sum of len, seq and log. The head is programmed before the
+ * log, so a page cut by a power loss has a head that does not match its log
+ * and is skipped. On boot the page with the highest seq is the last written.
+ *
+ * A full RAM buffer is only copied to the pending page by the writer.
+ * elog_flash_port_poll() programs it and erases the next sector ahead of the
+ * writer from the main loop. The erase stops the cpu, so it waits for a gap
+ * of ELOG_FLASH_ERASE_SLOTS without radio events. A buffer that finds the
+ * pending page still taken is dropped and counted. One sector is always kept
+ * erased, so the ring holds at least (sector num - 1) sectors of log.
+ *
+ * elog_flash_port_sync() programs the pending page at once, erasing if needed,
+ * for the reset and fault paths.
+ */
+
 #include "elog_flash.h"
+#include "suble_common.h"
+#include "ea.h"
+#include <string.h>
+
+#define ELOG_FLASH_SECTOR_SIZE                   0x1000
+#define ELOG_FLASH_SECTOR_NUM                    ((SUBLE_FLASH_LOG_END_ADDR - SUBLE_FLASH_LOG_START_ADDR) / ELOG_FLASH_SECTOR_SIZE)
+#define ELOG_FLASH_PAGE_SIZE                     256
+#define ELOG_FLASH_PAGE_PER_SECTOR               (ELOG_FLASH_SECTOR_SIZE / ELOG_FLASH_PAGE_SIZE)
+#define ELOG_FLASH_PAGE_NUM                      (ELOG_FLASH_SECTOR_NUM * ELOG_FLASH_PAGE_PER_SECTOR)
+#define ELOG_FLASH_PAGE_MAGIC                    0x474C
+#define ELOG_FLASH_PAGE_ADDR(page)               (SUBLE_FLASH_LOG_START_ADDR + (uint32_t)(page) * ELOG_FLASH_PAGE_SIZE)
+/* radio idle time a sector erase needs, in 625us slots */
+#define ELOG_FLASH_ERASE_SLOTS                   80
+
+typedef struct {
+    uint16_t magic;
+    uint8_t len;
+    uint8_t sum;
+    uint32_t seq;
+} elog_flash_page_head_t;
+
+/* page the next flush is written to */
+static uint16_t next_page = 0;
+/* seq of the next written page */
+static uint32_t next_seq = 0;
+/* the sector the writer enters next is erased */
+static bool ahead_erased = false;
+/* log size lost because the pending page was still taken */
+static size_t drop_size = 0;
+/* a full RAM buffer waiting for elog_flash_port_poll() to program it */
+static uint8_t pending_buf[ELOG_FLASH_BUF_SIZE];
+static size_t pending_len = 0;
+
+/**
+ * add bytes to a page sum
+ */
+static uint8_t page_sum(uint8_t sum, const uint8_t *buf, size_t size) {
+    while (size--) {
+        sum += *buf++;
+    }
+    return sum;
+}
+
+/**
+ * page sum of the head fields, the log is added with page_sum()
+ */
+static uint8_t page_head_sum(const elog_flash_page_head_t *head) {
+    return page_sum(head->len, (const uint8_t *)&head->seq, sizeof(head->seq));
+}
+
+/**
+ * read a page head and check it against the log in flash
+ *
+ * @return true if the page holds a complete log
+ */
+static bool page_read_valid(uint16_t page, elog_flash_page_head_t *head) {
+    uint8_t buf[32];
+    uint8_t sum;
+    size_t pos, chunk;
+
+    suble_flash_read(ELOG_FLASH_PAGE_ADDR(page), (void*)head, sizeof(elog_flash_page_head_t));
+    if ((head->magic != ELOG_FLASH_PAGE_MAGIC) || (head->len == 0) || (head->len > ELOG_FLASH_BUF_SIZE)) {
+        return false;
+    }
+
+    sum = page_head_sum(head);
+    for (pos = 0; pos < head->len; pos += chunk) {
+        chunk = head->len - pos;
+        if (chunk > sizeof(buf)) {
+            chunk = sizeof(buf);
+        }
+        suble_flash_read(ELOG_FLASH_PAGE_ADDR(page) + sizeof(elog_flash_page_head_t) + pos, buf, chunk);
+        sum = page_sum(sum, buf, chunk);
+    }
+    return (sum == head->sum);
+}
+
+/**
+ * a page nobody started to program, the head goes first so checking it is enough
+ */
+static bool page_is_blank(uint16_t page) {
+    elog_flash_page_head_t head;
+
+    suble_flash_read(ELOG_FLASH_PAGE_ADDR(page), (void*)&head, sizeof(elog_flash_page_head_t));
+    return (head.magic == 0xFFFF) && (head.len == 0xFF) && (head.sum == 0xFF) && (head.seq == 0xFFFFFFFF);
+}
+
+/**
+ * sector the writer enters next, the current one if it sits on a sector start
+ */
+static uint16_t ahead_sector(void) {
+    return ((next_page + ELOG_FLASH_PAGE_PER_SECTOR - 1) / ELOG_FLASH_PAGE_PER_SECTOR) % ELOG_FLASH_SECTOR_NUM;
+}
+
+static bool sector_is_blank(uint16_t sector) {
+    uint16_t page;
+
+    for (page = sector * ELOG_FLASH_PAGE_PER_SECTOR; page < (sector + 1) * ELOG_FLASH_PAGE_PER_SECTOR; page++) {
+        if (!page_is_blank(page)) {
+            return false;
+        }
+    }
+    return true;
+}
 
 /**
  * EasyLogger flash log pulgin port initialize
+ * find the last written page and go on behind it, no erase is done here
  *
  * @return result
  */
 ElogErrCode elog_flash_port_init(void) {
     ElogErrCode result = ELOG_NO_ERR;
-    
-    /* add your code here */
+    elog_flash_page_head_t head;
+    bool found = false;
+    uint32_t last_seq = 0;
+    uint16_t last_page = 0;
+    uint16_t page;
+
+    /* the page length must fit into the head */
+    ELOG_ASSERT(ELOG_FLASH_BUF_SIZE <= 0xFF);
+    ELOG_ASSERT(ELOG_FLASH_BUF_SIZE + sizeof(elog_flash_page_head_t) <= ELOG_FLASH_PAGE_SIZE);
+
+    for (page = 0; page < ELOG_FLASH_PAGE_NUM; page++) {
+        if (page_read_valid(page, &head)) {
+            if (!found || ((int32_t)(head.seq - last_seq) > 0)) {
+                found = true;
+                last_seq = head.seq;
+                last_page = page;
+            }
+        }
+    }
+
+    if (found) {
+        next_page = (last_page + 1) % ELOG_FLASH_PAGE_NUM;
+        next_seq = last_seq + 1;
+        /* skip the pages a power loss left behind in the current sector */
+        while ((next_page % ELOG_FLASH_PAGE_PER_SECTOR != 0) && !page_is_blank(next_page)) {
+            next_page = (next_page + 1) % ELOG_FLASH_PAGE_NUM;
+        }
+    } else {
+        next_page = 0;
+        next_seq = 0;
+    }
+    ahead_erased = sector_is_blank(ahead_sector());
 
     return result;
 }
@@ -48,25 +204,239 @@ ElogErrCode elog_flash_port_init(void) {
  * @param size log size
  */
 void elog_flash_port_output(const char *log, size_t size) {
-    
-    /* add your code here */
-    
+    extern void elog_port_output(const char *log, size_t size);
+    elog_port_output(log, size);
 }
 
 /**
  * flash log lock
+ * the plugin is only used from the main loop, suble_flash_xxx() locks the flash itself
  */
 void elog_flash_port_lock(void) {
-    
-    /* add your code here */
-    
 }
 
 /**
  * flash log unlock
  */
 void elog_flash_port_unlock(void) {
-    
-    /* add your code here */
-    
-}
\ No newline at end of file
+}
+
+/**
+ * program the pending page to the next page
+ *
+ * @return false if the sector ahead is not erased yet
+ */
+static bool page_program(void) {
+    elog_flash_page_head_t head;
+
+    if (next_page % ELOG_FLASH_PAGE_PER_SECTOR == 0) {
+        if (!ahead_erased) {
+            return false;
+        }
+        /* entered, the next sector becomes the one ahead */
+        ahead_erased = false;
+    }
+
+    head.magic = ELOG_FLASH_PAGE_MAGIC;
+    head.len = (uint8_t)pending_len;
+    head.seq = next_seq;
+    head.sum = page_sum(page_head_sum(&head), pending_buf, pending_len);
+    suble_flash_write(ELOG_FLASH_PAGE_ADDR(next_page), (void*)&head, sizeof(elog_flash_page_head_t));
+    suble_flash_write(ELOG_FLASH_PAGE_ADDR(next_page) + sizeof(elog_flash_page_head_t), pending_buf, pending_len);
+
+    next_page = (next_page + 1) % ELOG_FLASH_PAGE_NUM;
+    next_seq++;
+    pending_len = 0;
+    return true;
+}
+
+/**
+ * erase the sector ahead of the writer
+ */
+static void ahead_erase(void) {
+    suble_flash_erase(SUBLE_FLASH_LOG_START_ADDR + ahead_sector() * ELOG_FLASH_SECTOR_SIZE, 1);
+    ahead_erased = true;
+}
+
+/**
+ * @return true if no radio event is due while a sector erase stops the cpu
+ */
+static bool erase_window_is_open(void) {
+    uint32_t slots = ELOG_FLASH_ERASE_SLOTS;
+
+    return ea_sleep_check(&slots, 0) && (slots >= ELOG_FLASH_ERASE_SLOTS);
+}
+
+/**
+ * take one flushed RAM buffer as the pending page, programmed by elog_flash_port_poll()
+ * nothing is written to flash here, so it is safe in any log context
+ *
+ * @param log log
+ * @param size log size, at most ELOG_FLASH_BUF_SIZE
+ *
+ * @return result
+ */
+ElogErrCode elog_flash_port_write(const char *log, size_t size) {
+    if (size == 0) {
+        return ELOG_NO_ERR;
+    }
+    if (pending_len != 0) {
+        drop_size += size;
+        return ELOG_FLASH_FULL_ERR;
+    }
+    if (size > ELOG_FLASH_BUF_SIZE) {
+        drop_size += size - ELOG_FLASH_BUF_SIZE;
+        size = ELOG_FLASH_BUF_SIZE;
+    }
+
+    memcpy(pending_buf, log, size);
+    pending_len = size;
+    return ELOG_NO_ERR;
+}
+
+/**
+ * read the saved log as one stream, oldest page first
+ *
+ * @param index position in the stream
+ * @param buf read buffer
+ * @param size read size
+ */
+void elog_flash_port_read(size_t index, void *buf, size_t size) {
+    elog_flash_page_head_t head;
+    uint16_t order, page;
+    size_t len;
+
+    for (order = 0; (order < ELOG_FLASH_PAGE_NUM) && size; order++) {
+        page = (next_page + order) % ELOG_FLASH_PAGE_NUM;
+        if (!page_read_valid(page, &head)) {
+            continue;
+        }
+        if (index >= head.len) {
+            index -= head.len;
+            continue;
+        }
+        len = head.len - index;
+        if (len > size) {
+            len = size;
+        }
+        suble_flash_read(ELOG_FLASH_PAGE_ADDR(page) + sizeof(elog_flash_page_head_t) + index, buf, len);
+        buf = (uint8_t *)buf + len;
+        size -= len;
+        index = 0;
+    }
+}
+
+/**
+ * @return saved log size
+ */
+size_t elog_flash_port_get_used_size(void) {
+    elog_flash_page_head_t head;
+    uint16_t page;
+    size_t size = 0;
+
+    for (page = 0; page < ELOG_FLASH_PAGE_NUM; page++) {
+        if (page_read_valid(page, &head)) {
+            size += head.len;
+        }
+    }
+    return size;
+}
+
+/**
+ * read one page for a dump, pages are counted from the oldest slot of the ring
+ * blank and broken pages read as empty, the caller sorts by seq
+ *
+ * @param order page slot, 0 is the oldest
+ * @param seq page seq
+ * @param buf buffer of ELOG_FLASH_BUF_SIZE
+ *
+ * @return log size of the page, 0 if nothing valid is there
+ */
+size_t elog_flash_port_read_page(size_t order, uint32_t *seq, void *buf) {
+    elog_flash_page_head_t head;
+    uint16_t page;
+
+    if (order >= ELOG_FLASH_PAGE_NUM) {
+        return 0;
+    }
+
+    page = (next_page + order) % ELOG_FLASH_PAGE_NUM;
+    if (!page_read_valid(page, &head)) {
+        return 0;
+    }
+    suble_flash_read(ELOG_FLASH_PAGE_ADDR(page) + sizeof(elog_flash_page_head_t), buf, head.len);
+    *seq = head.seq;
+    return head.len;
+}
+
+/**
+ * @return page slot num of the ring
+ */
+size_t elog_flash_port_get_page_num(void) {
+    return ELOG_FLASH_PAGE_NUM;
+}
+
+/**
+ * erase the whole log area, on request only
+ *
+ * @return result
+ */
+ElogErrCode elog_flash_port_clean(void) {
+    ElogErrCode result = ELOG_NO_ERR;
+
+    suble_flash_erase(SUBLE_FLASH_LOG_START_ADDR, ELOG_FLASH_SECTOR_NUM);
+    next_page = 0;
+    ahead_erased = true;
+    pending_len = 0;
+
+    return result;
+}
+
+/**
+ * program the pending page and erase the sector ahead of the writer, called from the main loop
+ * the erase waits for a radio gap, the page waits for the erase
+ */
+void elog_flash_port_poll(void) {
+    if (!ahead_erased && erase_window_is_open()) {
+        ahead_erase();
+    }
+    if (pending_len != 0) {
+        page_program();
+    }
+}
+
+/**
+ * program the pending page now, erasing without waiting for a radio gap
+ * for the reset and fault paths, where the log matters more than the link
+ */
+void elog_flash_port_sync(void) {
+    if (pending_len == 0) {
+        return;
+    }
+    if (!page_program()) {
+        ahead_erase();
+        page_program();
+    }
+}
+
+/**
+ * @return true when elog_flash_port_poll() or a drop notice has work to do now
+ */
+bool elog_flash_port_is_pending(void) {
+    if (drop_size != 0) {
+        return true;
+    }
+    if ((pending_len != 0) && (ahead_erased || (next_page % ELOG_FLASH_PAGE_PER_SECTOR != 0))) {
+        return true;
+    }
+    return !ahead_erased && erase_window_is_open();
+}
+
+/**
+ * @return log size dropped since the last call
+ */
+size_t elog_flash_port_get_drop_size(void) {
+    size_t size = drop_size;
+    drop_size = 0;
+    return size;
+}
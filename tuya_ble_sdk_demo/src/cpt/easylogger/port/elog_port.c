@@ -27,7 +27,12 @@
  */
  
 #include <elog.h>
+#include <stdio.h>
 #include "uart.h"
+#include "suble_common.h"
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+#include "elog_flash.h"
+#endif
 
 /**
  * EasyLogger port initialize
@@ -50,9 +55,98 @@ ElogErrCode elog_port_init(void) {
  */
 void elog_port_output(const char *log, size_t size) {
     
-    /* add your code here */
-    UART2_PRINTF("%.*s", size, log);
+    /* queued for the tx interrupt, the blocking send keeps the order when it is full */
+    if (uart2_send_async((unsigned char *)log, size) != size) {
+        uart2_send((unsigned char *)log, size);
+    }
+}
+
+#ifdef ELOG_ASYNC_OUTPUT_ENABLE
+/**
+ * asynchronous output notice, nothing to wake up without pthread
+ * the buffered log is drained by elog_port_output_poll()
+ */
+void elog_async_output_notice(void) {
+}
+
+/**
+ * output one chunk of the buffered log, called from the main loop
+ * with interrupts enabled so the UART wait never blocks BLE events
+ */
+void elog_port_output_poll(void) {
+    static char poll_get_buf[ELOG_ASYNC_POLL_GET_LOG_BUF_SIZE];
+    size_t get_log_size = 0;
+    size_t drop_size = 0;
+
+    /* leave the log in the async buffer while the uart is still busy */
+    if (uart2_tx_free_get() < ELOG_ASYNC_POLL_GET_LOG_BUF_SIZE) {
+        return;
+    }
+
+#ifdef ELOG_ASYNC_LINE_OUTPUT
+    get_log_size = elog_async_get_line_log(poll_get_buf, ELOG_ASYNC_POLL_GET_LOG_BUF_SIZE);
+#else
+    get_log_size = elog_async_get_log(poll_get_buf, ELOG_ASYNC_POLL_GET_LOG_BUF_SIZE);
+#endif
+
+    if (get_log_size) {
+        elog_port_output(poll_get_buf, get_log_size);
+        return;
+    }
+
+    /* buffer drained, report what was lost while it was full */
+    drop_size = elog_async_get_drop_size();
+    if (drop_size) {
+        get_log_size = snprintf(poll_get_buf, sizeof(poll_get_buf), "[elog] %d bytes dropped" ELOG_NEWLINE_SIGN, (int)drop_size);
+        elog_port_output(poll_get_buf, get_log_size);
+    }
+
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+    drop_size = elog_flash_port_get_drop_size();
+    if (drop_size) {
+        get_log_size = snprintf(poll_get_buf, sizeof(poll_get_buf), "[elog] %d bytes not saved" ELOG_NEWLINE_SIGN, (int)drop_size);
+        elog_port_output(poll_get_buf, get_log_size);
+    }
+    /* idle, program the saved log and prepare the next sector */
+    elog_flash_port_poll();
+#endif
+}
+
+/**
+ * output all the buffered log at once, for the reset and fault paths.
+ * the blocking send polls the uart, so it also works with interrupts disabled
+ */
+void elog_port_output_flush(void) {
+    char flush_get_buf[ELOG_ASYNC_POLL_GET_LOG_BUF_SIZE];
+    size_t get_log_size;
+
+    do {
+#ifdef ELOG_ASYNC_LINE_OUTPUT
+        get_log_size = elog_async_get_line_log(flush_get_buf, sizeof(flush_get_buf));
+#else
+        get_log_size = elog_async_get_log(flush_get_buf, sizeof(flush_get_buf));
+#endif
+        uart2_send((unsigned char *)flush_get_buf, get_log_size);
+    } while (get_log_size);
+}
+
+/**
+ * whether elog_port_output_poll() would do anything now, the main loop
+ * sleeps when it does not. A busy uart counts as idle, its tx interrupt
+ * wakes the cpu when the queue drains.
+ */
+bool elog_port_output_pending(void) {
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+    if (elog_flash_port_is_pending()) {
+        return true;
+    }
+#endif
+    if (uart2_tx_free_get() < ELOG_ASYNC_POLL_GET_LOG_BUF_SIZE) {
+        return false;
+    }
+    return elog_async_is_pending();
 }
+#endif /* ELOG_ASYNC_OUTPUT_ENABLE */
 
 /**
  * output lock
@@ -78,9 +172,13 @@ void elog_port_output_unlock(void) {
  * @return current time
  */
 const char *elog_port_get_time(void) {
+    static char time[16];
+    uint16_t ms;
+    uint32_t timestamp = suble_get_timestamp_with_ms(&ms);
     
-    /* add your code here */
-    return "12:34:56";
+    /* seconds.milliseconds, the timestamp the app last set */
+    snprintf(time, sizeof(time), "%u.%03u", (unsigned int)timestamp, (unsigned int)ms);
+    return time;
 }
 
 /**
@@ -363,6 +363,11 @@ void elog_raw(const char *format, ...) {
     elog_buf_output(log_buf, log_len);
 #else
     elog_port_output(log_buf, log_len);
+#endif
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+    extern void elog_flash_write(const char *log, size_t size);
+    /* raw log will using assert level, always saved */
+    elog_flash_write(log_buf, log_len);
 #endif
     /* unlock output */
     elog_output_unlock();
@@ -538,6 +543,13 @@ void elog_output(uint8_t level, const char *tag, const char *file, const char *f
     elog_buf_output(log_buf, log_len);
 #else
     elog_port_output(log_buf, log_len);
+#endif
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+    extern void elog_flash_write(const char *log, size_t size);
+    /* only copied to RAM, the flash log plugin programs it from the main loop */
+    if (level <= ELOG_FLASH_OUTPUT_LVL) {
+        elog_flash_write(log_buf, log_len);
+    }
 #endif
     /* unlock output */
     elog_output_unlock();
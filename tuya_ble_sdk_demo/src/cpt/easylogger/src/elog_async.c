@@ -86,6 +86,8 @@ static size_t read_index = 0;
 static bool buf_is_full = false;
 /* log ring buffer empty flag */
 static bool buf_is_empty = true;
+/* log size dropped since the last elog_async_get_drop_size() */
+static size_t drop_size = 0;
 
 extern void elog_port_output(const char *log, size_t size);
 extern void elog_output_lock(void);
@@ -133,11 +135,13 @@ static size_t async_put_log(const char *log, size_t size) {
     space = async_get_buf_space();
     /* no space */
     if (!space) {
+        drop_size += size;
         size = 0;
         goto __exit;
     }
     /* drop some log */
     if (space <= size) {
+        drop_size += size - space;
         size = space;
         buf_is_full = true;
     }
@@ -254,6 +258,31 @@ __exit:
 }
 #endif /* ELOG_ASYNC_LINE_OUTPUT */
 
+/**
+ * get and clear the log size dropped because the ring buffer was full
+ *
+ * @return dropped log size
+ */
+size_t elog_async_get_drop_size(void) {
+    size_t size;
+
+    elog_output_lock();
+    size = drop_size;
+    drop_size = 0;
+    elog_output_unlock();
+
+    return size;
+}
+
+/**
+ * whether buffered log or a drop notice waits for output
+ *
+ * @return true when elog_async_get_log() or elog_async_get_drop_size() has something
+ */
+bool elog_async_is_pending(void) {
+    return (elog_async_get_buf_used() != 0) || (drop_size != 0);
+}
+
 void elog_async_output(uint8_t level, const char *log, size_t size) {
     /* this function must be implement by user when ELOG_ASYNC_OUTPUT_USING_PTHREAD is not defined */
     extern void elog_async_output_notice(void);
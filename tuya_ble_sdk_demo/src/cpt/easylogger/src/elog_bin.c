@@ -0,0 +1,259 @@
+/*
+ * This file is part of the EasyLogger Library.
+ *
+ * Copyright (c) 2015, Armink, <armink.ztl@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * 'Software'), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Function: Binary tokenized output.
+ * Created on: 2026-10-18
+ */
+
+/*
+ * The format string is not expanded on the device. Its address in flash is
+ * sent with the raw arguments and tools/elog_bin_decode rebuilds the text
+ * from the firmware image. The strings stay in the image, so this saves the
+ * vsnprintf() time and UART bytes, not flash.
+ *
+ * frame:           | 0xA5 | type | len | payload[len] | sum |
+ * printf payload:  | level | fmt addr(4) | args... |
+ *                  integer arguments take 4 bytes, %ll ones and double 8 bytes,
+ *                  strings are | str len | str |, bit 7 of str len marks a cut string
+ * hexdump payload: | level | name addr(4) | data... |
+ * all fields are little endian, sum is the byte sum of type, len and payload.
+ */
+
+#include <elog.h>
+#include <stdarg.h>
+#include <string.h>
+
+#ifdef ELOG_BIN_OUTPUT_ENABLE
+
+#define ELOG_BIN_SYNC                            0xA5
+#define ELOG_BIN_TYPE_PRINTF                     0x01
+#define ELOG_BIN_TYPE_HEXDUMP                    0x02
+/* sync, type, len and sum */
+#define ELOG_BIN_FRAME_OVERHEAD                  4
+/* a frame must fit its length into one byte */
+#define ELOG_BIN_PAYLOAD_MAX                     250
+/* the longest string argument kept in a frame, the rest is cut */
+#define ELOG_BIN_STR_MAX                         32
+/* set in the string length when the string was cut */
+#define ELOG_BIN_STR_CUT                         0x80
+
+extern void elog_port_output(const char *log, size_t size);
+extern void elog_output_lock(void);
+extern void elog_output_unlock(void);
+
+/* frame buffer, used under the output lock */
+static uint8_t frame_buf[ELOG_BIN_PAYLOAD_MAX + ELOG_BIN_FRAME_OVERHEAD];
+
+/**
+ * append a little endian word to the payload
+ *
+ * @return new payload length
+ */
+static size_t bin_put_u32(size_t len, uint32_t value) {
+    if (len + 4 > ELOG_BIN_PAYLOAD_MAX) {
+        return len;
+    }
+    frame_buf[3 + len++] = (uint8_t)value;
+    frame_buf[3 + len++] = (uint8_t)(value >> 8);
+    frame_buf[3 + len++] = (uint8_t)(value >> 16);
+    frame_buf[3 + len++] = (uint8_t)(value >> 24);
+    return len;
+}
+
+/**
+ * close the frame in frame_buf and send it through the configured output mode
+ *
+ * @param level log level
+ * @param type frame type
+ * @param len payload length
+ */
+static void bin_output_frame(uint8_t level, uint8_t type, size_t len) {
+    uint8_t sum = 0;
+    size_t i;
+
+    frame_buf[0] = ELOG_BIN_SYNC;
+    frame_buf[1] = type;
+    frame_buf[2] = (uint8_t)len;
+    for (i = 1; i < 3 + len; i++) {
+        sum += frame_buf[i];
+    }
+    frame_buf[3 + len] = sum;
+
+#if defined(ELOG_ASYNC_OUTPUT_ENABLE)
+    extern void elog_async_output(uint8_t level, const char *log, size_t size);
+    elog_async_output(level, (const char *)frame_buf, len + ELOG_BIN_FRAME_OVERHEAD);
+#elif defined(ELOG_BUF_OUTPUT_ENABLE)
+    extern void elog_buf_output(const char *log, size_t size);
+    elog_buf_output((const char *)frame_buf, len + ELOG_BIN_FRAME_OVERHEAD);
+#else
+    elog_port_output((const char *)frame_buf, len + ELOG_BIN_FRAME_OVERHEAD);
+#endif
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+    extern void elog_flash_write(const char *log, size_t size);
+    if (level <= ELOG_FLASH_OUTPUT_LVL) {
+        elog_flash_write((const char *)frame_buf, len + ELOG_BIN_FRAME_OVERHEAD);
+    }
+#endif
+}
+
+/**
+ * output a log as format string address and raw arguments
+ * only the conversion letters are walked, nothing is formatted
+ *
+ * @param level log level
+ * @param format output format, must stay in the firmware image
+ * @param ... args
+ */
+void elog_bin_printf(uint8_t level, const char *format, ...) {
+    va_list args;
+    const char *fmt = format;
+    size_t len = 0;
+
+    if (!elog_get_output_enabled()) {
+        return;
+    }
+
+    va_start(args, format);
+    elog_output_lock();
+
+    frame_buf[3 + len++] = level;
+    len = bin_put_u32(len, (uint32_t)(uintptr_t)format);
+
+    while (*fmt) {
+        size_t long_num = 0;
+
+        if (*fmt++ != '%') {
+            continue;
+        }
+        /* skip flags, width, precision and length, '*' takes an argument */
+        while (*fmt && strchr("-+ #0123456789.*lhzjt", *fmt)) {
+            if (*fmt == '*') {
+                len = bin_put_u32(len, (uint32_t)va_arg(args, int));
+            } else if (*fmt == 'l') {
+                long_num++;
+            }
+            fmt++;
+        }
+        switch (*fmt) {
+        case '\0':
+            break;
+        case '%':
+            fmt++;
+            break;
+        case 's': {
+            const char *str = va_arg(args, const char *);
+            size_t str_len = str ? strlen(str) : 0;
+            uint8_t cut = 0;
+            if (str_len > ELOG_BIN_STR_MAX) {
+                str_len = ELOG_BIN_STR_MAX;
+                cut = ELOG_BIN_STR_CUT;
+            }
+            /* keep what fits in the frame */
+            if (len + 1 + str_len > ELOG_BIN_PAYLOAD_MAX && len < ELOG_BIN_PAYLOAD_MAX) {
+                str_len = ELOG_BIN_PAYLOAD_MAX - len - 1;
+                cut = ELOG_BIN_STR_CUT;
+            }
+            if (len < ELOG_BIN_PAYLOAD_MAX) {
+                frame_buf[3 + len++] = (uint8_t)str_len | cut;
+                memcpy(&frame_buf[3 + len], str, str_len);
+                len += str_len;
+            }
+            fmt++;
+            break;
+        }
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G': {
+            union {
+                double d;
+                uint32_t w[2];
+            } value;
+            value.d = va_arg(args, double);
+            len = bin_put_u32(len, value.w[0]);
+            len = bin_put_u32(len, value.w[1]);
+            fmt++;
+            break;
+        }
+        default:
+            if (long_num >= 2) {
+                /* %lld and friends, low word first */
+                unsigned long long value = va_arg(args, unsigned long long);
+                len = bin_put_u32(len, (uint32_t)value);
+                len = bin_put_u32(len, (uint32_t)(value >> 32));
+            } else {
+                /* d i u x X o c p, the target passes them all in one word */
+                len = bin_put_u32(len, (uint32_t)va_arg(args, int));
+            }
+            fmt++;
+            break;
+        }
+    }
+
+    bin_output_frame(level, ELOG_BIN_TYPE_PRINTF, len);
+
+    elog_output_unlock();
+    va_end(args);
+}
+
+/**
+ * output a hexdump as raw bytes, split into several frames when it is long
+ *
+ * @param name name for hex object, must stay in the firmware image
+ * @param width unused, the decoder picks the line width
+ * @param buf hex buffer
+ * @param size buffer size
+ */
+void elog_bin_hexdump(const char *name, uint8_t width, uint8_t *buf, uint16_t size) {
+    size_t len, chunk;
+
+    (void)width;
+
+    if (!elog_get_output_enabled()) {
+        return;
+    }
+
+    elog_output_lock();
+
+    do {
+        len = 0;
+        frame_buf[3 + len++] = ELOG_LVL_DEBUG;
+        len = bin_put_u32(len, (uint32_t)(uintptr_t)name);
+        chunk = ELOG_BIN_PAYLOAD_MAX - len;
+        if (chunk > size) {
+            chunk = size;
+        }
+        memcpy(&frame_buf[3 + len], buf, chunk);
+        len += chunk;
+        bin_output_frame(ELOG_LVL_DEBUG, ELOG_BIN_TYPE_HEXDUMP, len);
+        buf += chunk;
+        size -= chunk;
+    } while (size);
+
+    elog_output_unlock();
+}
+
+#endif /* ELOG_BIN_OUTPUT_ENABLE */
@@ -12,23 +12,6 @@
 #include "tuya_ble_heap.h"
 #endif 
 
-#if 0
-byte_str prf(byte_str key, byte_str blocks) {
-    mbedcrypto_aes_context ctx;
-    mbedcrypto_aes_init(&ctx);
-    mbedcrypto_aes_setkey_enc(&ctx, key.buf, key.len * 8);
-    uint8_t *output = calloc(blocks.len, 1);
-    uint8_t iv[16] = {0};
-    mbedcrypto_aes_crypt_cbc(&ctx, MBEDCRYPTO_AES_ENCRYPT, blocks.len, iv, blocks.buf, output);
-    mbedcrypto_aes_free(&ctx);
-    uint8_t *ret_buf = calloc(16, 1);
-    memcpy(ret_buf, output + (blocks.len - 16), 16);
-    free(output);
-    byte_str ret = {.buf=ret_buf, .len=16};
-    return ret;
-}
-#endif 
-
 byte_str prf(byte_str key, byte_str blocks) {
 	mbedtls_aes_context aes_ctx;
 	uint8_t iv[16] = {0};
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['generators',['Generators',['../group__generators.html',1,'']]]
-];
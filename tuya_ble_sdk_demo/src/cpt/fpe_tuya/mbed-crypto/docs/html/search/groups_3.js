@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['implementation_2dspecific_20definitions',['Implementation-specific definitions',['../group__platform.html',1,'']]]
-];
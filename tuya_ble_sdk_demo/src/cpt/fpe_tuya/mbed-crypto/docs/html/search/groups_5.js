@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['message_20digests',['Message digests',['../group__hash.html',1,'']]],
-  ['message_20authentication_20codes',['Message authentication codes',['../group__MAC.html',1,'']]]
-];
@@ -3,7 +3,7 @@
 #include "sha1.h"
 #include "hmac-sha1.h"
 
-void HMAC_SHA1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned int msg_len, uint8_t *digest)
+void HMAC_SHA1_Init(HMAC_SHA1Context *ctx, uint8_t *key, unsigned int key_len)
 {
 	uint8_t ipad[HMAC_BLOCK_SIZE];
 	uint8_t opad[HMAC_BLOCK_SIZE];
@@ -29,16 +29,32 @@ void HMAC_SHA1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned in
 		opad[i] ^= 0x5c;
 	}
 
-	// Inner SHA1
+	// both pads fill a whole block, the states hold nothing but the hash
+	SHA1Reset(&ctx->inner);
+	SHA1Input(&ctx->inner, ipad, HMAC_BLOCK_SIZE);
+	SHA1Reset(&ctx->outer);
+	SHA1Input(&ctx->outer, opad, HMAC_BLOCK_SIZE);
+}
+
+void HMAC_SHA1_Compute(const HMAC_SHA1Context *ctx, uint8_t *message, unsigned int msg_len, uint8_t *digest)
+{
 	SHA1Context sha;
-	SHA1Reset(&sha);
-	SHA1Input(&sha, ipad, HMAC_BLOCK_SIZE);
+
+	// Inner SHA1
+	sha = ctx->inner;
 	SHA1Input(&sha, message, msg_len);
 	SHA1Result(&sha, digest);
 
 	// Outer SHA1
-	SHA1Reset(&sha);
-	SHA1Input(&sha, opad, HMAC_BLOCK_SIZE);
+	sha = ctx->outer;
 	SHA1Input(&sha, digest, SHA1HashSize);
 	SHA1Result(&sha, digest);
 }
+
+void HMAC_SHA1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned int msg_len, uint8_t *digest)
+{
+	HMAC_SHA1Context ctx;
+
+	HMAC_SHA1_Init(&ctx, key, key_len);
+	HMAC_SHA1_Compute(&ctx, message, msg_len, digest);
+}
@@ -6,10 +6,23 @@ extern "C" {
 #endif
     
 #include <stdint.h>
+#include "sha1.h"
     
 #define HMAC_BLOCK_SIZE 		( 64 )
+
+/*
+*  SHA1 states after the ipad and opad blocks of one key,
+*  reused by every HMAC_SHA1_Compute() with that key
+*/
+typedef struct HMAC_SHA1Context
+{
+	SHA1Context inner;
+	SHA1Context outer;
+} HMAC_SHA1Context;
     
 void HMAC_SHA1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned int msg_len, uint8_t *digest);
+void HMAC_SHA1_Init(HMAC_SHA1Context *ctx, uint8_t *key, unsigned int key_len);
+void HMAC_SHA1_Compute(const HMAC_SHA1Context *ctx, uint8_t *message, unsigned int msg_len, uint8_t *digest);
 
 #ifdef __cplusplus
 }
@@ -1,4 +1,6 @@
 #include "suble_common.h"
+#include "ea.h"
+#include "app_flash.h"
 
 
 
@@ -37,15 +39,35 @@
                 .adv_channal_map  = 0x07,                                   \
             }
 
+//scan filter
+#define SUBLE_SCAN_DEDUP_NUM                8
+#define SUBLE_SCAN_DEDUP_WINDOW             (320) //unit: 625us slot, 200ms
+#define SUBLE_SCAN_TUYA_UUID_LSB            0x01  //service uuid 0xA201
+#define SUBLE_SCAN_TUYA_UUID_MSB            0xA2
+#define SUBLE_SCAN_TUYA_COMPANY_LSB         0xD0  //company id 0x07D0
+#define SUBLE_SCAN_TUYA_COMPANY_MSB         0x07
+
 /*********************************************************************
  * LOCAL STRUCT
  */
+typedef struct
+{
+    uint8_t  mac[SUBLE_BT_MAC_LEN];
+    uint8_t  evt_type;
+    uint8_t  data_len;
+    uint16_t data_sum;
+    uint32_t time;
+} scan_dedup_t;
 
 /*********************************************************************
  * LOCAL VARIABLE
  */
 static suble_scan_result_handler_t suble_scan_result_handler;
 
+//recently forwarded reports, replaced round robin
+static scan_dedup_t s_scan_dedup[SUBLE_SCAN_DEDUP_NUM];
+static uint8_t s_scan_dedup_next = 0;
+
 /*********************************************************************
  * VARIABLE
  */
@@ -106,6 +128,91 @@ void suble_adv_param_set(void)
 
 /*********************************************************  scan  *********************************************************/
 
+/*********************************************************
+FN: the report carries the Tuya service uuid, service data or manufacturer data
+*/
+static bool suble_scan_filter_is_tuya(struct adv_report const *adv)
+{
+    uint8_t idx = 0;
+    
+    while(idx + 1 < adv->data_len)
+    {
+        uint8_t len = adv->data[idx];
+        uint8_t type = adv->data[idx+1];
+        const uint8_t* value = &adv->data[idx+2];
+        
+        if((len == 0) || (idx + 1 + len > adv->data_len)) {
+            break; //malformed
+        }
+        
+        switch(type)
+        {
+            case GAP_AD_TYPE_MORE_16_BIT_UUID:
+            case GAP_AD_TYPE_COMPLETE_LIST_16_BIT_UUID: {
+                for(uint8_t pos=0; pos+1<len-1; pos+=2) {
+                    if((value[pos] == SUBLE_SCAN_TUYA_UUID_LSB) && (value[pos+1] == SUBLE_SCAN_TUYA_UUID_MSB)) {
+                        return true;
+                    }
+                }
+            } break;
+            
+            case GAP_AD_TYPE_SERVICE_16_BIT_DATA: {
+                if((len >= 3) && (value[0] == SUBLE_SCAN_TUYA_UUID_LSB) && (value[1] == SUBLE_SCAN_TUYA_UUID_MSB)) {
+                    return true;
+                }
+            } break;
+            
+            case GAP_AD_TYPE_MANU_SPECIFIC_DATA: {
+                if((len >= 3) && (value[0] == SUBLE_SCAN_TUYA_COMPANY_LSB) && (value[1] == SUBLE_SCAN_TUYA_COMPANY_MSB)) {
+                    return true;
+                }
+            } break;
+            
+            default: {
+            } break;
+        }
+        
+        idx += 1 + len;
+    }
+    return false;
+}
+
+/*********************************************************
+FN: same report already forwarded inside the dedup window
+*/
+static bool suble_scan_filter_is_dup(struct adv_report const *adv)
+{
+    uint32_t now = ea_time_get_slot_rounded();
+    uint16_t data_sum = 0;
+    
+    for(uint8_t idx=0; idx<adv->data_len; idx++) {
+        data_sum = (data_sum << 1 | data_sum >> 15) + adv->data[idx];
+    }
+    
+    for(uint8_t idx=0; idx<SUBLE_SCAN_DEDUP_NUM; idx++) {
+        scan_dedup_t* dedup = &s_scan_dedup[idx];
+        if((dedup->evt_type == adv->evt_type)
+            && (dedup->data_len == adv->data_len)
+            && (dedup->data_sum == data_sum)
+            && (memcmp(dedup->mac, adv->adv_addr.addr, SUBLE_BT_MAC_LEN) == 0)) {
+            if(((now - dedup->time) & MAX_SLOT_CLOCK) < SUBLE_SCAN_DEDUP_WINDOW) {
+                return true;
+            }
+            dedup->time = now;
+            return false;
+        }
+    }
+    
+    scan_dedup_t* dedup = &s_scan_dedup[s_scan_dedup_next];
+    memcpy(dedup->mac, adv->adv_addr.addr, SUBLE_BT_MAC_LEN);
+    dedup->evt_type = adv->evt_type;
+    dedup->data_len = adv->data_len;
+    dedup->data_sum = data_sum;
+    dedup->time = now;
+    s_scan_dedup_next = (s_scan_dedup_next + 1) % SUBLE_SCAN_DEDUP_NUM;
+    return false;
+}
+
 /*********************************************************
 FN: ɨ¼
 */
@@ -119,6 +226,14 @@ void suble_scan_evt_handler(struct adv_report const *adv)
 //    g_scan_count++;
 //    SUBLE_PRINTF("g_scan_count: %d", g_scan_count);
     
+    //drop foreign and repeated reports before the master logic parses them
+    if(!suble_scan_filter_is_tuya(adv) && !lock_slave_mac_is_bound((void*)adv->adv_addr.addr)) {
+        return;
+    }
+    if(suble_scan_filter_is_dup(adv)) {
+        return;
+    }
+    
     suble_scan_result_handler(SUBLE_SCAN_EVT_ADV_REPORT, (void*)adv, 0);
 }
 void suble_scan_timeout_handler(void)
@@ -140,6 +255,8 @@ void suble_scan_start(suble_scan_result_handler_t handler)
 {
     g_scan_count = 0;
     suble_scan_result_handler = handler;
+    memset(s_scan_dedup, 0, sizeof(s_scan_dedup));
+    s_scan_dedup_next = 0;
     
     APPM_SET_FIELD(SCAN_EN, 1);
     appm_scan_adv_con_schedule();
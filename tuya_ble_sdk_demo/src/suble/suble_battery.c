@@ -27,6 +27,7 @@ static uint32_t s_adc_value_sum = 0;
 /*********************************************************************
  * LOCAL FUNCTION
  */
+static void suble_battery_get_value_outtime_handler(void* timer);
 
 
 
@@ -39,6 +40,8 @@ void suble_battery_init(void)
     adc_init(0x08, 0);
 }
 
+static suble_timer_t s_sample_timer = SUBLE_TIMER_DEF(suble_battery_get_value_outtime_handler);
+
 /*********************************************************
 FN: 
 */
@@ -48,14 +51,14 @@ void suble_battery_sample_start(void)
     memset(s_adc_value, 0x00, BATTERY_SAMPLE_TIME);
     s_adc_value_sum = 0;
     
-    suble_timer_start_0(SUBLE_TIMER103, 97, SUBLE_TIMER_COUNT_ENDLESS);
+    suble_timer_start_0(&s_sample_timer, 97, SUBLE_TIMER_COUNT_ENDLESS);
     SUBLE_PRINTF("suble_battery_sample_start");
 }
 
 /*********************************************************
 FN: 
 */
-void suble_battery_get_value_outtime_handler(void)
+static void suble_battery_get_value_outtime_handler(void* timer)
 {
     if(s_sample_idx < BATTERY_SAMPLE_TIME) {
         s_adc_value[s_sample_idx] = adc_get_value();
@@ -87,7 +90,7 @@ void suble_battery_get_value_outtime_handler(void)
         SUBLE_PRINTF("battery_percent_report: %d", percent);
         lock_state_sync_report(OR_STS_BATTERY_PERCENT, percent);
         
-        suble_timer_stop_0(SUBLE_TIMER103);
+        suble_timer_stop_0(&s_sample_timer);
     }
     s_sample_idx++;
 /*
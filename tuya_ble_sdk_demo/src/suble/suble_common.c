@@ -41,10 +41,12 @@ void suble_init_func(uint8_t location)
         } break;
         
         case 1: {
+            suble_wdt_wake_start();
             lock_timer_creat();
         } break;
         
         case 2: {
+            suble_rand_init();
             suble_test_func();
             
             tuya_ble_app_init();
@@ -63,7 +65,25 @@ FN:
 void suble_mainloop(void)
 {
     tuya_ble_main_tasks_exec();
-    suble_svc_notify_handler();
+    suble_log_poll();
+}
+
+/*********************************************************
+FN: nothing for suble_mainloop until an interrupt or a kernel timer posts work
+    called with interrupts disabled right before the cpu sleeps, so work posted
+    by an isr after this check wakes the cpu again
+*/
+bool suble_mainloop_is_idle(void)
+{
+    if(tuya_ble_scheduler_queue_events_get() != 0) {
+        return false;
+    }
+#ifdef ELOG_ASYNC_OUTPUT_ENABLE
+    if(elog_port_output_pending()) {
+        return false;
+    }
+#endif
+    return true;
 }
 
 
@@ -71,6 +91,16 @@ void suble_mainloop(void)
 
 /*********************************************************  log  *********************************************************/
 
+/*********************************************************
+FN: ELOG_ASSERT, keep the log of the failure before stopping
+*/
+static void suble_log_assert_hook(const char* expr, const char* func, size_t line)
+{
+    elog_a("elog", "(%s) has assert failed at %s:%d.", expr, func, (int)line);
+    suble_log_flush();
+    while(1);
+}
+
 /*********************************************************
 FN: 
 */
@@ -78,7 +108,43 @@ void suble_log_init(void)
 {
     elog_init();
 //    elog_set_fmt(ELOG_LVL_DEBUG, ELOG_FMT_LVL);
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+    //the lines kept in the flash log need the time they happened
+    for(uint8_t level=ELOG_LVL_ASSERT; level<=ELOG_FLASH_OUTPUT_LVL; level++) {
+        elog_set_fmt(level, ELOG_FMT_TIME);
+    }
+#endif
+    elog_assert_set_hook(suble_log_assert_hook);
     elog_start();
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+    elog_flash_init();
+#endif
+}
+
+/*********************************************************
+FN: drain the deferred log outside of any critical section
+*/
+void suble_log_poll(void)
+{
+#ifdef ELOG_ASYNC_OUTPUT_ENABLE
+    elog_port_output_poll();
+#endif
+}
+
+/*********************************************************
+FN: write out all the buffered log, for the reset and fault paths
+*/
+void suble_log_flush(void)
+{
+#ifdef ELOG_ASYNC_OUTPUT_ENABLE
+    elog_port_output_flush();
+#endif
+#ifdef ELOG_FLASH_OUTPUT_ENABLE
+    //the page taken before, then the RAM buffer
+    elog_flash_port_sync();
+    elog_flash_flush();
+    elog_flash_port_sync();
+#endif
 }
 
 /*********************************************************
@@ -86,7 +152,11 @@ FN:
 */
 void suble_log_hexdump(const char *name, uint8_t *buf, uint16_t size)
 {
+#ifdef ELOG_BIN_OUTPUT_ENABLE
+    elog_bin_hexdump(name, 8, buf, size);
+#else
     elog_hexdump(name, 8, buf, size);
+#endif
 }
 
 /*********************************************************
@@ -94,7 +164,11 @@ FN:
 */
 void suble_log_hexdump_for_tuya_ble_sdk(const char *name, uint8_t width, uint8_t *buf, uint16_t size)
 {
+#ifdef ELOG_BIN_OUTPUT_ENABLE
+    elog_bin_hexdump(name, width, buf, size);
+#else
     elog_hexdump(name, width, buf, size);
+#endif
 }
 
 /*********************************************************
@@ -110,6 +184,7 @@ FN:
 */
 void suble_system_reset(void)
 {
+    //platform_reset() flushes the log
     platform_reset(0);
 }
 
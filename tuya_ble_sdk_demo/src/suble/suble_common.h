@@ -54,6 +54,7 @@ extern "C"
 
 //cpt
 #include "elog.h"
+#include "elog_flash.h"
 #include "sf_port.h"
 //tuya_ble_sdk
 #include "tuya_ble_log.h"
@@ -111,8 +112,26 @@ typedef enum {
     SUBLE_GAP_EVT_CONNECT_TIMEOUT,
 } suble_gap_result_t;
 
+typedef enum {
+    SUBLE_LINK_MODE_NONE = 0x00, //parameters of the central
+    SUBLE_LINK_MODE_IDLE,
+    SUBLE_LINK_MODE_BULK,
+} suble_link_mode_t;
+
+//bulk operations of the slave link, bits
+typedef enum {
+    SUBLE_LINK_OP_OTA           = 0x01,
+    SUBLE_LINK_OP_OPEN_METH_SYNC= 0x02,
+    SUBLE_LINK_OP_OFFLINE_EVT   = 0x04,
+} suble_link_op_t;
+
 /* suble_svc
  **************************************************/
+//notifies queued in the stack at once, each holds a kernel message
+#define SUBLE_SVC_NOTIFY_DEPTH                 (4)
+#define SUBLE_SVC_C_CACHE_NV_AREA              (SF_AREA_0)
+#define SUBLE_SVC_C_CACHE_NV_ID                (0x0100) //0x0100~0x0109, out of the app nv id range
+
 typedef enum {
     SUBLE_SVC_C_EVT_DISCOVERY_COMPLETE = 0x00,
     SUBLE_SVC_C_EVT_RECEIVE_DATA_FROM_SLAVE,
@@ -144,13 +163,14 @@ enum
 //ota
 #define SUBLE_FLASH_OTA_START_ADDR             SUBLE_FLASH_START_ADDR
 #define SUBLE_FLASH_OTA_END_ADDR               0x64000
+//log
+#define SUBLE_FLASH_LOG_START_ADDR             0x72000
+#define SUBLE_FLASH_LOG_END_ADDR               0x76000
 //mac
 #define SUBLE_FLASH_BT_MAC_ADDR                0x7F000
 
 /* suble_timer
  **************************************************/
-#define SUBLE_TIMER_MAX_NUM                    20
-
 #define SUBLE_TIMER_COUNT_ENDLESS              0xFFFFFFFF
 
 typedef enum {
@@ -255,13 +275,20 @@ typedef struct
 
 /* suble_timer
  **************************************************/
-typedef struct
+typedef void (*suble_timer_handler_t)(void*);
+
+//a timer of the wheel, owned by its module, the handler gets the timer
+typedef struct suble_timer_s
 {
+    struct suble_timer_s*  next;
+    struct suble_timer_s** pprev;   //NULL when stopped
+    uint32_t deadline;              //absolute, in 10ms ticks
+    uint32_t period;
     uint32_t count;
-    uint32_t delay;
+    suble_timer_handler_t handler;
 } suble_timer_t;
 
-typedef void (*suble_timer_handler_t)(void*);
+#define SUBLE_TIMER_DEF(_handler)   {NULL, NULL, 0, 0, 0, (_handler)}
 
 /* suble_key
  **************************************************/
@@ -344,11 +371,14 @@ extern conn_info_t     g_conn_info[];
  **************************************************/
 void suble_init_func(uint8_t location);
 void suble_mainloop(void);
+bool suble_mainloop_is_idle(void);
 void suble_system_reset(void);
 void suble_enter_critical(void);
 void suble_exit_critical(void);
 
 void suble_log_init(void);
+void suble_log_poll(void);
+void suble_log_flush(void);
 void suble_log_hexdump(const char *name, uint8_t *buf, uint16_t size);
 void suble_log_hexdump_for_tuya_ble_sdk(const char *name, uint8_t width, uint8_t *buf, uint16_t size);
 void suble_log_hexdump_empty(const char *name, uint8_t width, uint8_t *buf, uint16_t size);
@@ -372,7 +402,7 @@ void suble_scan_param_set(void);
 uint32_t suble_gap_connect(struct gap_bdaddr bdaddr, suble_connect_result_handler_t handler);
 void suble_gap_disconnect(uint16_t condix, uint8_t hci_status_code);
 void suble_gap_disconnect_for_tuya_ble_sdk(void);
-void suble_gap_conn_param_update(uint16_t condix, uint16_t cMin, uint16_t cMax, uint16_t latency, uint16_t timeout);
+uint32_t suble_gap_conn_param_update(uint16_t condix, uint16_t cMin, uint16_t cMax, uint16_t latency, uint16_t timeout);
 void suble_gap_init_bt_mac(void);
 void suble_gap_set_bt_mac(uint8_t *pMac);
 void suble_gap_get_bt_mac(uint8_t *pMac, uint32_t size);
@@ -382,14 +412,22 @@ void suble_gap_disconn_handler(void);
 void suble_gap_master_conn_handler(void);
 void suble_gap_master_disconn_handler(void);
 void suble_gap_master_connect_timeout_handler(void);
+void suble_gap_link_start(void);
+void suble_gap_link_stop(void);
+void suble_gap_link_op_begin(suble_link_op_t op);
+void suble_gap_link_op_end(suble_link_op_t op);
+void suble_gap_link_relax(void);
+void suble_gap_link_traffic(void);
+void suble_gap_link_param_result(uint16_t condix, bool accepted);
+void suble_gap_link_param_updated(uint16_t condix, uint16_t interval, uint16_t latency);
 
 /* suble_svc
  **************************************************/
 void suble_svc_init(void);
 void suble_svc_receive_data(uint8_t* buf, uint32_t size);
 void suble_svc_send_data_complete(void);
-void suble_svc_notify(uint8_t* buf, uint32_t size);
-void suble_svc_notify_handler(void);
+bool suble_svc_notify(uint8_t* buf, uint32_t size);
+void suble_svc_notify_reset(void);
 
 void suble_svc_c_init(void);
 void suble_svc_c_handle_assign(uint16_t conn_handle);
@@ -397,6 +435,9 @@ void suble_db_discovery_init(void);
 void suble_db_discovery_start(suble_svc_result_handler_t handler);
 uint32_t suble_svc_c_send_data(uint16_t condix, uint8_t* pBuf, uint16_t len);
 void suble_svc_c_discovery_complete(void);
+uint32_t suble_svc_c_cache_restore(uint8_t condix);
+void suble_svc_c_ntf_cfg_enable(uint8_t condix);
+uint32_t suble_svc_c_cache_check(uint8_t condix, uint8_t status);
 void suble_svc_c_receive_data_from_slave(void* buf, uint32_t size);
 
 /* suble_gpio
@@ -409,6 +450,7 @@ void suble_gpio_set(uint8_t pin, uint8_t level);
 void suble_gpio_reverse(uint8_t pin);
 
 void suble_gpio_irq_init(void);
+void suble_gpio_irq_rearm(uint8_t pin);
 
 void suble_buzzer_start(uint32_t freq);
 void suble_buzzer_stop(void);
@@ -426,10 +468,13 @@ void suble_gpio_rled_period_blink_cancel(void);
 
 /* suble_uart
  **************************************************/
+typedef void (*suble_uart_tx_cb_t)(void);
+
 void suble_uart1_init(void);
 void suble_uart2_init(void);
-void suble_uart1_send(const uint8_t* buf, uint32_t size);
-void suble_uart2_send(const uint8_t* buf, uint32_t size);
+bool suble_uart1_send(const uint8_t* buf, uint32_t size);
+bool suble_uart2_send(const uint8_t* buf, uint32_t size);
+void suble_uart1_tx_cb_register(suble_uart_tx_cb_t cb);
 
 /* suble_flash
  **************************************************/
@@ -440,10 +485,10 @@ void suble_flash_erase(uint32_t addr, uint32_t num);
 
 /* suble_timer
  **************************************************/
-void suble_timer_handler(ke_msg_id_t timer_id);
-void suble_timer_start_0(ke_msg_id_t const timer_id, uint32_t ms, uint32_t count);
-void suble_timer_stop_0(ke_msg_id_t const timer_id);
-bool suble_timer_is_running(ke_msg_id_t const timer_id);
+void suble_timer_handler(void);
+void suble_timer_start_0(suble_timer_t* timer, uint32_t ms, uint32_t count);
+void suble_timer_stop_0(suble_timer_t* timer);
+bool suble_timer_is_running(suble_timer_t* timer);
 
 uint32_t suble_timer_create(void** p_timer_id, uint32_t timeout_value_ms, suble_timer_mode_t mode, suble_timer_handler_t timeout_handler);
 uint32_t suble_timer_delete(void* timer_id);
@@ -457,14 +502,15 @@ uint32_t suble_get_app_timestamp_when_update(void);
 uint32_t suble_get_local_timestamp(void);
 uint32_t suble_get_timestamp(void);
 uint32_t suble_get_old_timestamp(uint32_t old_local_timestamp);
+uint32_t suble_get_timestamp_with_ms(uint16_t* ms);
+void suble_wdt_wake_start(void);
 
 void suble_delay_ms(uint32_t ms);
 void suble_delay_us(uint32_t us);
 
 /* suble_key
  **************************************************/
-void suble_key_timeout_handler(void);
-void suble_key_clear_s_key_press_count(void);
+void suble_key_edge_handler(void);
 
 void suble_gpio_open_with_common_pwd(uint8_t hardid, uint16_t slaveid);
 void suble_gpio_open_with_tmp_pwd(uint8_t hardid, uint16_t slaveid);
@@ -474,11 +520,16 @@ void set_s_master_scan_is_running(void);
  **************************************************/
 void suble_battery_init(void);
 void suble_battery_sample_start(void);
-void suble_battery_get_value_outtime_handler(void);
+
+/* suble_rand
+ **************************************************/
+void suble_rand_init(void);
+void suble_rand_seed(const uint8_t* seed, uint32_t len);
+void suble_rand_instantiate(const uint8_t* seed, uint32_t len);
+void suble_rand_bytes(uint8_t* buf, uint32_t size);
 
 /* suble_music
  **************************************************/
-void suble_buzzer_timeout_handler(void);
 void lock_play_music(uint8_t mode, uint32_t music_idx);
 void lock_play_music_cancel(void);
 uint32_t lock_music_maxnum(uint32_t music_idx);
@@ -1,4 +1,5 @@
 #include "suble_common.h"
+#include "tuya_ble_gatt_send_queue.h"
 
 
 
@@ -38,6 +39,7 @@ static suble_connect_result_handler_t suble_connect_result_handler;
 /*********************************************************************
  * LOCAL FUNCTION
  */
+static void suble_gap_link_window_handler(void* timer);
 
 
 
@@ -70,8 +72,9 @@ void suble_gap_disconnect_for_tuya_ble_sdk(void)
 
 /*********************************************************
 FN: 
+RT: SUBLE_SUCCESS - the request is sent to the central
 */
-void suble_gap_conn_param_update(uint16_t condix, uint16_t cMin, uint16_t cMax, uint16_t latency, uint16_t timeout)
+uint32_t suble_gap_conn_param_update(uint16_t condix, uint16_t cMin, uint16_t cMax, uint16_t latency, uint16_t timeout)
 {
 	struct gapc_conn_param  up_param;
 	up_param.intv_min   = (cMin*4)/5;
@@ -79,7 +82,10 @@ void suble_gap_conn_param_update(uint16_t condix, uint16_t cMin, uint16_t cMax,
 	up_param.latency    = latency;
 	up_param.time_out   = timeout/10;
 //	appm_update_param(&up_param);
-    appc_update_param(condix, up_param.intv_min, up_param.intv_max, up_param.latency, up_param.time_out);
+    if(appc_update_param(condix, up_param.intv_min, up_param.intv_max, up_param.latency, up_param.time_out) != GAP_ERR_NO_ERROR) {
+        return SUBLE_ERROR_COMMON;
+    }
+    return SUBLE_SUCCESS;
 }
 
 /*********************************************************
@@ -131,6 +137,7 @@ FN:
 */
 void suble_gap_conn_handler(void)
 {
+    suble_gap_link_start();
     tuya_ble_app_evt_send(APP_EVT_CONNECTED);
 }
 
@@ -139,6 +146,9 @@ FN:
 */
 void suble_gap_disconn_handler(void)
 {
+    tuya_ble_aes128_cbc_cache_clear();
+    suble_svc_notify_reset();
+    suble_gap_link_stop();
     tuya_ble_app_evt_send(APP_EVT_DISCONNECTED);
 }
 
@@ -155,6 +165,7 @@ FN:
 */
 void suble_gap_master_disconn_handler(void)
 {
+    tuya_ble_aes128_cbc_cache_clear();
     suble_connect_result_handler(SUBLE_GAP_EVT_DISCONNECTED, NULL, 0);
 }
 
@@ -169,6 +180,246 @@ void suble_gap_master_connect_timeout_handler(void)
 
 
 
+/*********************************************************  link policy  *********************************************************/
+
+/*********************************************************************
+ * LOCAL CONSTANT
+ */
+//bulk transfers, short interval and no latency
+#define LINK_BULK_INTERVAL_MIN      15
+#define LINK_BULK_INTERVAL_MAX      30
+#define LINK_BULK_LATENCY           0
+//idle, long interval, the slave skips connection events it has nothing for
+#define LINK_IDLE_INTERVAL_MIN      SUBLE_CONN_INTERVAL_MIN
+#define LINK_IDLE_INTERVAL_MAX      SUBLE_CONN_INTERVAL_MAX
+#define LINK_IDLE_LATENCY           3
+//traffic is sampled once per window
+#define LINK_WINDOW_MS              1000
+//sub packages in one window, or frames waiting in the gatt send queue, that count as bulk
+#define LINK_BULK_PKG_NUM           8
+#define LINK_BULK_QUEUE_NUM         2
+//quiet windows before the link relaxes
+#define LINK_IDLE_WINDOW_NUM        5
+//an operation that moves no data for this many windows is not trusted any more
+#define LINK_OP_STALE_WINDOW_NUM    10
+//windows to wait before asking again after the central refused
+#define LINK_RETRY_WINDOW_NUM       30
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+typedef struct
+{
+    bool     connected;
+    uint8_t  mode;              //accepted by the central
+    uint8_t  requested;         //asked for, valid while pending
+    bool     pending;
+    uint8_t  ops;               //suble_link_op_t bits
+    uint16_t pkg_num;           //sub packages in and out in this window
+    uint8_t  quiet_windows;
+    uint8_t  stale_windows;
+    uint8_t  retry_windows;
+} suble_link_t;
+
+/*********************************************************************
+ * LOCAL VARIABLE
+ */
+static suble_link_t s_link;
+static suble_timer_t s_link_timer = SUBLE_TIMER_DEF(suble_gap_link_window_handler);
+
+
+
+
+/*********************************************************
+FN: ask the central for the parameters of the mode
+*/
+static void suble_gap_link_request(uint8_t mode)
+{
+    uint32_t ret;
+
+    if(mode == SUBLE_LINK_MODE_BULK) {
+        ret = suble_gap_conn_param_update(g_conn_info[0].condix, LINK_BULK_INTERVAL_MIN, LINK_BULK_INTERVAL_MAX, LINK_BULK_LATENCY, SUBLE_CONN_SUP_TIMEOUT);
+    } else {
+        ret = suble_gap_conn_param_update(g_conn_info[0].condix, LINK_IDLE_INTERVAL_MIN, LINK_IDLE_INTERVAL_MAX, LINK_IDLE_LATENCY, SUBLE_CONN_SUP_TIMEOUT);
+    }
+    //not sent, no answer will come, asked again on a later evaluation
+    if(ret != SUBLE_SUCCESS) {
+        return;
+    }
+    s_link.requested = mode;
+    s_link.pending = true;
+}
+
+/*********************************************************
+FN: the mode the parameters in use fall into
+PM: interval - in 1.25ms units
+*/
+static uint8_t suble_gap_link_mode_of(uint16_t interval, uint16_t latency)
+{
+    if((interval <= (LINK_BULK_INTERVAL_MAX*4)/5) && (latency == LINK_BULK_LATENCY)) {
+        return SUBLE_LINK_MODE_BULK;
+    }
+    if(interval >= (LINK_IDLE_INTERVAL_MIN*4)/5) {
+        return SUBLE_LINK_MODE_IDLE;
+    }
+    return SUBLE_LINK_MODE_NONE;
+}
+
+/*********************************************************
+FN: pick the mode from the operations and the traffic
+    bulk is asked for at once, idle only after some quiet windows
+*/
+static void suble_gap_link_evaluate(bool window_end)
+{
+    bool bulk;
+    uint8_t mode;
+
+    if(!s_link.connected) {
+        return;
+    }
+
+    bulk = (s_link.pkg_num >= LINK_BULK_PKG_NUM)
+        || (tuya_ble_gatt_send_queue_used() >= LINK_BULK_QUEUE_NUM)
+        || ((s_link.ops != 0) && (s_link.stale_windows < LINK_OP_STALE_WINDOW_NUM));
+
+    if(window_end) {
+        if(bulk) {
+            s_link.quiet_windows = 0;
+        } else if(s_link.quiet_windows < LINK_IDLE_WINDOW_NUM) {
+            s_link.quiet_windows++;
+        }
+        if(s_link.pkg_num != 0) {
+            s_link.stale_windows = 0;
+        } else if(s_link.stale_windows < LINK_OP_STALE_WINDOW_NUM) {
+            s_link.stale_windows++;
+        }
+        if(s_link.retry_windows > 0) {
+            s_link.retry_windows--;
+        }
+        s_link.pkg_num = 0;
+    }
+
+    if(bulk) {
+        mode = SUBLE_LINK_MODE_BULK;
+    } else if(s_link.quiet_windows >= LINK_IDLE_WINDOW_NUM) {
+        mode = SUBLE_LINK_MODE_IDLE;
+    } else {
+        return;
+    }
+
+    if((mode != s_link.mode) && (!s_link.pending) && (s_link.retry_windows == 0)) {
+        suble_gap_link_request(mode);
+    }
+}
+
+/*********************************************************
+FN:
+*/
+static void suble_gap_link_window_handler(void* timer)
+{
+    suble_gap_link_evaluate(true);
+}
+
+/*********************************************************
+FN: slave link up, the central picked the first parameters
+*/
+void suble_gap_link_start(void)
+{
+    memset(&s_link, 0, sizeof(s_link));
+    s_link.connected = true;
+    s_link.mode = SUBLE_LINK_MODE_NONE;
+    suble_timer_start_0(&s_link_timer, LINK_WINDOW_MS, SUBLE_TIMER_COUNT_ENDLESS);
+}
+
+/*********************************************************
+FN:
+*/
+void suble_gap_link_stop(void)
+{
+    suble_timer_stop_0(&s_link_timer);
+    memset(&s_link, 0, sizeof(s_link));
+}
+
+/*********************************************************
+FN: a bulk operation starts, e.g. ota, keeps the link fast until it ends
+*/
+void suble_gap_link_op_begin(suble_link_op_t op)
+{
+    s_link.ops |= op;
+    s_link.stale_windows = 0;
+    suble_gap_link_evaluate(false);
+}
+
+/*********************************************************
+FN:
+*/
+void suble_gap_link_op_end(suble_link_op_t op)
+{
+    s_link.ops &= ~op;
+}
+
+/*********************************************************
+FN: the app is done with its setup, e.g. after bonding, the link may go idle
+    without waiting for the quiet windows, bulk needs still win
+*/
+void suble_gap_link_relax(void)
+{
+    if(!s_link.connected) {
+        return;
+    }
+    s_link.quiet_windows = LINK_IDLE_WINDOW_NUM;
+    suble_gap_link_evaluate(false);
+}
+
+/*********************************************************
+FN: one sub package in or out on the slave link
+*/
+void suble_gap_link_traffic(void)
+{
+    s_link.pkg_num++;
+    if(s_link.pkg_num == LINK_BULK_PKG_NUM) {
+        suble_gap_link_evaluate(false);
+    }
+}
+
+/*********************************************************
+FN: the central answered the parameter request
+*/
+void suble_gap_link_param_result(uint16_t condix, bool accepted)
+{
+    if((!s_link.connected) || (condix != g_conn_info[0].condix) || (!s_link.pending)) {
+        return;
+    }
+
+    s_link.pending = false;
+    if(accepted) {
+        s_link.mode = s_link.requested;
+    } else {
+        //some centrals refuse every request, don't keep asking
+        s_link.retry_windows = LINK_RETRY_WINDOW_NUM;
+    }
+}
+
+/*********************************************************
+FN: new parameters in use, after our request or picked by the central
+PM: interval - in 1.25ms units
+*/
+void suble_gap_link_param_updated(uint16_t condix, uint16_t interval, uint16_t latency)
+{
+    if((!s_link.connected) || (condix != g_conn_info[0].condix)) {
+        return;
+    }
+
+    s_link.mode = suble_gap_link_mode_of(interval, latency);
+    if(!s_link.pending) {
+        //the central's own choice, don't ask back at once
+        s_link.retry_windows = LINK_RETRY_WINDOW_NUM;
+    }
+}
+
+
+
+
 
 
 
@@ -1,4 +1,5 @@
 #include "suble_common.h"
+#include "ll.h"
 
 
 
@@ -37,6 +38,8 @@ static uint8_t suble_out_pin_num = sizeof(suble_out_pin_array)/sizeof(suble_out_
 static void suble_gpio_int_config(uint8_t* gpio_array, uint8_t len);
 static void suble_gpio_irq_handler(uint32_t pin);
 static uint32_t suble_gpio_irq_pin_change_format(uint32_t pin);
+static void suble_gpio_rled_blink_handler(void* timer);
+static void suble_gpio_rled_period_blink_handler(void* timer);
 
 
 
@@ -151,14 +154,37 @@ static void suble_gpio_irq_handler(uint32_t pin)
 //            if(suble_gpio_get_input(pin) == SUBLE_LEVEL_LOW)
             {
 //                SUBLE_PRINTF("ANTILOCK_BUTTON_PIN");
-                suble_timer_start_0(SUBLE_TIMER100, 10, SUBLE_TIMER_COUNT_ENDLESS);
+                suble_key_edge_handler();
             }
         } break;
         
         default: {
         } break;
     }
-    suble_gpio_int_config(s_suble_gpio_irq_array, sizeof(s_suble_gpio_irq_array));
+    for(uint8_t i=0; i<sizeof(s_suble_gpio_irq_array); i++) {
+        suble_gpio_irq_rearm(s_suble_gpio_irq_array[i]);
+    }
+}
+
+/*********************************************************
+FN: wait for the edge that leaves the current level, so that
+    both the press and the release interrupt
+*/
+void suble_gpio_irq_rearm(uint8_t pin)
+{
+    uint32_t bit = 1<<(8*(pin>>4)+(pin&0x0f));
+
+    GLOBAL_INT_DISABLE();
+    if(suble_gpio_get_input(pin) == SUBLE_LEVEL_LOW) {
+        REG_APB5_GPIO_WUATOD_TYPE &= ~bit;
+    } else {
+        REG_APB5_GPIO_WUATOD_TYPE |= bit;
+    }
+    REG_APB5_GPIO_WUATOD_STAT = bit;
+    REG_APB5_GPIO_WUATOD_ENABLE |= bit;
+    REG_AHB0_ICU_DEEP_SLEEP0 |= bit;
+    REG_AHB0_ICU_INT_ENABLE |= (0x01 << 9);
+    GLOBAL_INT_RESTORE();
 }
 
 /*********************************************************
@@ -285,6 +311,9 @@ void suble_gpio_led_off(uint8_t pin)
     suble_gpio_set(pin, SUBLE_LEVEL_HIGH);
 }
 
+static suble_timer_t s_rled_blink_timer = SUBLE_TIMER_DEF(suble_gpio_rled_blink_handler);
+static suble_timer_t s_rled_period_blink_timer = SUBLE_TIMER_DEF(suble_gpio_rled_period_blink_handler);
+
 /*********************************************************
 FN: 
 */
@@ -293,13 +322,29 @@ void suble_gpio_led_reverse(uint8_t pin)
     suble_gpio_reverse(pin);
 }
 
+/*********************************************************
+FN: 
+*/
+static void suble_gpio_rled_blink_handler(void* timer)
+{
+    suble_gpio_led_reverse(ANTILOCK_LED_RED_PIN);
+}
+
+/*********************************************************
+FN: one blink per period
+*/
+static void suble_gpio_rled_period_blink_handler(void* timer)
+{
+    suble_gpio_rled_blink(1, 100);
+}
+
 /*********************************************************
 FN: 
 */
 void suble_gpio_rled_blink(uint32_t count, uint32_t ms)
 {
     suble_gpio_led_off(ANTILOCK_LED_RED_PIN);
-    suble_timer_start_0(SUBLE_TIMER102, ms, count*2);
+    suble_timer_start_0(&s_rled_blink_timer, ms, count*2);
 }
 
 /*********************************************************
@@ -308,7 +353,7 @@ FN:
 void suble_gpio_rled_blink_cancel(void)
 {
     suble_gpio_led_off(ANTILOCK_LED_RED_PIN);
-    suble_timer_stop_0(SUBLE_TIMER102);
+    suble_timer_stop_0(&s_rled_blink_timer);
 }
 
 /*********************************************************
@@ -316,7 +361,7 @@ FN:
 */
 void suble_gpio_rled_period_blink(uint32_t count, uint32_t ms)
 {
-    suble_timer_start_0(SUBLE_TIMER105, ms, count*2);
+    suble_timer_start_0(&s_rled_period_blink_timer, ms, count*2);
 }
 
 /*********************************************************
@@ -324,7 +369,7 @@ FN:
 */
 void suble_gpio_rled_period_blink_cancel(void)
 {
-    suble_timer_stop_0(SUBLE_TIMER105);
+    suble_timer_stop_0(&s_rled_period_blink_timer);
 }
 
 
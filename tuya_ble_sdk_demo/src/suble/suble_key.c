@@ -1,4 +1,5 @@
 #include "suble_common.h"
+#include "lld_evt.h"
 #include "lock_timer.h"
 #include "tuya_ble_master_port.h"
 
@@ -25,6 +26,8 @@
  * LOCAL FUNCTION
  */
 static void tmp_key_handler(tuya_ble_master_operation_t operation);
+static void suble_key_debounce_handler(void* timer);
+static void suble_key_click_timeout_handler(void* timer);
 
 
 
@@ -38,9 +41,14 @@ FN:
 /*********************************************************************
  * LOCAL CONSTANTS
  */
-#define KEY_COUNT_1  (4/1)
-#define KEY_COUNT_2  (300/1)
-#define KEY_COUNT_3  (1000/1)
+//press time in ms, pressed, long pressed and released by timeout
+#define KEY_TIME_1          40
+#define KEY_TIME_2          3000
+#define KEY_TIME_3          10000
+//the level has to stay this long after the last edge
+#define KEY_DEBOUNCE_MS     20
+#define KEY_VALID_LEVEL     SUBLE_LEVEL_LOW
+#define KEY_SLOT_CLOCK_MASK 0x07FFFFFF
 
 enum
 {
@@ -61,6 +69,13 @@ enum
  * LOCAL VARIABLES
  */
 static uint32_t s_key_press_count = 0;
+static uint32_t s_key_press_slot = 0;      //slot clock when the press was debounced
+static bool     s_key_pressed = false;     //debounced level
+static int      s_key_state = KEY_STATE_READY;
+//debounce after an edge, then the next long press threshold while the button is down
+static suble_timer_t s_key_debounce_timer = SUBLE_TIMER_DEF(suble_key_debounce_handler);
+//window for a second click
+static suble_timer_t s_key_click_timer = SUBLE_TIMER_DEF(suble_key_click_timeout_handler);
 
 
 
@@ -86,11 +101,11 @@ static void suble_key_state_handler(uint8_t state)
         case KEY_STATE_RELEASE_1: {
             if(s_key_press_count < 1) {
                 s_key_press_count++;
-                suble_timer_start_0(SUBLE_TIMER101, 500, 1);
+                suble_timer_start_0(&s_key_click_timer, 500, 1);
             }
             else {
                 s_key_press_count = 0;
-                suble_timer_stop_0(SUBLE_TIMER101);
+                suble_timer_stop_0(&s_key_click_timer);
                 
                 //˫
                 SUBLE_PRINTF("hit 2");
@@ -104,96 +119,85 @@ static void suble_key_state_handler(uint8_t state)
 }
 
 /*********************************************************
-FN: ʱ
+FN: ms the button is down, counted from the debounced press
+    the press and the release are both seen one debounce late
 */
-void suble_key_timeout_handler(void)
+static uint32_t suble_key_press_time(void)
 {
-    #define SUBLE_KEY_TIME      5
-    #define SUBLE_VALID_LEVEL   SUBLE_LEVEL_LOW
-    static uint8_t  key_log[SUBLE_KEY_TIME];
-    static uint32_t key_log_idx = 0;
-    uint32_t key_log_sum = 0;
-    static uint32_t key_count   = 0;
-    static bool     key_pressed = true;
-    static int      key_state   = KEY_STATE_READY;
-    
-    //
-    key_count++;
-    //м
-    key_log_idx++;
-    if(key_log_idx == SUBLE_KEY_TIME)
-    {
-        key_log_idx = 0;
-    }
-    
-    //¼ǰ10ε״̬
-    if(suble_gpio_get_input(ANTILOCK_BUTTON_PIN) == SUBLE_VALID_LEVEL) {
-        key_log[key_log_idx] = 0;
-    } else {
-        key_log[key_log_idx] = 1;
-    }
-    //ͳǰ10ε״̬
-    for(uint8_t idx=0; idx<SUBLE_KEY_TIME; idx++) {
-        key_log_sum += key_log[idx];
+    return (((lld_evt_time_get() - s_key_press_slot) & KEY_SLOT_CLOCK_MASK) * 5 / 8);
+}
+
+/*********************************************************
+FN: the level is stable, the press is classified by its duration
+    while the button is down the timer only wakes up at the next threshold
+*/
+static void suble_key_debounce_handler(void* timer)
+{
+    bool pressed = (suble_gpio_get_input(ANTILOCK_BUTTON_PIN) == KEY_VALID_LEVEL);
+    uint32_t press_time;
+
+    //an edge may have come while the edge type was switched
+    suble_gpio_irq_rearm(ANTILOCK_BUTTON_PIN);
+
+    if(pressed && !s_key_pressed) {
+        s_key_pressed = true;
+        s_key_press_slot = lld_evt_time_get();
+        s_key_state = KEY_STATE_READY;
+        suble_timer_start_0(&s_key_debounce_timer, KEY_TIME_1 - KEY_DEBOUNCE_MS, 1);
+        return;
     }
-    //Ч7
-    if(key_log_sum > 4) {
-        key_pressed = false;
-        memset(key_log, 0, SUBLE_KEY_TIME);
+    if(!s_key_pressed) {
+        return;
     }
-    
-//    SUBLE_PRINTF(": %d\r\n", key_pressed);
-    if(key_pressed == true)
-    {
-        if(key_count == KEY_COUNT_1) {
-            if(key_state == KEY_STATE_READY) {
-                key_state = KEY_STATE_PRESSED_1;
-                suble_key_state_handler(key_state);
-            }
+
+    press_time = suble_key_press_time() + KEY_DEBOUNCE_MS;
+
+    if(pressed) {
+        if((s_key_state == KEY_STATE_READY) && (press_time >= KEY_TIME_1)) {
+            s_key_state = KEY_STATE_PRESSED_1;
+            suble_key_state_handler(s_key_state);
         }
-        else if(key_count == KEY_COUNT_2) {
-            if(key_state == KEY_STATE_PRESSED_1) {
-                key_state = KEY_STATE_PRESSED_2;
-                suble_key_state_handler(key_state);
-            }
+        if((s_key_state == KEY_STATE_PRESSED_1) && (press_time >= KEY_TIME_2)) {
+            s_key_state = KEY_STATE_PRESSED_2;
+            suble_key_state_handler(s_key_state);
         }
-        else if(key_count == KEY_COUNT_3) {
-            if(key_state == KEY_STATE_PRESSED_2) {
-                //ʱͷ
-                key_state = KEY_STATE_RELEASE;
-            }
+        if((s_key_state == KEY_STATE_PRESSED_2) && (press_time >= KEY_TIME_3)) {
+            //ʱͷ, the key is done until the next press
+            suble_key_state_handler(KEY_STATE_RELEASE);
+            s_key_pressed = false;
+            s_key_state = KEY_STATE_READY;
+            return;
         }
-    }
-    else {
-        if(key_count <= KEY_COUNT_1) {
-            if(key_state == KEY_STATE_READY) {
-                key_state = KEY_STATE_RELEASE_0;
-            }
+
+        if(s_key_state == KEY_STATE_READY) {
+            suble_timer_start_0(&s_key_debounce_timer, KEY_TIME_1 - press_time, 1);
         }
-        else if((key_count > KEY_COUNT_1) && (key_count <= KEY_COUNT_2)) {
-            if(key_state == KEY_STATE_PRESSED_1) {
-                key_state = KEY_STATE_RELEASE_1;
-            }
+        else if(s_key_state == KEY_STATE_PRESSED_1) {
+            suble_timer_start_0(&s_key_debounce_timer, KEY_TIME_2 - press_time, 1);
         }
-        else if((key_count > KEY_COUNT_2) && (key_count <= KEY_COUNT_3)) {
-            if(key_state == KEY_STATE_PRESSED_2) {
-                key_state = KEY_STATE_RELEASE_2;
-            }
+        else if(s_key_state == KEY_STATE_PRESSED_2) {
+            suble_timer_start_0(&s_key_debounce_timer, KEY_TIME_3 - press_time, 1);
         }
+        return;
     }
-    
-    //ͷ
-    if(key_state >= KEY_STATE_RELEASE) {
-        suble_key_state_handler(key_state);
-        
-        key_count = 0;
-        key_pressed = true;
-        key_state = KEY_STATE_READY;
-        suble_timer_stop_0(SUBLE_TIMER100);
+
+    //ͷ, only the state reported while the button was down is released
+    //a threshold that bounces kept from being reported gives no release
+    press_time -= KEY_DEBOUNCE_MS;
+    if((s_key_state == KEY_STATE_READY) && (press_time < KEY_TIME_1)) {
+        suble_key_state_handler(KEY_STATE_RELEASE_0);
     }
+    else if((s_key_state == KEY_STATE_PRESSED_1) && (press_time <= KEY_TIME_2)) {
+        suble_key_state_handler(KEY_STATE_RELEASE_1);
+    }
+    else if((s_key_state == KEY_STATE_PRESSED_2) && (press_time < KEY_TIME_3)) {
+        suble_key_state_handler(KEY_STATE_RELEASE_2);
+    }
+    s_key_pressed = false;
+    s_key_state = KEY_STATE_READY;
 }
 
-void suble_key_clear_s_key_press_count(void)
+static void suble_key_click_timeout_handler(void* timer)
 {
     if(s_key_press_count == 1) {
         SUBLE_PRINTF("hit 1");
@@ -203,6 +207,16 @@ void suble_key_clear_s_key_press_count(void)
     s_key_press_count = 0;
 }
 
+/*********************************************************
+FN: button edge interrupt, every edge pushes the debounce back
+    a pending long press threshold is checked again after the debounce
+*/
+void suble_key_edge_handler(void)
+{
+    suble_timer_start_0(&s_key_debounce_timer, KEY_DEBOUNCE_MS, 1);
+}
+
+
 
 
 
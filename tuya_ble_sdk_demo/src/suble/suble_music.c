@@ -277,14 +277,17 @@ static uint8_t s_music_mode = MUSIC_MODE_ONCE;
 /*********************************************************************
  * LOCAL FUNCTION
  */
+static void suble_buzzer_timeout_handler(void* timer);
 
 
 
 
+static suble_timer_t s_tune_timer = SUBLE_TIMER_DEF(suble_buzzer_timeout_handler);
+
 /*********************************************************
 FN: 
 */
-void suble_buzzer_timeout_handler(void)
+static void suble_buzzer_timeout_handler(void* timer)
 {
     s_tune_idx++;
     if(s_tune_idx < music[s_music_idx].size) {
@@ -296,11 +299,11 @@ void suble_buzzer_timeout_handler(void)
         
         suble_buzzer_start(tune*10);
         if(s_music_mode == MUSIC_MODE_ONCE) {
-            suble_timer_start_0(SUBLE_TIMER104, (100*durt), 1);
+            suble_timer_start_0(&s_tune_timer, (100*durt), 1);
 //            APP_DEBUG_PRINTF("count: %d, delay: %d", s_tune_idx, (100*durt));
         }
         else {
-            suble_timer_start_0(SUBLE_TIMER104, (500*durt), 1);
+            suble_timer_start_0(&s_tune_timer, (500*durt), 1);
 //            APP_DEBUG_PRINTF("count: %d, delay: %d", s_tune_idx, (500*durt));
         }
     }
@@ -341,11 +344,11 @@ void lock_play_music(uint8_t mode, uint32_t music_idx)
         
         suble_buzzer_start(tune*10);
         if(s_music_mode == MUSIC_MODE_ONCE) {
-            suble_timer_start_0(SUBLE_TIMER104, (100*durt), 1);
+            suble_timer_start_0(&s_tune_timer, (100*durt), 1);
 //            APP_DEBUG_PRINTF("count: %d, delay: %d", s_tune_idx, (100*durt));
         }
         else {
-            suble_timer_start_0(SUBLE_TIMER104, (500*durt), 1);
+            suble_timer_start_0(&s_tune_timer, (500*durt), 1);
 //            APP_DEBUG_PRINTF("count: %d, delay: %d", s_tune_idx, (500*durt));
         }
     }
@@ -0,0 +1,163 @@
+#include "suble_common.h"
+#include "lld_evt.h"
+#include "aes.h"
+
+
+
+
+/*********************************************************************
+ * LOCAL CONSTANT
+ */
+//AES-128 CTR DRBG without derivation function, state is key and counter
+#define RAND_BLOCK_LEN          16
+#define RAND_SEED_LEN           (RAND_BLOCK_LEN*2)
+//noise samples folded into the state at boot
+#define RAND_NOISE_SAMPLE_NUM   64
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+
+/*********************************************************************
+ * LOCAL VARIABLE
+ */
+static mbedtls_aes_context s_rand_aes;
+static uint8_t s_rand_v[RAND_BLOCK_LEN];
+static bool s_rand_seeded = false;
+
+/*********************************************************************
+ * VARIABLE
+ */
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+
+
+
+
+/*********************************************************
+FN:
+*/
+static void suble_rand_v_increase(void)
+{
+    for(int32_t idx=RAND_BLOCK_LEN-1; idx>=0; idx--) {
+        if(++s_rand_v[idx] != 0) {
+            break;
+        }
+    }
+}
+
+/*********************************************************
+FN: new key and counter from the next two key stream blocks, xored with provided
+*/
+static void suble_rand_update(const uint8_t* provided)
+{
+    uint8_t temp[RAND_SEED_LEN];
+
+    suble_rand_v_increase();
+    mbedtls_aes_crypt_ecb(&s_rand_aes, MBEDTLS_AES_ENCRYPT, s_rand_v, &temp[0]);
+    suble_rand_v_increase();
+    mbedtls_aes_crypt_ecb(&s_rand_aes, MBEDTLS_AES_ENCRYPT, s_rand_v, &temp[RAND_BLOCK_LEN]);
+
+    if(provided != NULL) {
+        for(uint32_t idx=0; idx<RAND_SEED_LEN; idx++) {
+            temp[idx] ^= provided[idx];
+        }
+    }
+
+    mbedtls_aes_setkey_enc(&s_rand_aes, &temp[0], 128);
+    memcpy(s_rand_v, &temp[RAND_BLOCK_LEN], RAND_BLOCK_LEN);
+    memset(temp, 0, sizeof(temp));
+}
+
+/*********************************************************
+FN: reseed, mix seed material into the current state, so the output depends
+    on every seed passed since the last suble_rand_instantiate()
+    any length, before any instantiate it starts from the zero state
+*/
+void suble_rand_seed(const uint8_t* seed, uint32_t len)
+{
+    uint8_t provided[RAND_SEED_LEN];
+
+    if(!s_rand_seeded) {
+        memset(provided, 0, sizeof(provided));
+        mbedtls_aes_init(&s_rand_aes);
+        mbedtls_aes_setkey_enc(&s_rand_aes, provided, 128);
+        memset(s_rand_v, 0, RAND_BLOCK_LEN);
+        s_rand_seeded = true;
+    }
+
+    do {
+        uint32_t use_len = (len > RAND_SEED_LEN) ? RAND_SEED_LEN : len;
+        memset(provided, 0, sizeof(provided));
+        memcpy(provided, seed, use_len);
+        suble_rand_update(provided);
+        seed += use_len;
+        len -= use_len;
+    } while(len > 0);
+
+    memset(provided, 0, sizeof(provided));
+}
+
+/*********************************************************
+FN: drop the current state and start over from the zero state and seed only
+    the same seed gives the same output, e.g. a fixed seed for a reproducible
+    host run of the send path
+*/
+void suble_rand_instantiate(const uint8_t* seed, uint32_t len)
+{
+    s_rand_seeded = false;
+    suble_rand_seed(seed, len);
+}
+
+/*********************************************************
+FN: seed from the noise of the chip, called once the radio and the adc run
+    adc lsb of the battery channel, radio fine timer jitter between samples
+    and the bt mac so that boards booting the same way still differ
+*/
+void suble_rand_init(void)
+{
+    uint32_t noise[RAND_SEED_LEN/4];
+    uint32_t slot;
+    uint32_t fine;
+
+    memset(noise, 0, sizeof(noise));
+    suble_gap_get_bt_mac((void*)noise, sizeof(noise));
+    suble_rand_instantiate((void*)noise, SUBLE_BT_MAC_LEN);
+
+    for(uint32_t idx=0; idx<RAND_NOISE_SAMPLE_NUM; idx++) {
+        lld_evt_time_get_us(&slot, &fine);
+        noise[idx%(RAND_SEED_LEN/4)] ^= (adc_get_value() << 16) ^ (slot << 10) ^ fine;
+        if((idx%(RAND_SEED_LEN/4)) == (RAND_SEED_LEN/4 - 1)) {
+            suble_rand_seed((void*)noise, RAND_SEED_LEN);
+        }
+    }
+
+    memset(noise, 0, sizeof(noise));
+}
+
+/*********************************************************
+FN: one aes block per 16 bytes, then the state moves on so that
+    earlier output can not be recomputed from it
+*/
+void suble_rand_bytes(uint8_t* buf, uint32_t size)
+{
+    uint8_t block[RAND_BLOCK_LEN];
+
+    if(!s_rand_seeded) {
+        suble_rand_init();
+    }
+
+    while(size > 0) {
+        uint32_t use_len = (size > RAND_BLOCK_LEN) ? RAND_BLOCK_LEN : size;
+        suble_rand_v_increase();
+        mbedtls_aes_crypt_ecb(&s_rand_aes, MBEDTLS_AES_ENCRYPT, s_rand_v, block);
+        memcpy(buf, block, use_len);
+        buf += use_len;
+        size -= use_len;
+    }
+    suble_rand_update(NULL);
+
+    memset(block, 0, sizeof(block));
+}
@@ -1,4 +1,5 @@
 #include "suble_common.h"
+#include "tuya_ble_gatt_send_queue.h"
 
 
 
@@ -6,24 +7,16 @@
 /*********************************************************************
  * LOCAL CONSTANT
  */
-#define NOTIFY_QUEUE_MAX_NUM  128
 
 /*********************************************************************
  * LOCAL STRUCT
  */
-typedef struct
-{
-    uint32_t len;
-    uint8_t  value[20];
-} notify_data_t;
 
 /*********************************************************************
  * LOCAL VARIABLE
  */
-static notify_data_t notify_data[NOTIFY_QUEUE_MAX_NUM];
-static uint32_t s_start_idx = 0;
-static uint32_t s_end_idx = 0;
-static bool s_send_complete_flag = true;
+//notifies handed to the stack and not completed, the tuya gatt send queue keeps the rest
+static uint8_t s_send_in_flight = 0;
 
 static suble_svc_result_handler_t suble_svc_result_handler;
 
@@ -34,9 +27,6 @@ static suble_svc_result_handler_t suble_svc_result_handler;
 /*********************************************************************
  * LOCAL FUNCTION
  */
-static uint32_t suble_next_idx(uint32_t index);
-static uint32_t suble_queue_full(void);
-static uint32_t suble_queue_empty(void);
 static void suble_svc_send_data(uint8_t* buf, uint32_t size);
 
 
@@ -55,6 +45,7 @@ FN: 
 */
 void suble_svc_receive_data(uint8_t* buf, uint32_t len)
 {
+    suble_gap_link_traffic();
     tuya_ble_gatt_receive_data(buf, len);
 //    suble_svc_send_data(buf, len);
 //    SUBLE_HEXDUMP("Svc rx", buf, len);
@@ -73,60 +64,38 @@ FN: 
 */
 void suble_svc_send_data_complete(void)
 {
-    s_send_complete_flag = true;
-    s_start_idx = suble_next_idx(s_start_idx);
+    if(s_send_in_flight > 0) {
+        s_send_in_flight--;
+    }
+    //hand the next sub package over right away, not on the next main loop pass
+    tuya_ble_gatt_send_tx_complete();
 }
 
 
 
 
 /*********************************************************
-FN: 
+FN: hand one sub package to the stack, false while SUBLE_SVC_NOTIFY_DEPTH are in flight
+    the stack queues them, so the next one is ready when a connection event has room
 */
-static uint32_t suble_next_idx(uint32_t index)
-{
-    return (index < NOTIFY_QUEUE_MAX_NUM-1) ? (index + 1) : 0;
-}
-
-static uint32_t suble_queue_full(void)
+bool suble_svc_notify(uint8_t* buf, uint32_t size)
 {
-    uint32_t tmp = s_start_idx;
-    return suble_next_idx(s_end_idx) == tmp;
-}
-
-static uint32_t suble_queue_empty(void)
-{
-    uint32_t tmp = s_start_idx;
-    return s_end_idx == tmp;
-}
-
-/*********************************************************
-FN: 
-*/
-void suble_svc_notify(uint8_t* buf, uint32_t size)
-{
-    if(!suble_queue_full()) {
-        notify_data[s_end_idx].len = size;
-        memcpy(notify_data[s_end_idx].value, buf, size);
-
-        s_end_idx = suble_next_idx(s_end_idx);
-    }
-    else {
-        SUBLE_PRINTF("suble_svc_notify: suble_queue is full");
+    if(s_send_in_flight >= SUBLE_SVC_NOTIFY_DEPTH) {
+        return false;
     }
+    
+    s_send_in_flight++;
+    suble_svc_send_data(buf, size);
+    suble_gap_link_traffic();
+    return true;
 }
 
 /*********************************************************
-FN: 
+FN: a notify still in flight at disconnect never completes
 */
-void suble_svc_notify_handler(void)
+void suble_svc_notify_reset(void)
 {
-    if(!suble_queue_empty()) {
-        if(s_send_complete_flag) {
-            s_send_complete_flag = false;
-            suble_svc_send_data(notify_data[s_start_idx].value, notify_data[s_start_idx].len);
-        }
-    }
+    s_send_in_flight = 0;
 }
 
 
@@ -137,16 +106,34 @@ void suble_svc_notify_handler(void)
 /*********************************************************************
  * LOCAL CONSTANT
  */
+//one cached service layout per slave, keyed by mac
+#define SVC_C_CACHE_MAX_NUM     10
+//bump it when the layout of svc_c_cache_t or the slave service uuid changes
+#define SVC_C_CACHE_VERSION     0x02
 
 /*********************************************************************
  * LOCAL STRUCT
  */
+typedef struct
+{
+    uint8_t version;
+    uint8_t addr_type;
+    uint8_t mac[SUBLE_BT_MAC_LEN];
+    struct sdp_svc_cache svc;
+    uint16_t crc; //crc16 of all the fields above
+} svc_c_cache_t;
 
 /*********************************************************************
  * LOCAL VARIABLE
  */
 static suble_svc_result_handler_t suble_svc_result_handler;
 
+static uint8_t s_cache_mac[SVC_C_CACHE_MAX_NUM][SUBLE_BT_MAC_LEN];
+static bool    s_cache_loaded = false;
+static uint8_t s_cache_next_slot = 0;
+static bool    s_cache_restored = false; //the current link uses a cached layout
+static bool    s_cache_check_pending = false; //the ntf cfg write of the current link is not completed
+
 /*********************************************************************
  * VARIABLE
  */
@@ -195,6 +182,194 @@ void suble_db_discovery_start(suble_svc_result_handler_t handler)
     suble_svc_result_handler = handler;
 }
 
+/*********************************************************
+FN: 
+*/
+static uint16_t suble_svc_c_cache_crc(svc_c_cache_t* cache)
+{
+    return suble_util_crc16((void*)cache, offsetof(svc_c_cache_t, crc), NULL);
+}
+
+/*********************************************************
+FN: read a cache record, a torn or old format record is ignored
+*/
+static uint32_t suble_svc_c_cache_read(uint8_t slot, svc_c_cache_t* cache)
+{
+    if((sf_nv_read(SUBLE_SVC_C_CACHE_NV_AREA, SUBLE_SVC_C_CACHE_NV_ID+slot, cache, sizeof(svc_c_cache_t)) != SF_SUCCESS)
+        || (cache->version != SVC_C_CACHE_VERSION)
+        || (cache->crc != suble_svc_c_cache_crc(cache))) {
+        return SUBLE_ERROR_COMMON;
+    }
+    return SUBLE_SUCCESS;
+}
+
+/*********************************************************
+FN: load the mac of every cached slave, only once
+*/
+static void suble_svc_c_cache_load(void)
+{
+    if(s_cache_loaded) {
+        return;
+    }
+    
+    svc_c_cache_t cache;
+    for(uint8_t slot=0; slot<SVC_C_CACHE_MAX_NUM; slot++) {
+        memset(s_cache_mac[slot], 0, SUBLE_BT_MAC_LEN);
+        if(suble_svc_c_cache_read(slot, &cache) == SUBLE_SUCCESS) {
+            memcpy(s_cache_mac[slot], cache.mac, SUBLE_BT_MAC_LEN);
+        }
+    }
+    s_cache_loaded = true;
+}
+
+/*********************************************************
+FN: 
+RT: slot of the mac, SVC_C_CACHE_MAX_NUM - not found
+*/
+static uint8_t suble_svc_c_cache_find(uint8_t* mac)
+{
+    uint8_t empty_mac[SUBLE_BT_MAC_LEN] = {0};
+    
+    suble_svc_c_cache_load();
+    if(memcmp(mac, empty_mac, SUBLE_BT_MAC_LEN) == 0) {
+        return SVC_C_CACHE_MAX_NUM;
+    }
+    for(uint8_t slot=0; slot<SVC_C_CACHE_MAX_NUM; slot++) {
+        if(memcmp(s_cache_mac[slot], mac, SUBLE_BT_MAC_LEN) == 0) {
+            return slot;
+        }
+    }
+    return SVC_C_CACHE_MAX_NUM;
+}
+
+/*********************************************************
+FN: a slot for a new slave, an empty one first, the oldest saved one if all are used
+*/
+static uint8_t suble_svc_c_cache_new_slot(void)
+{
+    uint8_t empty_mac[SUBLE_BT_MAC_LEN] = {0};
+    uint8_t slot;
+    
+    for(slot=0; slot<SVC_C_CACHE_MAX_NUM; slot++) {
+        if(memcmp(s_cache_mac[slot], empty_mac, SUBLE_BT_MAC_LEN) == 0) {
+            return slot;
+        }
+    }
+    slot = s_cache_next_slot;
+    s_cache_next_slot = (s_cache_next_slot + 1) % SVC_C_CACHE_MAX_NUM;
+    return slot;
+}
+
+/*********************************************************
+FN: add the slave service from the cached layout instead of discovering it
+RT: SUBLE_SUCCESS - no discovery needed
+*/
+uint32_t suble_svc_c_cache_restore(uint8_t condix)
+{
+    uint8_t* mac = appc_env[condix]->con_dev_addr.addr.addr;
+    svc_c_cache_t cache;
+    
+    s_cache_restored = false;
+    
+    uint8_t slot = suble_svc_c_cache_find(mac);
+    if(slot == SVC_C_CACHE_MAX_NUM) {
+        return SUBLE_ERROR_COMMON;
+    }
+    //the layout belongs to this peer only, a random address may be reused by another device
+    if((suble_svc_c_cache_read(slot, &cache) != SUBLE_SUCCESS)
+        || (cache.addr_type != appc_env[condix]->con_dev_addr.addr_type)
+        || (memcmp(cache.mac, mac, SUBLE_BT_MAC_LEN) != 0)) {
+        return SUBLE_ERROR_COMMON;
+    }
+    if(sdp_restore_svc_info(condix, &cache.svc) != GAP_ERR_NO_ERROR) {
+        return SUBLE_ERROR_COMMON;
+    }
+    
+    SUBLE_HEXDUMP("svc_c cache hit", mac, SUBLE_BT_MAC_LEN);
+    s_cache_restored = true;
+    return SUBLE_SUCCESS;
+}
+
+/*********************************************************
+FN: 
+*/
+static void suble_svc_c_cache_save(uint8_t condix)
+{
+    uint8_t* mac = appc_env[condix]->con_dev_addr.addr.addr;
+    svc_c_cache_t cache;
+    
+    memset(&cache, 0, sizeof(svc_c_cache_t));
+    if(sdp_export_svc_info(condix, &cache.svc) != GAP_ERR_NO_ERROR) {
+        return;
+    }
+    cache.version = SVC_C_CACHE_VERSION;
+    cache.addr_type = appc_env[condix]->con_dev_addr.addr_type;
+    memcpy(cache.mac, mac, SUBLE_BT_MAC_LEN);
+    cache.crc = suble_svc_c_cache_crc(&cache);
+    
+    uint8_t slot = suble_svc_c_cache_find(mac);
+    if(slot == SVC_C_CACHE_MAX_NUM) {
+        slot = suble_svc_c_cache_new_slot();
+    }
+    if(sf_nv_write(SUBLE_SVC_C_CACHE_NV_AREA, SUBLE_SVC_C_CACHE_NV_ID+slot, &cache, sizeof(svc_c_cache_t)) == SF_SUCCESS) {
+        memcpy(s_cache_mac[slot], mac, SUBLE_BT_MAC_LEN);
+    }
+}
+
+/*********************************************************
+FN: 
+*/
+static void suble_svc_c_cache_delete(uint8_t condix)
+{
+    uint8_t slot = suble_svc_c_cache_find(appc_env[condix]->con_dev_addr.addr.addr);
+    if(slot != SVC_C_CACHE_MAX_NUM) {
+        sf_nv_delete(SUBLE_SVC_C_CACHE_NV_AREA, SUBLE_SVC_C_CACHE_NV_ID+slot);
+        memset(s_cache_mac[slot], 0, SUBLE_BT_MAC_LEN);
+    }
+}
+
+/*********************************************************
+FN: enable the notify of the slave, the last step of the service setup
+*/
+void suble_svc_c_ntf_cfg_enable(uint8_t condix)
+{
+    s_cache_check_pending = true;
+    appc_write_service_ntf_cfg_req(condix, appc_env[condix]->svc_notif_handle, 0x01);
+}
+
+/*********************************************************
+FN: result of a write to the slave
+PM: status - gattc_cmp_evt status
+RT: SUBLE_SUCCESS - the service is usable
+NT: ble 4.2 has no database hash, so a cached layout is validated by the
+    ntf cfg write, a failure drops it and the link is closed so that the
+    next connection discovers again. A discovered layout is saved once that
+    write succeeds. Data writes later on the link leave the cache alone.
+*/
+uint32_t suble_svc_c_cache_check(uint8_t condix, uint8_t status)
+{
+    if(!s_cache_check_pending) {
+        return SUBLE_SUCCESS;
+    }
+    s_cache_check_pending = false;
+    
+    if(s_cache_restored) {
+        s_cache_restored = false;
+        if(status != ATT_ERR_NO_ERROR) {
+            SUBLE_PRINTF("svc_c cache invalid, status: 0x%x", status);
+            suble_svc_c_cache_delete(condix);
+            appm_disconnect(condix);
+            return SUBLE_ERROR_COMMON;
+        }
+        return SUBLE_SUCCESS;
+    }
+    
+    if(status == ATT_ERR_NO_ERROR) {
+        suble_svc_c_cache_save(condix);
+    }
+    return SUBLE_SUCCESS;
+}
+
 /*********************************************************
 FN: 
 */
@@ -1,4 +1,7 @@
 #include "suble_common.h"
+#include "ll.h"
+#include "lld_evt.h"
+#include "tuya_ble_mem.h"
 
 
 
@@ -6,15 +9,49 @@
 /*********************************************************************
  * LOCAL CONSTANT
  */
+//one wheel tick is one kernel timer unit, 10ms or 16 ble slots of 625us
+#define WHEEL_TICK_SLOTS           16
+#define WHEEL_SLOT_CLOCK_MASK      0x07FFFFFF
+//level n slots span 32^n ticks, the wheel covers 32^4 ticks (2.9h), later deadlines are cascaded again
+#define WHEEL_LEVEL_BITS           5
+#define WHEEL_LEVEL_SIZE           (1UL<<WHEEL_LEVEL_BITS)
+#define WHEEL_LEVEL_MASK           (WHEEL_LEVEL_SIZE-1)
+#define WHEEL_LEVEL_NUM            4
+#define WHEEL_SPAN                 (1UL<<(WHEEL_LEVEL_BITS*WHEEL_LEVEL_NUM))
+//the slot clock wraps after 23h, the kernel timer is never armed further than 1h
+#define WHEEL_ARM_MAX_TICKS        (100*3600)
+
+#define WHEEL_IS_AFTER(a, b)       ((int32_t)((a) - (b)) > 0)
 
 /*********************************************************************
  * LOCAL STRUCT
  */
+typedef struct
+{
+    suble_timer_t* slot[WHEEL_LEVEL_NUM][WHEEL_LEVEL_SIZE];
+    uint32_t bitmap[WHEEL_LEVEL_NUM];
+    suble_timer_t* expired;     //timers of the processed tick, handlers not run yet
+    uint32_t pos;               //last processed tick
+    uint32_t clock;             //ticks of the slot clock since the first timer
+    uint32_t clock_slot;        //slot clock at the last whole tick
+    uint32_t armed;             //tick the kernel timer is armed for
+    bool     is_armed;
+    bool     is_busy;           //expiring, the kernel timer is armed when done
+    bool     is_init;
+} suble_timer_wheel_t;
+
+//an app timer, the timer comes first so that the handler gets the timer id
+typedef struct
+{
+    suble_timer_t timer;
+    uint32_t ms;
+    uint32_t count;
+} suble_timer_item_t;
 
 /*********************************************************************
  * LOCAL VARIABLE
  */
-static suble_timer_t s_suble_timer[SUBLE_TIMER_MAX-SUBLE_TIMER0] = {0};
+static suble_timer_wheel_t s_wheel;
 
 /*********************************************************************
  * VARIABLE
@@ -23,240 +60,391 @@ static suble_timer_t s_suble_timer[SUBLE_TIMER_MAX-SUBLE_TIMER0] = {0};
 /*********************************************************************
  * LOCAL FUNCTION
  */
-static void suble_timer_continue(ke_msg_id_t const timer_id);
-static void suble_timer_app_handler(uint32_t timer_id);
-static void suble_rtc_handler(void);
-
-
-
-
-/*********************************************************  suble_timer  *********************************************************/
-
-/*********************************************************
-FN: ʱ
-*/
-void suble_timer_handler(ke_msg_id_t timer_id)
-{
-    if((timer_id >= SUBLE_TIMER0) && (timer_id < SUBLE_TIMER100)) {
-        suble_timer_app_handler(timer_id);
-    }
-    else {
-        switch(timer_id)
-        {
-            case SUBLE_TIMER100: {
-                suble_key_timeout_handler();
-            } break;
-            
-            case SUBLE_TIMER101: {
-                suble_key_clear_s_key_press_count();
-            } break;
-            
-            case SUBLE_TIMER102: {
-                suble_gpio_led_reverse(ANTILOCK_LED_RED_PIN);
-            } break;
-            
-            case SUBLE_TIMER103: {
-                suble_battery_get_value_outtime_handler();
-            } break;
-            
-            case SUBLE_TIMER104: {
-                suble_buzzer_timeout_handler();
-            } break;
-            
-            case SUBLE_TIMER105: {
-                suble_gpio_rled_blink(1, 100);
-            } break;
-            
-            case SUBLE_TIMER106: {
-            } break;
-            
-            case SUBLE_TIMER107: {
-            } break;
-            
-            case SUBLE_TIMER108: {
-            } break;
-            
-            case SUBLE_TIMER109: {
-            } break;
-            
-            case SUBLE_TIMER200: {
-                suble_rtc_handler();
-            } break;
-            
-            default: {
-            } break;
-        }
+static void suble_rtc_handler(void* timer);
+static void suble_wdt_wake_handler(void* timer);
+
+
+
+
+/*********************************************************  suble_timer wheel  *********************************************************/
+
+/*********************************************************
+FN: index of the lowest set bit, value is not 0
+*/
+static uint32_t suble_timer_lowest_bit(uint32_t value)
+{
+#if defined(__CC_ARM)
+    return 31 - __clz(value & (0 - value));
+#else
+    return __builtin_ctz(value);
+#endif
+}
+
+/*********************************************************
+FN: move the wheel clock on by the whole ticks of the ble slot clock
+    the remainder stays in clock_slot, so the clock does not drift
+*/
+static uint32_t suble_timer_clock_update(void)
+{
+    uint32_t slot = lld_evt_time_get();
+    uint32_t ticks;
+
+    if(!s_wheel.is_init) {
+        s_wheel.clock_slot = slot;
+        s_wheel.is_init = true;
     }
-    suble_timer_continue(timer_id);
+
+    ticks = ((slot - s_wheel.clock_slot) & WHEEL_SLOT_CLOCK_MASK) / WHEEL_TICK_SLOTS;
+    s_wheel.clock_slot = (s_wheel.clock_slot + ticks*WHEEL_TICK_SLOTS) & WHEEL_SLOT_CLOCK_MASK;
+    s_wheel.clock += ticks;
+    return s_wheel.clock;
 }
 
 /*********************************************************
-FN: 
+FN: 
 */
-void suble_timer_start_0(ke_msg_id_t const timer_id, uint32_t ms, uint32_t count)
+static bool suble_timer_wheel_is_empty(void)
 {
-    if((timer_id < SUBLE_TIMER0) || (timer_id >= SUBLE_TIMER_MAX)) {
-        return;
+    uint32_t bits = 0;
+    for(uint32_t level=0; level<WHEEL_LEVEL_NUM; level++) {
+        bits |= s_wheel.bitmap[level];
     }
-    
-    uint32_t idx = timer_id - SUBLE_TIMER0;
-    s_suble_timer[idx].delay = ms/10;
-    s_suble_timer[idx].count = count;
-    ke_timer_set(timer_id, TASK_APPM, s_suble_timer[idx].delay);
+    return ((bits == 0) && (s_wheel.expired == NULL));
 }
 
 /*********************************************************
-FN: 
+FN: link the timer into the slot of its deadline, relative to the processed tick
 */
-static void suble_timer_continue(ke_msg_id_t const timer_id)
+static void suble_timer_wheel_insert(suble_timer_t* timer)
 {
-    if((timer_id < SUBLE_TIMER0) || (timer_id >= SUBLE_TIMER_MAX)) {
-        return;
+    uint32_t expires = timer->deadline;
+    uint32_t delta = expires - s_wheel.pos;
+    uint32_t level;
+    uint32_t idx;
+    suble_timer_t** head;
+
+    if(delta >= WHEEL_SPAN) {
+        //parked in the farthest slot and placed again when it is cascaded
+        delta = WHEEL_SPAN - 1;
+        expires = s_wheel.pos + delta;
     }
-    
-    uint32_t idx = timer_id-SUBLE_TIMER0;
-    //
-    if((s_suble_timer[idx].count != SUBLE_TIMER_COUNT_ENDLESS) && (s_suble_timer[idx].count > 0)) {
-        s_suble_timer[idx].count--;
+    for(level=0; level<WHEEL_LEVEL_NUM-1; level++) {
+        if(delta < (1UL << (WHEEL_LEVEL_BITS*(level+1)))) {
+            break;
+        }
     }
-    //
-    if(s_suble_timer[idx].count > 0) {
-        ke_timer_set(timer_id, TASK_APPM, s_suble_timer[idx].delay);
+    idx = (expires >> (WHEEL_LEVEL_BITS*level)) & WHEEL_LEVEL_MASK;
+
+    head = &s_wheel.slot[level][idx];
+    timer->next = *head;
+    if(*head != NULL) {
+        (*head)->pprev = &timer->next;
     }
+    *head = timer;
+    timer->pprev = head;
+    s_wheel.bitmap[level] |= (1UL << idx);
 }
 
 /*********************************************************
-FN: ֹͣ
+FN: unlink in O(1), the slot bit is cleared when the timer was the last one
 */
-void suble_timer_stop_0(ke_msg_id_t const timer_id)
+static void suble_timer_wheel_remove(suble_timer_t* timer)
 {
-    if((timer_id < SUBLE_TIMER0) || (timer_id >= SUBLE_TIMER_MAX)) {
-        return;
+    suble_timer_t** head = timer->pprev;
+
+    *head = timer->next;
+    if(timer->next != NULL) {
+        timer->next->pprev = head;
     }
-    
-    uint32_t idx = timer_id-SUBLE_TIMER0;
-    s_suble_timer[idx].count = 0;
-    s_suble_timer[idx].delay = 0;
-    ke_timer_clear(timer_id, TASK_APPM);
+    else if((head >= &s_wheel.slot[0][0]) && (head < &s_wheel.slot[0][0] + WHEEL_LEVEL_NUM*WHEEL_LEVEL_SIZE) && (*head == NULL)) {
+        uint32_t index = head - &s_wheel.slot[0][0];
+        s_wheel.bitmap[index/WHEEL_LEVEL_SIZE] &= ~(1UL << (index%WHEEL_LEVEL_SIZE));
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
 }
 
 /*********************************************************
-FN: Ƿ
+FN: ticks after pos to the first non empty slot of the level, 0 when it is empty
 */
-bool suble_timer_is_running(ke_msg_id_t const timer_id)
+static uint32_t suble_timer_wheel_slot_offset(uint32_t level)
 {
-    if((timer_id < SUBLE_TIMER0) || (timer_id >= SUBLE_TIMER_MAX)) {
-        return false;
+    uint32_t bitmap = s_wheel.bitmap[level];
+    uint32_t rot = (((s_wheel.pos >> (WHEEL_LEVEL_BITS*level)) & WHEEL_LEVEL_MASK) + 1) & WHEEL_LEVEL_MASK;
+
+    if(bitmap == 0) {
+        return 0;
     }
-    
-    uint32_t idx = timer_id-SUBLE_TIMER0;
-    return (s_suble_timer[idx].count != 0);
+    if(rot != 0) {
+        bitmap = (bitmap >> rot) | (bitmap << (WHEEL_LEVEL_SIZE - rot));
+    }
+    return suble_timer_lowest_bit(bitmap) + 1;
 }
 
+/*********************************************************
+FN: next tick at which a slot has to be expired or cascaded
+*/
+static uint32_t suble_timer_wheel_next_step(void)
+{
+    uint32_t next = s_wheel.pos + WHEEL_SPAN;
+
+    for(uint32_t level=0; level<WHEEL_LEVEL_NUM; level++) {
+        uint32_t offset = suble_timer_wheel_slot_offset(level);
+        if(offset != 0) {
+            uint32_t shift = WHEEL_LEVEL_BITS*level;
+            uint32_t tick = ((s_wheel.pos >> shift) + offset) << shift;
+            if(WHEEL_IS_AFTER(next, tick)) {
+                next = tick;
+            }
+        }
+    }
+    return next;
+}
 
+/*********************************************************
+FN: earliest deadline, the first non empty slot of each level holds its earliest timer
+    a parked timer counts as the last tick of its slot, the next slot may hold an earlier one
+*/
+static bool suble_timer_wheel_next_deadline(uint32_t* p_deadline)
+{
+    bool found = false;
+
+    for(uint32_t level=0; level<WHEEL_LEVEL_NUM; level++) {
+        uint32_t offset = suble_timer_wheel_slot_offset(level);
+        if(offset != 0) {
+            uint32_t shift = WHEEL_LEVEL_BITS*level;
+            uint32_t idx = ((s_wheel.pos >> shift) + offset) & WHEEL_LEVEL_MASK;
+            uint32_t slot_end = (((s_wheel.pos >> shift) + offset + 1) << shift) - 1;
+            for(suble_timer_t* timer = s_wheel.slot[level][idx]; timer != NULL; timer = timer->next) {
+                uint32_t deadline = WHEEL_IS_AFTER(timer->deadline, slot_end) ? slot_end : timer->deadline;
+                if((!found) || WHEEL_IS_AFTER(*p_deadline, deadline)) {
+                    *p_deadline = deadline;
+                    found = true;
+                }
+            }
+        }
+    }
+    return found;
+}
 
+/*********************************************************
+FN: arm the one kernel timer for the earliest deadline
+*/
+static void suble_timer_wheel_arm(void)
+{
+    uint32_t deadline;
+    uint32_t delay;
 
-/*********************************************************  suble_timer app  *********************************************************/
+    if(!suble_timer_wheel_next_deadline(&deadline)) {
+        if(s_wheel.is_armed) {
+            ke_timer_clear(SUBLE_TIMER_WHEEL, TASK_APPM);
+            s_wheel.is_armed = false;
+        }
+        return;
+    }
 
-typedef struct {
-    uint8_t is_occupy;
-    ke_msg_id_t timer_id;
-    uint32_t count;
-    uint32_t ms;
-    suble_timer_handler_t handler;
-} suble_timer_item_t;
+    delay = WHEEL_IS_AFTER(deadline, s_wheel.clock) ? (deadline - s_wheel.clock) : 1;
+    if(delay > WHEEL_ARM_MAX_TICKS) {
+        delay = WHEEL_ARM_MAX_TICKS;
+    }
+    if((!s_wheel.is_armed) || (s_wheel.armed != s_wheel.clock + delay)) {
+        ke_timer_set(SUBLE_TIMER_WHEEL, TASK_APPM, delay);
+        s_wheel.armed = s_wheel.clock + delay;
+        s_wheel.is_armed = true;
+    }
+}
 
-static suble_timer_item_t m_timer_pool[] = {
-    [0]  = { .timer_id = SUBLE_TIMER0},
-    [1]  = { .timer_id = SUBLE_TIMER1},
-    [2]  = { .timer_id = SUBLE_TIMER2},
-    [3]  = { .timer_id = SUBLE_TIMER3},
-    [4]  = { .timer_id = SUBLE_TIMER4},
-    [5]  = { .timer_id = SUBLE_TIMER5},
-    [6]  = { .timer_id = SUBLE_TIMER6},
-    [7]  = { .timer_id = SUBLE_TIMER7},
-    [8]  = { .timer_id = SUBLE_TIMER8},
-    [9]  = { .timer_id = SUBLE_TIMER9},
-    [10] = { .timer_id = SUBLE_TIMER10},
-    [11] = { .timer_id = SUBLE_TIMER11},
-    [12] = { .timer_id = SUBLE_TIMER12},
-    [13] = { .timer_id = SUBLE_TIMER13},
-    [14] = { .timer_id = SUBLE_TIMER14},
-    [15] = { .timer_id = SUBLE_TIMER15},
-    [16] = { .timer_id = SUBLE_TIMER16},
-    [17] = { .timer_id = SUBLE_TIMER17},
-    [18] = { .timer_id = SUBLE_TIMER18},
-    [19] = { .timer_id = SUBLE_TIMER19},
-};
+/*********************************************************
+FN: place the timers of a higher level slot again, they all get closer to pos
+*/
+static void suble_timer_wheel_cascade(uint32_t level, uint32_t idx)
+{
+    suble_timer_t* timer = s_wheel.slot[level][idx];
+
+    s_wheel.slot[level][idx] = NULL;
+    s_wheel.bitmap[level] &= ~(1UL << idx);
+    while(timer != NULL) {
+        suble_timer_t* next = timer->next;
+        suble_timer_wheel_insert(timer);
+        timer = next;
+    }
+}
 
 /*********************************************************
-FN: 
+FN: process the tick, the timers due move to the expired list
 */
-static suble_timer_item_t* acquire_timer(uint32_t ms, uint32_t count, suble_timer_handler_t handler)
+static void suble_timer_wheel_step(uint32_t tick)
 {
-    for(uint8_t i=0; i<SUBLE_TIMER_MAX_NUM; i++) {
-        if (m_timer_pool[i].is_occupy == 0) {
-            m_timer_pool[i].is_occupy = 1;
-            m_timer_pool[i].count = count;
-            m_timer_pool[i].ms = ms;
-            m_timer_pool[i].handler = handler;
-            return &m_timer_pool[i];
+    uint32_t idx = tick & WHEEL_LEVEL_MASK;
+
+    s_wheel.pos = tick;
+    for(uint32_t level=1; level<WHEEL_LEVEL_NUM; level++) {
+        if((tick & ((1UL << (WHEEL_LEVEL_BITS*level)) - 1)) != 0) {
+            break;
         }
+        suble_timer_wheel_cascade(level, (tick >> (WHEEL_LEVEL_BITS*level)) & WHEEL_LEVEL_MASK);
+    }
+
+    if(s_wheel.slot[0][idx] != NULL) {
+        s_wheel.expired = s_wheel.slot[0][idx];
+        s_wheel.expired->pprev = &s_wheel.expired;
+        s_wheel.slot[0][idx] = NULL;
+        s_wheel.bitmap[0] &= ~(1UL << idx);
     }
-    return NULL;
 }
 
 /*********************************************************
-FN: 
+FN: take the next expired timer, a periodic one is placed again at its
+    next absolute deadline so that late handlers do not add up to drift
 */
-static int32_t release_timer(void* timer_id)
+static suble_timer_t* suble_timer_wheel_expire(void)
 {
-    for(uint8_t i=0; i<SUBLE_TIMER_MAX_NUM; i++) {
-        if (timer_id == &m_timer_pool[i]) {
-            m_timer_pool[i].is_occupy = 0;
-            return i;
+    suble_timer_t* timer = s_wheel.expired;
+
+    if(timer == NULL) {
+        return NULL;
+    }
+
+    suble_timer_wheel_remove(timer);
+    if((timer->count != SUBLE_TIMER_COUNT_ENDLESS) && (timer->count > 0)) {
+        timer->count--;
+    }
+    if(timer->count > 0) {
+        timer->deadline += timer->period;
+        if(!WHEEL_IS_AFTER(timer->deadline, s_wheel.pos)) {
+            //missed periods are skipped, the phase is kept
+            timer->deadline += ((s_wheel.pos - timer->deadline) / timer->period + 1) * timer->period;
         }
+        suble_timer_wheel_insert(timer);
     }
-    return -1;
+    return timer;
 }
 
 /*********************************************************
-FN: 
+FN: the kernel timer of the wheel, expire everything up to now
 */
-static int32_t find_timer_ms(void* timer_id, uint32_t *ms)
+void suble_timer_handler(void)
 {
-    for(uint8_t i=0; i<SUBLE_TIMER_MAX_NUM; i++) {
-        if (timer_id == &m_timer_pool[i]) {
-            *ms = m_timer_pool[i].ms;
-            return i;
+    bool is_done = false;
+
+    while(!is_done) {
+        suble_timer_t* timer = NULL;
+        suble_timer_handler_t handler = NULL;
+
+        GLOBAL_INT_DISABLE();
+        s_wheel.is_busy = true;
+        suble_timer_clock_update();
+        timer = suble_timer_wheel_expire();
+        while((timer == NULL) && WHEEL_IS_AFTER(s_wheel.clock, s_wheel.pos)) {
+            uint32_t next = suble_timer_wheel_next_step();
+            if(WHEEL_IS_AFTER(next, s_wheel.clock)) {
+                next = s_wheel.clock;
+            }
+            suble_timer_wheel_step(next);
+            timer = suble_timer_wheel_expire();
+        }
+        if(timer != NULL) {
+            handler = timer->handler;
+        }
+        else {
+            s_wheel.is_busy = false;
+            suble_timer_wheel_arm();
+            is_done = true;
+        }
+        GLOBAL_INT_RESTORE();
+
+        if(handler != NULL) {
+            handler(timer);
         }
     }
-    return -1;
 }
 
 /*********************************************************
-FN: 
+FN: 
 */
-static void suble_timer_app_handler(uint32_t timer_id)
+void suble_timer_start_0(suble_timer_t* timer, uint32_t ms, uint32_t count)
 {
-    for(uint8_t i=0; i<SUBLE_TIMER_MAX_NUM; i++) {
-        if (timer_id == m_timer_pool[i].timer_id) {
-            m_timer_pool[i].handler(&m_timer_pool[i]);
-            break;
+    uint32_t ticks = (ms + 9)/10;
+
+    if((timer == NULL) || (count == 0)) {
+        return;
+    }
+    if(ticks == 0) {
+        ticks = 1;
+    }
+
+    GLOBAL_INT_DISABLE();
+    if(timer->pprev != NULL) {
+        suble_timer_wheel_remove(timer);
+    }
+    suble_timer_clock_update();
+    if(suble_timer_wheel_is_empty() && !s_wheel.is_busy) {
+        s_wheel.pos = s_wheel.clock;
+    }
+    timer->period = ticks;
+    timer->count = count;
+    timer->deadline = s_wheel.clock + ticks;
+    suble_timer_wheel_insert(timer);
+    if((!s_wheel.is_busy) && ((!s_wheel.is_armed) || WHEEL_IS_AFTER(s_wheel.armed, timer->deadline))) {
+        if(ticks > WHEEL_ARM_MAX_TICKS) {
+            ticks = WHEEL_ARM_MAX_TICKS;
         }
+        ke_timer_set(SUBLE_TIMER_WHEEL, TASK_APPM, ticks);
+        s_wheel.armed = s_wheel.clock + ticks;
+        s_wheel.is_armed = true;
+    }
+    GLOBAL_INT_RESTORE();
+}
+
+/*********************************************************
+FN: ֹͣ
+*/
+void suble_timer_stop_0(suble_timer_t* timer)
+{
+    if(timer == NULL) {
+        return;
+    }
+
+    GLOBAL_INT_DISABLE();
+    if(timer->pprev != NULL) {
+        suble_timer_wheel_remove(timer);
     }
+    timer->count = 0;
+    if(s_wheel.is_armed && (!s_wheel.is_busy) && suble_timer_wheel_is_empty()) {
+        ke_timer_clear(SUBLE_TIMER_WHEEL, TASK_APPM);
+        s_wheel.is_armed = false;
+    }
+    GLOBAL_INT_RESTORE();
 }
 
+/*********************************************************
+FN: Ƿ
+*/
+bool suble_timer_is_running(suble_timer_t* timer)
+{
+    return ((timer != NULL) && (timer->pprev != NULL));
+}
+
+
+
+
+/*********************************************************  suble_timer app  *********************************************************/
+
 /*********************************************************
 FN: 
 */
 uint32_t suble_timer_create(void** p_timer_id, uint32_t timeout_value_ms, suble_timer_mode_t mode, suble_timer_handler_t timeout_handler)
 {
-    suble_timer_item_t* timer_item = acquire_timer(timeout_value_ms, (mode==SUBLE_TIMER_SINGLE_SHOT ? 1 : SUBLE_TIMER_COUNT_ENDLESS), timeout_handler);
+    suble_timer_item_t* timer_item = tuya_ble_malloc(sizeof(suble_timer_item_t));
     if (timer_item == NULL) {
         return SUBLE_ERROR_COMMON;
     }
     
+    memset(timer_item, 0, sizeof(suble_timer_item_t));
+    timer_item->timer.handler = timeout_handler;
+    timer_item->ms = timeout_value_ms;
+    timer_item->count = (mode==SUBLE_TIMER_SINGLE_SHOT ? 1 : SUBLE_TIMER_COUNT_ENDLESS);
+    
     *p_timer_id = timer_item;
     return SUBLE_SUCCESS;
 }
@@ -267,12 +455,12 @@ FN:
 uint32_t suble_timer_delete(void* timer_id)
 {
     suble_timer_item_t* timer_item = timer_id;
-    int id = release_timer(timer_item);
-    if (id == -1) {
+    if (timer_item == NULL) {
         return SUBLE_ERROR_COMMON;
     }
     
-    suble_timer_stop_0(timer_item->timer_id);
+    suble_timer_stop_0(&timer_item->timer);
+    tuya_ble_free((uint8_t*)timer_item);
     return SUBLE_SUCCESS;
 }
 
@@ -281,18 +469,13 @@ FN:
 */
 uint32_t suble_timer_start(void* timer_id)
 {
-    uint32_t ms;
     suble_timer_item_t* timer_item = timer_id;
-    
-    if(find_timer_ms(timer_item, &ms) >= 0)
-    {
-        suble_timer_start_0(timer_item->timer_id, timer_item->ms, timer_item->count);
-        return SUBLE_SUCCESS;
-    }
-    else {
-        SUBLE_PRINTF("suble_timer_start: not find_timer_ms");
+    if (timer_item == NULL) {
         return SUBLE_ERROR_COMMON;
     }
+    
+    suble_timer_start_0(&timer_item->timer, timer_item->ms, timer_item->count);
+    return SUBLE_SUCCESS;
 }
 
 /*********************************************************
@@ -301,7 +484,11 @@ FN:
 uint32_t suble_timer_stop(void* timer_id)
 {
     suble_timer_item_t* timer_item = timer_id;
-    suble_timer_stop_0(timer_item->timer_id);
+    if (timer_item == NULL) {
+        return SUBLE_ERROR_COMMON;
+    }
+    
+    suble_timer_stop_0(&timer_item->timer);
     return SUBLE_SUCCESS;
 }
 
@@ -310,20 +497,14 @@ FN:
 */
 uint32_t suble_timer_restart(void* timer_id, uint32_t timeout_value_ms)
 {
-    uint32_t ms;
     suble_timer_item_t* timer_item = timer_id;
-    
-    if(find_timer_ms(timer_id, &ms) >= 0)
-    {
-        suble_timer_stop_0(timer_item->timer_id);
-        timer_item->ms = timeout_value_ms;
-        suble_timer_start_0(timer_item->timer_id, timer_item->ms, timer_item->count);
-        return SUBLE_SUCCESS;
-    }
-    else {
-        SUBLE_PRINTF("suble_timer_restart: not find_timer_ms");
+    if (timer_item == NULL) {
         return SUBLE_ERROR_COMMON;
     }
+    
+    timer_item->ms = timeout_value_ms;
+    suble_timer_start_0(&timer_item->timer, timer_item->ms, timer_item->count);
+    return SUBLE_SUCCESS;
 }
 
 
@@ -331,16 +512,52 @@ uint32_t suble_timer_restart(void* timer_id, uint32_t timeout_value_ms)
 
 /*********************************************************  RTC  *********************************************************/
 
+//the ble slot clock runs on the low power clock through sleep as well, 1600 slots of 625us per second
+#define RTC_SLOTS_PER_SECOND       1600
+#define RTC_SLOT_CLOCK_MASK        0x07FFFFFF
+//the slot clock wraps after 23h, it is read at least this often so that no wrap is lost
+#define RTC_REFRESH_MS             (6*3600*1000UL)
+
 static uint32_t s_local_timestamp = 0;
 static uint32_t s_local_timestamp_when_update = 0;
 static uint32_t s_app_timestamp_when_update = 0;
+static uint32_t s_rtc_slot = 0;         //slot clock at the last whole second
+static bool s_rtc_is_init = false;
+static suble_timer_t s_rtc_timer = SUBLE_TIMER_DEF(suble_rtc_handler);
 
 /*********************************************************
-FN: ʱ
+FN: move the local timestamp on by the whole seconds of the slot clock
+    the remainder stays in s_rtc_slot, so the timestamp does not drift
+    return the slots of the running second
 */
-static void suble_rtc_handler(void)
+static uint32_t suble_rtc_update(void)
 {
-    s_local_timestamp++;
+    uint32_t slot;
+    uint32_t elapsed;
+    uint32_t seconds;
+
+    //the log reads the time from interrupts as well
+    GLOBAL_INT_DISABLE();
+    slot = lld_evt_time_get();
+    if(!s_rtc_is_init) {
+        s_rtc_slot = slot;
+        s_rtc_is_init = true;
+    }
+
+    elapsed = (slot - s_rtc_slot) & RTC_SLOT_CLOCK_MASK;
+    seconds = elapsed / RTC_SLOTS_PER_SECOND;
+    s_rtc_slot = (s_rtc_slot + seconds*RTC_SLOTS_PER_SECOND) & RTC_SLOT_CLOCK_MASK;
+    s_local_timestamp += seconds;
+    GLOBAL_INT_RESTORE();
+    return (elapsed - seconds*RTC_SLOTS_PER_SECOND);
+}
+
+/*********************************************************
+FN: only keeps the slot clock from wrapping unseen, the timestamp is counted on read
+*/
+static void suble_rtc_handler(void* timer)
+{
+    suble_rtc_update();
 }
 
 /*********************************************************
@@ -348,9 +565,8 @@ FN: 
 */
 static void suble_rtc_start(void)
 {
-//    rtc_alarm_init(0x01, NULL, 500, suble_rtc_handler);
-    
-    suble_timer_start_0(SUBLE_TIMER200, 1000, SUBLE_TIMER_COUNT_ENDLESS);
+    suble_rtc_update();
+    suble_timer_start_0(&s_rtc_timer, RTC_REFRESH_MS, SUBLE_TIMER_COUNT_ENDLESS);
 }
 
 /*********************************************************
@@ -366,6 +582,7 @@ FN: 
 */
 void suble_update_timestamp(uint32_t app_timestamp)
 {
+    suble_rtc_update();
     s_local_timestamp_when_update = s_local_timestamp;
     s_app_timestamp_when_update = app_timestamp;
 }
@@ -383,6 +600,7 @@ FN: 
 */
 uint32_t suble_get_local_timestamp(void)
 {
+    suble_rtc_update();
     return s_local_timestamp;
 }
 
@@ -391,6 +609,7 @@ FN: 
 */
 uint32_t suble_get_timestamp(void)
 {
+    suble_rtc_update();
     return (s_app_timestamp_when_update + (s_local_timestamp - s_local_timestamp_when_update));
 }
 
@@ -399,7 +618,58 @@ FN: 
 */
 uint32_t suble_get_old_timestamp(uint32_t old_local_timestamp)
 {
-    return (suble_get_timestamp() - (s_local_timestamp - old_local_timestamp));
+    uint32_t local_timestamp;
+    uint32_t timestamp;
+
+    suble_rtc_update();
+    local_timestamp = s_local_timestamp;
+    timestamp = s_app_timestamp_when_update + (local_timestamp - s_local_timestamp_when_update);
+    return (timestamp - (local_timestamp - old_local_timestamp));
+}
+
+/*********************************************************
+FN: current timestamp with the milliseconds of the running second
+*/
+uint32_t suble_get_timestamp_with_ms(uint16_t* ms)
+{
+    uint32_t local_timestamp;
+    uint32_t slots;
+
+    //the seconds and the slots of the same read
+    GLOBAL_INT_DISABLE();
+    slots = suble_rtc_update();
+    local_timestamp = s_local_timestamp;
+    GLOBAL_INT_RESTORE();
+    if(ms != NULL) {
+        *ms = (uint16_t)(slots*5/8);
+    }
+    return (s_app_timestamp_when_update + (local_timestamp - s_local_timestamp_when_update));
+}
+
+
+
+
+/*********************************************************  WDT  *********************************************************/
+
+//rw_app_enter feeds the 8s watchdog (WATCH_DOG_COUNT) on every pass and the cpu
+//only sleeps when the main loop is idle, so it has to wake up in time by itself
+#define WDT_WAKE_MS                (4*1000UL)
+
+static suble_timer_t s_wdt_wake_timer = SUBLE_TIMER_DEF(suble_wdt_wake_handler);
+
+/*********************************************************
+FN: nothing to do, the watchdog is fed after the wake up
+*/
+static void suble_wdt_wake_handler(void* timer)
+{
+}
+
+/*********************************************************
+FN: wake up at least every WDT_WAKE_MS, also when no other timer runs
+*/
+void suble_wdt_wake_start(void)
+{
+    suble_timer_start_0(&s_wdt_wake_timer, WDT_WAKE_MS, SUBLE_TIMER_COUNT_ENDLESS);
 }
 
 
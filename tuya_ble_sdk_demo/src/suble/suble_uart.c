@@ -27,11 +27,11 @@
 
 
 /*********************************************************
-FN: 
+FN: called from the uart isr with every drained span, the sdk reassembles the frames
 */
 static void uart1_rx_handler(uint8_t *buf, uint8_t len)
 {
-    tuya_ble_common_uart_send_full_instruction_received(buf, len);
+    tuya_ble_common_uart_receive_data(buf, len);
 //    SUBLE_HEXDUMP("uart1", buf, len);
 }
 
@@ -41,7 +41,7 @@ FN:
 static void uart2_rx_handler(uint8_t *buf, uint8_t len)
 {
 //    SUBLE_HEXDUMP("uart2", buf, len);
-    tuya_ble_common_uart_send_full_instruction_received(buf, len);
+    tuya_ble_common_uart_receive_data(buf, len);
 }
 
 /*********************************************************
@@ -63,21 +63,39 @@ void suble_uart2_init(void)
 }
 
 /*********************************************************
-FN: 
+FN: queued for the tx interrupt
+RT: false - busy, the queue has no room for the whole buffer, nothing is sent
+NT: retry from the handler of suble_uart1_tx_cb_register(), only a buffer that
+    never fits into the queue is sent by polling
 */
-void suble_uart1_send(const uint8_t* buf, uint32_t size)
+bool suble_uart1_send(const uint8_t* buf, uint32_t size)
 {
-    uart_send((void*)buf, size);
+    if(size >= UART0_TX_FIFO_MAX_COUNT) {
+        uart_send((void*)buf, size);
+        return true;
+    }
+    return (uart_send_async((void*)buf, size) == size);
 }
 
 /*********************************************************
 FN: 
 */
-void suble_uart2_send(const uint8_t* buf, uint32_t size)
+bool suble_uart2_send(const uint8_t* buf, uint32_t size)
 {
-    uart2_send((void*)buf, size);
+    if(size >= UART0_TX_FIFO_MAX_COUNT) {
+        uart2_send((void*)buf, size);
+        return true;
+    }
+    return (uart2_send_async((void*)buf, size) == size);
 }
 
+/*********************************************************
+FN: handler called from the uart isr once the tx queue is drained
+*/
+void suble_uart1_tx_cb_register(suble_uart_tx_cb_t cb)
+{
+    uart_tx_cb_register(cb);
+}
 
 
 
@@ -37,6 +37,7 @@
 #include "tuya_ble_main.h"
 #include "tuya_ble_storage.h"
 #include "tuya_ble_app_production_test.h"
+#include "tuya_ble_app_uart_common_handler.h"
 #include "tuya_ble_log.h"
 #include "tuya_ble_api.h"
 #include "app_port.h"
@@ -117,7 +118,7 @@ static uint32_t tuya_ble_uart_prod_send(uint8_t type,uint8_t *pdata,uint8_t len)
         uart_send_buffer[5] = len;        
         memcpy(uart_send_buffer+6,pdata,len);
         uart_send_buffer[6+len] = tuya_ble_check_sum(uart_send_buffer,6+len);
-        tuya_ble_common_uart_send_data(uart_send_buffer,7+len);
+        tuya_ble_uart_common_send_data(uart_send_buffer,7+len);
         tuya_ble_free(uart_send_buffer);
     }
     else
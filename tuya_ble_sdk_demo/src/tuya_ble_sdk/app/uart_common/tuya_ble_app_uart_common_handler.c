@@ -54,6 +54,60 @@
 #define TUYA_BLE_UART_COMMON_MCU_OTA_END			        0xEE
 
 
+//frames the uart tx queue had no room for, sent in order once it is drained
+#define TUYA_BLE_UART_COMMON_TX_PENDING_MAX  300
+
+static uint8_t  uart_tx_pending_buffer[TUYA_BLE_UART_COMMON_TX_PENDING_MAX];
+static uint16_t uart_tx_pending_len = 0;
+
+
+static void tuya_ble_uart_common_tx_pending_send(void)
+{
+    //busy again means more is queued, its tx complete retries
+    if((uart_tx_pending_len>0)&&(tuya_ble_common_uart_send_data(uart_tx_pending_buffer,uart_tx_pending_len)==TUYA_BLE_SUCCESS))
+    {
+        uart_tx_pending_len = 0;
+    }
+}
+
+
+void tuya_ble_uart_common_send_data(const uint8_t *p_data,uint16_t len)
+{
+    tuya_ble_uart_common_tx_pending_send();
+
+    //behind a waiting frame the order has to be kept
+    if((uart_tx_pending_len==0)&&(tuya_ble_common_uart_send_data(p_data,len)==TUYA_BLE_SUCCESS))
+    {
+        return;
+    }
+
+    if(uart_tx_pending_len+len > TUYA_BLE_UART_COMMON_TX_PENDING_MAX)
+    {
+        TUYA_BLE_LOG_ERROR("uart tx busy, cmd 0x%02x dropped",(len>3)?p_data[3]:0);
+        return;
+    }
+    memcpy(uart_tx_pending_buffer+uart_tx_pending_len,p_data,len);
+    uart_tx_pending_len += len;
+}
+
+
+static void tuya_ble_uart_common_tx_complete_handler(int32_t evt_id,void *data)
+{
+    tuya_ble_uart_common_tx_pending_send();
+}
+
+
+void tuya_ble_uart_common_tx_complete(void)
+{
+    tuya_ble_custom_evt_t evt;
+
+    evt.evt_id = 0;
+    evt.data = NULL;
+    evt.custom_event_handler = tuya_ble_uart_common_tx_complete_handler;
+    tuya_ble_custom_event_send(evt);
+}
+
+
 #if (!TUYA_BLE_OTA_MCU_TEST)
 
 
@@ -128,7 +182,7 @@ void tuya_ble_uart_common_mcu_ota_data_from_ble_handler(uint16_t cmd,uint8_t*rec
 
     uart_data_buffer[uart_data_len] = tuya_ble_check_sum(uart_data_buffer,uart_data_len);
 
-    tuya_ble_common_uart_send_data(uart_data_buffer,uart_data_len+1);
+    tuya_ble_uart_common_send_data(uart_data_buffer,uart_data_len+1);
 
     TUYA_BLE_LOG_HEXDUMP_DEBUG("mcu ota uart send data : ",uart_data_buffer,uart_data_len+1);
 
@@ -272,7 +326,7 @@ static void tuya_ble_common_uart_protocol_send(uint8_t cmd,uint8_t *pdata,uint8_
     memcpy(alloc_buf+6+1,pdata,len);
     alloc_buf[7+len] = tuya_ble_check_sum(alloc_buf+1,6+len);
 
-    tuya_ble_common_uart_send_data(alloc_buf+1,7+len);
+    tuya_ble_uart_common_send_data(alloc_buf+1,7+len);
 }
 
 
@@ -286,7 +340,7 @@ static void tuya_ble_vtimer_heartbeat_callback(tuya_ble_timer_t timer)
     heartbeat_uart_buffer[5] = 0x00;
     heartbeat_uart_buffer[6] = 0xFF;
 
-    tuya_ble_common_uart_send_data(heartbeat_uart_buffer,7);
+    tuya_ble_uart_common_send_data(heartbeat_uart_buffer,7);
 
 }
 
@@ -418,7 +472,7 @@ void tuya_ble_uart_common_mcu_ota_data_from_ble_handler(uint16_t cmd,uint8_t*rec
 
     uart_data_buffer[uart_data_len] = tuya_ble_check_sum(uart_data_buffer,uart_data_len);
 
-    tuya_ble_common_uart_send_data(uart_data_buffer,uart_data_len+1);
+    tuya_ble_uart_common_send_data(uart_data_buffer,uart_data_len+1);
 
     TUYA_BLE_LOG_HEXDUMP_DEBUG("mcu ota uart send data : ",uart_data_buffer,uart_data_len+1);
 
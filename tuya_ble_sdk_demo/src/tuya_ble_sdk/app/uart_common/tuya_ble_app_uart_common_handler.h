@@ -44,6 +44,20 @@ void tuya_ble_uart_common_process(uint8_t *p_in_data,uint16_t in_len);
 
 void tuya_ble_uart_common_mcu_ota_data_from_ble_handler(uint16_t cmd,uint8_t*recv_data,uint32_t recv_len);
 
+/**
+ * @brief   Function for sending a frame to the mcu without waiting on the uart.
+ *
+ * @note    A frame the uart can not take yet is kept and sent in order from tuya_ble_uart_common_tx_complete().
+ * */
+void tuya_ble_uart_common_send_data(const uint8_t *p_data,uint16_t len);
+
+/**
+ * @brief   Function for telling the sdk that the uart tx queue is drained.
+ *
+ * @note    Called from the uart isr, the kept frames are sent from the sdk event loop.
+ * */
+void tuya_ble_uart_common_tx_complete(void);
+
 
 #ifdef __cplusplus
 }
@@ -41,8 +41,30 @@
 #ifndef MBEDTLS_AES_H
 #define MBEDTLS_AES_H
 
+/* AES table layout, shared by every AES user of the firmware (Tuya session
+ * layer, CCM, FPE prf). Pick it at build time with -DMBEDTLS_AES_TABLE_MODE=n
+ *
+ *   mode                           tables          per block
+ *   0 MBEDTLS_AES_TABLES_ROM       8.5KB flash     fastest, the default
+ *   1 MBEDTLS_AES_TABLES_ROM_FEWER 2.6KB flash     3 rotates more per column and round
+ *   2 MBEDTLS_AES_TABLES_RAM       8.5KB RAM       as 0, tables built on the first setkey
+ *   3 MBEDTLS_AES_TABLES_RAM_FEWER 2.6KB RAM       as 1, tables built on the first setkey
+ */
+#define MBEDTLS_AES_TABLES_ROM          0
+#define MBEDTLS_AES_TABLES_ROM_FEWER    1
+#define MBEDTLS_AES_TABLES_RAM          2
+#define MBEDTLS_AES_TABLES_RAM_FEWER    3
+
+#ifndef MBEDTLS_AES_TABLE_MODE
+#define MBEDTLS_AES_TABLE_MODE          MBEDTLS_AES_TABLES_ROM
+#endif
+
+#if ((MBEDTLS_AES_TABLE_MODE == MBEDTLS_AES_TABLES_ROM) || (MBEDTLS_AES_TABLE_MODE == MBEDTLS_AES_TABLES_ROM_FEWER))
 #define MBEDTLS_AES_ROM_TABLES
-//#define MBEDTLS_AES_FEWER_TABLES
+#endif
+#if ((MBEDTLS_AES_TABLE_MODE == MBEDTLS_AES_TABLES_ROM_FEWER) || (MBEDTLS_AES_TABLE_MODE == MBEDTLS_AES_TABLES_RAM_FEWER))
+#define MBEDTLS_AES_FEWER_TABLES
+#endif
 #define MBEDTLS_CIPHER_MODE_CBC
 //#define MBEDTLS_CIPHER_MODE_CFB
 //#define MBEDTLS_PKCS1_V15
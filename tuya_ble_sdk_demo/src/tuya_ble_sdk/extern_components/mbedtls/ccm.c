@@ -33,107 +33,47 @@
 #include <stdio.h>
 #include "aes.h"
 #include "ccm.h"
-#include <stdbool.h>
 
 
-#define CCM_ENCRYPT 0
-#define CCM_DECRYPT 1
-
+/* Implementation that should never be optimized out by the compiler */
+static void mbedtls_zeroize( void *v, size_t n ) {
+    volatile unsigned char *p = v; while( n-- ) *p++ = 0;
+}
 
-static bool aes128_ecb_encrypt(const uint8_t *key,uint8_t *input,uint16_t input_len,uint8_t *output)
+void aes_ccm_init( aes_ccm_context *ctx )
 {
-    uint16_t length;
-    mbedtls_aes_context aes_ctx;
-    //
-    if(input_len%16)
-    {
-        return false;
-    }
-
-    length = input_len;
-
-    mbedtls_aes_init(&aes_ctx);
-
-    mbedtls_aes_setkey_enc(&aes_ctx, key, 128);
-
-    while( length > 0 )
-    {
-        mbedtls_aes_crypt_ecb(&aes_ctx, MBEDTLS_AES_ENCRYPT, input, output );
-        input  += 16;
-        output += 16;
-        length -= 16;
-    }
-
-    mbedtls_aes_free(&aes_ctx);
-
-    return true;
+    memset( ctx, 0, sizeof( aes_ccm_context ) );
+    mbedtls_aes_init( &ctx->aes );
 }
 
-static int aes_ecb_encrypt(const uint8_t* pKey, uint8_t* input, uint8_t* output)
+int aes_ccm_setkey( aes_ccm_context *ctx, const unsigned char *key )
 {
-    return (int)aes128_ecb_encrypt(pKey, input, 16, output);
-   // AES128_ECB_encrypt(input,pKey, output);
-   // return 0;
-   // return aes128_encrypt(pKey, input, 16, output);
+    return( mbedtls_aes_setkey_enc( &ctx->aes, key, 128 ) );
 }
 
-/* Implementation that should never be optimized out by the compiler */
-static void mbedtls_zeroize( void *v, size_t n ) {
-    volatile unsigned char *p = v; while( n-- ) *p++ = 0;
+void aes_ccm_free( aes_ccm_context *ctx )
+{
+    mbedtls_aes_free( &ctx->aes );
+    mbedtls_zeroize( ctx, sizeof( aes_ccm_context ) );
 }
 
 /*
- * Macros for common operations.
- * Results in smaller compiled code than static inline functions.
- */
-
-/*
- * Update the CBC-MAC state in y using a block in b
- * (Always using b as the source helps the compiler optimise a bit better.)
- */
-#define UPDATE_CBC_MAC                                                      \
-    for( i = 0; i < 16; i++ )                                               \
-        y[i] ^= b[i];                                                       \
-                                                                            \
-    if( ( ret = aes_ecb_encrypt( key, y, y) ) != 0 )                        \
-        return( ret );
-
-/*
- * Encrypt or decrypt a partial block with CTR
- * Warning: using b for temporary storage! src and dst must not be b!
- * This avoids allocating one more 16 bytes buffer while allowing src == dst.
- */
-#define CTR_CRYPT( dst, src, len  )                                            \
-    if( ( ret = aes_ecb_encrypt( key, ctr, b) ) != 0 )                         \
-        return( ret );                                                         \
-                                                                               \
-    for( i = 0; i < len; i++ )                                                 \
-        dst[i] = src[i] ^ b[i];
-
-/*
- * Authenticated encryption or decryption
+ * Start a message: CBC-MAC of B_0 and of the additional data,
+ * counter block ready for the first block of the message
  */
-static int ccm_auth_crypt( int mode, const unsigned char *key,
-                           const unsigned char *iv, size_t iv_len,
-                           const unsigned char *add, size_t add_len,
-                           const unsigned char *input, size_t length,
-                           unsigned char *output,
-                           unsigned char *tag, size_t tag_len )
+int aes_ccm_starts( aes_ccm_context *ctx, int mode,
+                    const unsigned char *iv, size_t iv_len,
+                    const unsigned char *add, size_t add_len,
+                    size_t length, size_t tag_len )
 {
-    int ret;
     unsigned char i;
     unsigned char q;
     size_t len_left;
-    unsigned char b[16];
-    unsigned char y[16];
-    unsigned char ctr[16];
-    const unsigned char *src;
-    unsigned char *dst;
+    size_t use_len;
 
     /*
      * Check length requirements: SP800-38C A.1
      * Additional requirement: a < 2^16 - 2^8 to simplify the code.
-     * 'length' checked later (when writing it to the first block)
      */
     if( tag_len < 4 || tag_len > 16 || tag_len % 2 != 0 )
         return( MBEDTLS_ERR_CCM_BAD_INPUT );
@@ -158,56 +98,52 @@ static int ccm_auth_crypt( int mode, const unsigned char *key,
      * 6        add present?
      * 5 .. 3   (t - 2) / 2
      * 2 .. 0   q - 1
+     *
+     * y is zero, so B_0 is built in y directly.
      */
-    b[0] = 0;
-    b[0] |= ( add_len > 0 ) << 6;
-    b[0] |= ( ( tag_len - 2 ) / 2 ) << 3;
-    b[0] |= q - 1;
+    ctx->y[0] = 0;
+    ctx->y[0] |= ( add_len > 0 ) << 6;
+    ctx->y[0] |= ( ( tag_len - 2 ) / 2 ) << 3;
+    ctx->y[0] |= q - 1;
 
-    memcpy( b + 1, iv, iv_len );
+    memcpy( ctx->y + 1, iv, iv_len );
 
     for( i = 0, len_left = length; i < q; i++, len_left >>= 8 )
-        b[15-i] = (unsigned char)( len_left & 0xFF );
+        ctx->y[15-i] = (unsigned char)( len_left & 0xFF );
 
     if( len_left > 0 )
         return( MBEDTLS_ERR_CCM_BAD_INPUT );
 
-
-    /* Start CBC-MAC with first block */
-    memset( y, 0, 16 );
-    UPDATE_CBC_MAC;
+    mbedtls_aes_crypt_ecb( &ctx->aes, MBEDTLS_AES_ENCRYPT, ctx->y, ctx->y );
 
     /*
      * If there is additional data, update CBC-MAC with
      * add_len, add, 0 (padding to a block boundary)
+     * the zero padding leaves y as it is, so blocks are xored in place
      */
     if( add_len > 0 )
     {
-        size_t use_len;
-        len_left = add_len;
-        src = add;
+        ctx->y[0] ^= (unsigned char)( ( add_len >> 8 ) & 0xFF );
+        ctx->y[1] ^= (unsigned char)( ( add_len      ) & 0xFF );
 
-        memset( b, 0, 16 );
-        b[0] = (unsigned char)( ( add_len >> 8 ) & 0xFF );
-        b[1] = (unsigned char)( ( add_len      ) & 0xFF );
+        use_len = add_len < 16 - 2 ? add_len : 16 - 2;
+        for( i = 0; i < use_len; i++ )
+            ctx->y[2 + i] ^= add[i];
+        mbedtls_aes_crypt_ecb( &ctx->aes, MBEDTLS_AES_ENCRYPT, ctx->y, ctx->y );
 
-        use_len = len_left < 16 - 2 ? len_left : 16 - 2;
-        memcpy( b + 2, src, use_len );
-        len_left -= use_len;
-        src += use_len;
-
-        UPDATE_CBC_MAC;
+        len_left = add_len - use_len;
+        add += use_len;
 
         while( len_left > 0 )
         {
             use_len = len_left > 16 ? 16 : len_left;
 
-            memset( b, 0, 16 );
-            memcpy( b, src, use_len );
-            UPDATE_CBC_MAC;
+            for( i = 0; i < use_len; i++ )
+                ctx->y[i] ^= add[i];
+            mbedtls_aes_crypt_ecb( &ctx->aes, MBEDTLS_AES_ENCRYPT, ctx->y, ctx->y );
 
             len_left -= use_len;
-            src += use_len;
+            add += use_len;
         }
     }
 
@@ -221,66 +157,154 @@ static int ccm_auth_crypt( int mode, const unsigned char *key,
      * 7 .. 3   0
      * 2 .. 0   q - 1
      */
-    ctr[0] = q - 1;
-    memcpy( ctr + 1, iv, iv_len );
-    memset( ctr + 1 + iv_len, 0, q );
-    ctr[15] = 1;
+    ctx->ctr[0] = q - 1;
+    memcpy( ctx->ctr + 1, iv, iv_len );
+    memset( ctx->ctr + 1 + iv_len, 0, q );
+    ctx->ctr[15] = 1;
 
-    /*
-     * Authenticate and {en,de}crypt the message.
-     *
-     * The only difference between encryption and decryption is
-     * the respective order of authentication and {en,de}cryption.
-     */
-    len_left = length;
-    src = input;
-    dst = output;
+    ctx->len_left = length;
+    ctx->offset = 0;
+    ctx->q = q;
+    ctx->tag_len = (unsigned char) tag_len;
+    ctx->mode = (unsigned char) mode;
 
-    while( len_left > 0 )
-    {
-        size_t use_len = len_left > 16 ? 16 : len_left;
+    return( 0 );
+}
 
-        if( mode == CCM_ENCRYPT )
+/*
+ * Authenticate and {en,de}crypt the next part of the message.
+ *
+ * The only difference between encryption and decryption is
+ * whether the input or the output is the plaintext fed to the CBC-MAC.
+ * Each input byte is read before its output byte is written,
+ * so input and output may be the same buffer.
+ */
+int aes_ccm_update( aes_ccm_context *ctx,
+                    const unsigned char *input, size_t length,
+                    unsigned char *output )
+{
+    unsigned char i;
+    unsigned char c;
+    unsigned char p;
+
+    if( length > ctx->len_left )
+        return( MBEDTLS_ERR_CCM_BAD_INPUT );
+
+    ctx->len_left -= length;
+
+    while( length > 0 )
+    {
+        if( ctx->offset == 0 )
         {
-            memset( b, 0, 16 );
-            memcpy( b, src, use_len );
-            UPDATE_CBC_MAC;
+            mbedtls_aes_crypt_ecb( &ctx->aes, MBEDTLS_AES_ENCRYPT, ctx->ctr, ctx->s );
+
+            /*
+             * Increment counter.
+             * No need to check for overflow thanks to the length check in starts.
+             */
+            for( i = 0; i < ctx->q; i++ )
+                if( ++ctx->ctr[15-i] != 0 )
+                    break;
         }
 
-        CTR_CRYPT( dst, src, use_len );
+        c = *input++;
+        p = ( ctx->mode == AES_CCM_ENCRYPT ) ? c : (unsigned char)( c ^ ctx->s[ctx->offset] );
+        *output++ = c ^ ctx->s[ctx->offset];
+        ctx->y[ctx->offset] ^= p;
+        length--;
 
-        if( mode == CCM_DECRYPT )
+        if( ++ctx->offset == 16 )
         {
-            memset( b, 0, 16 );
-            memcpy( b, dst, use_len );
-            UPDATE_CBC_MAC;
+            mbedtls_aes_crypt_ecb( &ctx->aes, MBEDTLS_AES_ENCRYPT, ctx->y, ctx->y );
+            ctx->offset = 0;
         }
+    }
+
+    return( 0 );
+}
 
-        dst += use_len;
-        src += use_len;
-        len_left -= use_len;
-
-        /*
-         * Increment counter.
-         * No need to check for overflow thanks to the length check above.
-         */
-        for( i = 0; i < q; i++ )
-            if( ++ctr[15-i] != 0 )
-                break;
+/*
+ * Close the CBC-MAC of a partial last block,
+ * then mask it with the key stream of counter 0
+ */
+static int ccm_tag( aes_ccm_context *ctx, unsigned char *tag )
+{
+    unsigned char i;
+
+    if( ctx->len_left != 0 )
+        return( MBEDTLS_ERR_CCM_BAD_INPUT );
+
+    if( ctx->offset != 0 )
+    {
+        mbedtls_aes_crypt_ecb( &ctx->aes, MBEDTLS_AES_ENCRYPT, ctx->y, ctx->y );
+        ctx->offset = 0;
     }
 
-    /*
-     * Authentication: reset counter and crypt/mask internal tag
-     */
-    for( i = 0; i < q; i++ )
-        ctr[15-i] = 0;
+    for( i = 0; i < ctx->q; i++ )
+        ctx->ctr[15-i] = 0;
+
+    mbedtls_aes_crypt_ecb( &ctx->aes, MBEDTLS_AES_ENCRYPT, ctx->ctr, ctx->s );
+    for( i = 0; i < ctx->tag_len; i++ )
+        tag[i] = ctx->y[i] ^ ctx->s[i];
+
+    mbedtls_zeroize( ctx->s, 16 );
+    return( 0 );
+}
+
+int aes_ccm_finish( aes_ccm_context *ctx, unsigned char *tag )
+{
+    return( ccm_tag( ctx, tag ) );
+}
+
+int aes_ccm_check_tag( aes_ccm_context *ctx, const unsigned char *tag )
+{
+    int ret;
+    unsigned char check_tag[16];
+    unsigned char i;
+    int diff;
 
-    CTR_CRYPT( y, y, 16 );
-    memcpy( tag, y, tag_len );
+    if( ( ret = ccm_tag( ctx, check_tag ) ) != 0 )
+        return( ret );
+
+    /* Check tag in "constant-time" */
+    for( diff = 0, i = 0; i < ctx->tag_len; i++ )
+        diff |= tag[i] ^ check_tag[i];
+
+    if( diff != 0 )
+        return( MBEDTLS_ERR_CCM_AUTH_FAILED );
 
     return( 0 );
 }
 
+/*
+ * Authenticated encryption or decryption of a whole buffer
+ */
+static int ccm_auth_crypt( int mode, const unsigned char *key,
+                           const unsigned char *iv, size_t iv_len,
+                           const unsigned char *add, size_t add_len,
+                           const unsigned char *input, size_t length,
+                           unsigned char *output,
+                           const unsigned char *tag, unsigned char *tag_out, size_t tag_len )
+{
+    int ret;
+    aes_ccm_context ctx;
+
+    aes_ccm_init( &ctx );
+
+    if( ( ret = aes_ccm_setkey( &ctx, key ) ) == 0 &&
+        ( ret = aes_ccm_starts( &ctx, mode, iv, iv_len, add, add_len, length, tag_len ) ) == 0 &&
+        ( ret = aes_ccm_update( &ctx, input, length, output ) ) == 0 )
+    {
+        if( mode == AES_CCM_ENCRYPT )
+            ret = aes_ccm_finish( &ctx, tag_out );
+        else
+            ret = aes_ccm_check_tag( &ctx, tag );
+    }
+
+    aes_ccm_free( &ctx );
+    return( ret );
+}
+
 /*
  * Authenticated encryption
  */
@@ -291,8 +315,8 @@ int aes_ccm_encrypt_and_tag( const unsigned char *key,
                          unsigned char *output,
                          unsigned char *tag, size_t tag_len )
 {
-    return( ccm_auth_crypt( CCM_ENCRYPT, key, iv, iv_len,
-                            add, add_len, input, length, output, tag, tag_len ) );
+    return( ccm_auth_crypt( AES_CCM_ENCRYPT, key, iv, iv_len,
+                            add, add_len, input, length, output, NULL, tag, tag_len ) );
 }
 
 /*
@@ -306,28 +330,14 @@ int aes_ccm_auth_decrypt( const unsigned char *key,
                       const unsigned char *tag, size_t tag_len )
 {
     int ret;
-    unsigned char check_tag[16];
-    unsigned char i;
-    int diff;
 
-    if( ( ret = ccm_auth_crypt( CCM_DECRYPT, key,
-                                iv, iv_len, add, add_len,
-                                input, length, output, check_tag, tag_len ) ) != 0 )
-    {
-        return( ret );
-    }
+    ret = ccm_auth_crypt( AES_CCM_DECRYPT, key, iv, iv_len,
+                          add, add_len, input, length, output, tag, NULL, tag_len );
 
-    /* Check tag in "constant-time" */
-    for( diff = 0, i = 0; i < tag_len; i++ )
-        diff |= tag[i] ^ check_tag[i];
-
-    if( diff != 0 )
-    {
+    if( ret == MBEDTLS_ERR_CCM_AUTH_FAILED )
         mbedtls_zeroize( output, length );
-        return( MBEDTLS_ERR_CCM_AUTH_FAILED );
-    }
 
-    return( 0 );
+    return( ret );
 }
 
 //#define MI_AUTOTEST
@@ -26,10 +26,106 @@
 #define MBEDTLS_ERR_CCM_BAD_INPUT      -0x000D /**< Bad input parameters to function. */
 #define MBEDTLS_ERR_CCM_AUTH_FAILED    -0x000F /**< Authenticated decryption failed. */
 
+#include <stddef.h>
+#include "aes.h"
+
+#define AES_CCM_ENCRYPT     0
+#define AES_CCM_DECRYPT     1
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * The context API below is groundwork only: no code of this firmware calls
+ * CCM yet (the tuya protocol uses AES-CBC) and ccm.c is not in the Keil
+ * project. Add ccm.c to the project together with its first user.
+ */
+
+/**
+ * \brief           CCM context, keeps the expanded key so that a key can be
+ *                  used for many messages, and the state of one message
+ */
+typedef struct
+{
+    mbedtls_aes_context aes;    /*!< expanded encryption key */
+    unsigned char y[16];        /*!< CBC-MAC state */
+    unsigned char ctr[16];      /*!< counter block of the next key stream block */
+    unsigned char s[16];        /*!< key stream of the current block */
+    size_t len_left;            /*!< message bytes still expected by update */
+    unsigned char offset;       /*!< position inside the current block */
+    unsigned char q;            /*!< size of the length field */
+    unsigned char tag_len;
+    unsigned char mode;         /*!< AES_CCM_ENCRYPT or AES_CCM_DECRYPT */
+}
+aes_ccm_context;
+
+/**
+ * \brief           Initialize a CCM context
+ */
+void aes_ccm_init( aes_ccm_context *ctx );
+
+/**
+ * \brief           Expand the key, once for all the messages that use it
+ *
+ * \param key       key must be 16 bytes
+ *
+ * \return          0 if successful
+ */
+int aes_ccm_setkey( aes_ccm_context *ctx, const unsigned char *key );
+
+/**
+ * \brief           Clear a CCM context, key included
+ */
+void aes_ccm_free( aes_ccm_context *ctx );
+
+/**
+ * \brief           Start a message
+ *
+ * \param mode      AES_CCM_ENCRYPT or AES_CCM_DECRYPT
+ * \param iv        nonce, iv_len must be 7 to 13
+ * \param add       additional data, add_len must be less than 2^16 - 2^8
+ * \param length    length of the whole message, CCM puts it in the first block
+ * \param tag_len   must be 4, 6, 8, 10, 12, 14 or 16
+ *
+ * \return          0 if successful
+ */
+int aes_ccm_starts( aes_ccm_context *ctx, int mode,
+                    const unsigned char *iv, size_t iv_len,
+                    const unsigned char *add, size_t add_len,
+                    size_t length, size_t tag_len );
+
+/**
+ * \brief           Process the next part of the message, any size
+ *
+ * \param output    may be equal to input to work in place
+ *
+ * \return          0 if successful, MBEDTLS_ERR_CCM_BAD_INPUT when more
+ *                  data is passed than announced to aes_ccm_starts()
+ */
+int aes_ccm_update( aes_ccm_context *ctx,
+                    const unsigned char *input, size_t length,
+                    unsigned char *output );
+
+/**
+ * \brief           End an encryption and write the tag
+ *
+ * \return          0 if successful, MBEDTLS_ERR_CCM_BAD_INPUT when less
+ *                  data was passed than announced to aes_ccm_starts()
+ */
+int aes_ccm_finish( aes_ccm_context *ctx, unsigned char *tag );
+
+/**
+ * \brief           End a decryption and check the tag
+ *
+ * \note            The plaintext was already handed out by aes_ccm_update(),
+ *                  the caller must drop it when this fails.
+ *
+ * \return          0 if successful, MBEDTLS_ERR_CCM_AUTH_FAILED when the
+ *                  tag does not match
+ */
+int aes_ccm_check_tag( aes_ccm_context *ctx, const unsigned char *tag );
+
 /**
  * \brief           CCM buffer encryption
  *
@@ -37,16 +133,16 @@ extern "C" {
  * \param length    length of the input data in bytes
  * \param iv        nonce (initialization vector)
  * \param iv_len    length of IV in bytes
- *                  must be 2, 3, 4, 5, 6, 7 or 8
+ *                  must be 7 to 13
  * \param add       additional data
  * \param add_len   length of additional data in bytes
  *                  must be less than 2^16 - 2^8
  * \param input     buffer holding the input data
  * \param output    buffer for holding the output data
- *                  must be at least 'length' bytes wide
+ *                  must be at least 'length' bytes wide, may be equal to input
  * \param tag       buffer for holding the tag
  * \param tag_len   length of the tag to generate in bytes
- *                  must be 4, 6, 8, 10, 14 or 16
+ *                  must be 4, 6, 8, 10, 12, 14 or 16
  *
  * \note            The tag is written to a separate buffer. To get the tag
  *                  concatenated with the output as in the CCM spec, use
@@ -104,6 +104,15 @@ tuya_ble_status_t tuya_ble_sdk_init(tuya_ble_device_param_t * param_data);
 
 tuya_ble_status_t tuya_ble_dp_data_report(uint8_t *p_data,uint32_t len); 
 
+/**
+ * @brief   Function for getting the sequence number of the last dp report queued.
+ *
+ * @note    the first report is 1, TUYA_BLE_CB_EVT_DP_DATA_REPORT_RESPONSE carries the number of the report it answers.
+ *.
+ * */
+
+uint32_t tuya_ble_dp_data_report_seq_get(void);
+
 /**
  * @brief   Function for report the dp point data with time.
  *
@@ -141,6 +141,8 @@ void tuya_ble_set_external_mcu_version(uint32_t firmware_version,uint32_t hardwa
 
 uint8_t tuya_ble_commData_send(uint16_t cmd,uint32_t ack_sn,uint8_t *data,uint16_t len,uint8_t encryption_mode);
 
+uint8_t tuya_ble_dp_data_report_send(uint32_t seq,uint8_t *data,uint16_t len,uint8_t encryption_mode);
+
 uint8_t tuya_ble_send(uint16_t cmd,uint32_t ack_sn,uint8_t *data,uint16_t len);
 
 void tuya_ble_evt_process(uint16_t cmd,uint8_t*recv_data,uint32_t recv_len);
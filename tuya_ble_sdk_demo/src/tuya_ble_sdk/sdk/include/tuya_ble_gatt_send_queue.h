@@ -34,13 +34,15 @@ extern "C" {
 #endif
 
 typedef struct {
-    uint8_t * buf;
-    uint8_t size;
+    uint8_t * buf;      //whole encoded frame
+    uint16_t size;
 } tuya_ble_gatt_send_data_t;
 
 void tuya_ble_gatt_send_queue_init(void);
 void tuya_ble_gatt_send_data_handle(void *evt);
-tuya_ble_status_t tuya_ble_gatt_send_data_enqueue(uint8_t *p_data, uint8_t data_len);
+tuya_ble_status_t tuya_ble_gatt_send_frame_enqueue(uint8_t *p_frame, uint16_t frame_len);
+uint8_t tuya_ble_gatt_send_queue_used(void);
+void tuya_ble_gatt_send_tx_complete(void);
 
 #ifdef __cplusplus
 }
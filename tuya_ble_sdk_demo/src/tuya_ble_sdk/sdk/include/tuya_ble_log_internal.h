@@ -35,6 +35,15 @@
     #error "Not defined hexdump function."
 #endif
 
+//the port may give error and warning logs a printf of their own level
+#ifndef TUYA_BLE_PRINTF_ERROR
+#define TUYA_BLE_PRINTF_ERROR           TUYA_BLE_PRINTF
+#endif
+
+#ifndef TUYA_BLE_PRINTF_WARNING
+#define TUYA_BLE_PRINTF_WARNING         TUYA_BLE_PRINTF
+#endif
+
 
 #ifndef TUYA_BLE_LOG_COLORS_ENABLE
 #define TUYA_BLE_LOG_COLORS_ENABLE      0
@@ -89,7 +98,7 @@
 do {                                                                            \
     if (TUYA_BLE_LOG_LEVEL >= TUYA_BLE_LOG_LEVEL_ERROR)                                     \
     {                                                                           \
-        TUYA_BLE_PRINTF(TUYA_BLE_ERROR_PREFIX _fmt_ TUYA_BLE_LOG_DEFAULT_COLOR TUYA_BLE_LOG_CRLF, ##__VA_ARGS__);   \
+        TUYA_BLE_PRINTF_ERROR(TUYA_BLE_ERROR_PREFIX _fmt_ TUYA_BLE_LOG_DEFAULT_COLOR TUYA_BLE_LOG_CRLF, ##__VA_ARGS__);   \
     }                                                                           \
 } while(0)
 
@@ -97,7 +106,7 @@ do {
 do {                                                                            \
     if (TUYA_BLE_LOG_LEVEL >= TUYA_BLE_LOG_LEVEL_WARNING)                                   \
     {                                                                           \
-        TUYA_BLE_PRINTF(TUYA_BLE_WARNING_PREFIX _fmt_ TUYA_BLE_LOG_DEFAULT_COLOR TUYA_BLE_LOG_CRLF, ##__VA_ARGS__); \
+        TUYA_BLE_PRINTF_WARNING(TUYA_BLE_WARNING_PREFIX _fmt_ TUYA_BLE_LOG_DEFAULT_COLOR TUYA_BLE_LOG_CRLF, ##__VA_ARGS__); \
     }                                                                           \
 } while(0)
 
@@ -214,7 +223,7 @@ do {
 do {                                                                            \
     if (TUYA_APP_LOG_LEVEL >= TUYA_APP_LOG_LEVEL_ERROR)                                     \
     {                                                                           \
-        TUYA_BLE_PRINTF(TUYA_APP_ERROR_PREFIX _fmt_ TUYA_APP_LOG_DEFAULT_COLOR TUYA_APP_LOG_CRLF, ##__VA_ARGS__);   \
+        TUYA_BLE_PRINTF_ERROR(TUYA_APP_ERROR_PREFIX _fmt_ TUYA_APP_LOG_DEFAULT_COLOR TUYA_APP_LOG_CRLF, ##__VA_ARGS__);   \
     }                                                                           \
 } while(0)
 
@@ -222,7 +231,7 @@ do {
 do {                                                                            \
     if (TUYA_APP_LOG_LEVEL >= TUYA_APP_LOG_LEVEL_WARNING)                                   \
     {                                                                           \
-        TUYA_BLE_PRINTF(TUYA_APP_WARNING_PREFIX _fmt_ TUYA_APP_LOG_DEFAULT_COLOR TUYA_APP_LOG_CRLF, ##__VA_ARGS__); \
+        TUYA_BLE_PRINTF_WARNING(TUYA_APP_WARNING_PREFIX _fmt_ TUYA_APP_LOG_DEFAULT_COLOR TUYA_APP_LOG_CRLF, ##__VA_ARGS__); \
     }                                                                           \
 } while(0)
 
@@ -122,6 +122,14 @@ typedef struct s_klv_node {
     uint8_t *data;
 } klv_node_s;
 
+// one dp read in place, data points into the parsed buffer
+typedef struct {
+    uint8_t id;
+    dp_type type;
+    uint16_t len;
+    uint8_t *data;
+} klv_view_s;
+
 
 /***********************************************************
 *************************variable define********************
@@ -174,6 +182,40 @@ mtp_ret klvlist_2_data(klv_node_s *list,uint8_t **data,uint32_t *len,uint8_t typ
 __MUTLI_TSF_PROTOCOL_EXT \
 mtp_ret data_2_klvlist(uint8_t *data,uint32_t len,klv_node_s **list,uint8_t type);
 
+/***********************************************************
+*  Function: klv_view_next
+*  description: read one dp in place, nothing is copied
+*  Input: data len offset type:0-1 byte len,1-2 bytes len
+*  Output: view offset
+*  Return: MTP_COM_ERROR if the dp is cut
+*  Note: call it while offset < len to walk all dps.
+***********************************************************/
+__MUTLI_TSF_PROTOCOL_EXT \
+mtp_ret klv_view_next(uint8_t *data,uint32_t len,uint32_t *offset,klv_view_s *view,uint8_t type);
+
+/***********************************************************
+*  Function: klv_data_check
+*  description: check that data is one or more complete dps
+*  Input: data len type
+*  Output:
+*  Return:
+*  Note: same rules as data_2_klvlist, without building the list.
+***********************************************************/
+__MUTLI_TSF_PROTOCOL_EXT \
+mtp_ret klv_data_check(uint8_t *data,uint32_t len,uint8_t type);
+
+/***********************************************************
+*  Function: klv_data_put
+*  description: encode one dp into buf at offset
+*  Input: buf size offset id type data len len_type
+*  Output: offset
+*  Return: MTP_COM_ERROR if buf has no room
+*  Note: value and bitmap data is a uint32_t, like make_klv_list.
+***********************************************************/
+__MUTLI_TSF_PROTOCOL_EXT \
+mtp_ret klv_data_put(uint8_t *buf,uint32_t size,uint32_t *offset,uint8_t id,dp_type type,\
+                     void *data,uint16_t len,uint8_t len_type);
+
 /***********************************************************
 *  Function: create_trsmitr_init
 *  description: create a transmitter and initialize
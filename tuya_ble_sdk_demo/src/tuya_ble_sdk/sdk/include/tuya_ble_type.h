@@ -272,6 +272,7 @@ typedef struct{
 typedef struct{
 	uint8_t *p_data;
 	uint16_t data_len;
+	uint32_t seq;   //see tuya_ble_dp_data_report_seq_get()
 }tuya_ble_dp_data_reported_t;    
 
 
@@ -524,6 +525,7 @@ typedef struct{
  * */
 typedef struct{
 	uint8_t status;
+	uint32_t seq;   //the report it answers, 0 if unknown
 }tuya_ble_dp_data_report_response_t;
 
 /*
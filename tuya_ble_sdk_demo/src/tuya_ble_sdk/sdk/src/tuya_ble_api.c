@@ -184,96 +184,137 @@ tuya_ble_status_t tuya_ble_gatt_receive_data(uint8_t *p_data,uint16_t len)
 typedef enum {
     TUYA_BLE_UART_REV_STATE_FOUND_NULL,
     TUYA_BLE_UART_REV_STATE_FOUND_HEAD,
-    TUYA_BLE_UART_REV_STATE_FOUND_CMD,
-    TUYA_BLE_UART_REV_STATE_FOUND_LEN_H,
-    TUYA_BLE_UART_REV_STATE_FOUND_LEN_L,
     TUYA_BLE_UART_REV_STATE_FOUND_DATA,
-    TUYA_BLE_UART_REV_STATE_UNKOWN,
 } tuya_ble_uart_rev_state_type_t;
 
 #define UART_RX_BUFFER_MAX   300
 #define UART_RX_DATA_LEN_MAX 249
+//0x55/0x66 0xAA version cmd len_h len_l
+#define UART_RX_HEAD_LEN     6
 static volatile tuya_ble_uart_rev_state_type_t current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_NULL;
 static uint8_t UART_RX_Buffer[UART_RX_BUFFER_MAX];
 static uint8_t UART_RX_Buffer_temp[3] = {0};
+//bytes still missing in the current state
 static uint16_t uart_data_len =  0;
 static volatile uint16_t UART_RX_Count = 0;
 
 
-static bool tuya_ble_common_uart_data_unpack(uint8_t data)
+static void tuya_ble_common_uart_data_unpack_reset(void)
 {
-    bool ret = false;
+    memset(UART_RX_Buffer_temp,0,3);
+    UART_RX_Count = 0;
+    current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_NULL;
+    uart_data_len = 0;
+}
 
+/*
+ * Shift one byte into the header window. A header restarts the frame wherever it
+ * shows up, inside the data of the current frame too, as the byte parser did.
+ *
+ * return true when the byte completed a header.
+ * */
+static bool tuya_ble_common_uart_head_shift(uint8_t data)
+{
     UART_RX_Buffer_temp[0] = UART_RX_Buffer_temp[1];
     UART_RX_Buffer_temp[1] = UART_RX_Buffer_temp[2];
     UART_RX_Buffer_temp[2] = data;
 
     if(((UART_RX_Buffer_temp[0]==0x55)||(UART_RX_Buffer_temp[0]==0x66))&&(UART_RX_Buffer_temp[1]==0xAA)&&((UART_RX_Buffer_temp[2]==0x00)||(UART_RX_Buffer_temp[2]==0x01)))
     {
-        memset(UART_RX_Buffer,0,sizeof(UART_RX_Buffer));
         memcpy(UART_RX_Buffer,UART_RX_Buffer_temp,3);
         memset(UART_RX_Buffer_temp,0,3);
         UART_RX_Count = 3;
+        uart_data_len = UART_RX_HEAD_LEN - 3;
         current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_HEAD;
-        uart_data_len = 0;
-        return ret;
-    }
-
-    switch(current_uart_rev_state_type)
-    {
-    case TUYA_BLE_UART_REV_STATE_FOUND_NULL:
-        break;
-    case TUYA_BLE_UART_REV_STATE_FOUND_HEAD:
-        UART_RX_Buffer[UART_RX_Count++] = data;
-        current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_CMD;
-        break;
-    case TUYA_BLE_UART_REV_STATE_FOUND_CMD:
-        UART_RX_Buffer[UART_RX_Count++] = data;
-        current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_LEN_H;
-        break;
-    case TUYA_BLE_UART_REV_STATE_FOUND_LEN_H:
-        UART_RX_Buffer[UART_RX_Count++] = data;
-        uart_data_len = (UART_RX_Buffer[UART_RX_Count-2]<<8)|UART_RX_Buffer[UART_RX_Count-1];
-        if(uart_data_len>UART_RX_DATA_LEN_MAX)
-        {
-            memset(UART_RX_Buffer_temp,0,3);
-            memset(UART_RX_Buffer,0,sizeof(UART_RX_Buffer));
-            UART_RX_Count = 0;
-            current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_NULL;
-            uart_data_len = 0;
-        }
-        else if(uart_data_len>0)
-        {
-            current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_LEN_L;
-        }
-        else
-        {
-            current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_DATA;
-        }
-        break;
-    case TUYA_BLE_UART_REV_STATE_FOUND_LEN_L:
-        UART_RX_Buffer[UART_RX_Count++] = data;   //DATA
-        uart_data_len--;
-        if(uart_data_len==0)
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Consume a span of the uart stream. The data and the sum are copied in one go
+ * once the span is known to hold no header. Stops right after a complete frame.
+ *
+ * return the number of bytes consumed, *p_done tells a frame is in UART_RX_Buffer.
+ * */
+static uint16_t tuya_ble_common_uart_data_unpack(const uint8_t *p_data,uint16_t len,bool *p_done)
+{
+    uint16_t i = 0;
+    uint16_t j;
+    uint16_t copy_len;
+
+    *p_done = false;
+
+    while(i<len)
+    {
+        switch(current_uart_rev_state_type)
         {
-            current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_DATA;
-        }
-        break;
-    case TUYA_BLE_UART_REV_STATE_FOUND_DATA:
-        UART_RX_Buffer[UART_RX_Count++] = data;  //sum data
-        ret = true;
-        break;
-    default:
-        memset(UART_RX_Buffer_temp,0,3);
-        memset(UART_RX_Buffer,0,sizeof(UART_RX_Buffer));
-        UART_RX_Count = 0;
-        current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_NULL;
-        uart_data_len = 0;
-        break;
-    };
+        case TUYA_BLE_UART_REV_STATE_FOUND_NULL:
+            while(i<len)
+            {
+                if(tuya_ble_common_uart_head_shift(p_data[i++]))
+                {
+                    break;
+                }
+            }
+            break;
 
-    return ret;
+        case TUYA_BLE_UART_REV_STATE_FOUND_HEAD:
+            if(tuya_ble_common_uart_head_shift(p_data[i]))
+            {
+                i++;
+                break;
+            }
+            UART_RX_Buffer[UART_RX_Count++] = p_data[i++];
+            uart_data_len--;
+            if(uart_data_len==0)
+            {
+                uart_data_len = (UART_RX_Buffer[4]<<8)|UART_RX_Buffer[5];
+                if(uart_data_len>UART_RX_DATA_LEN_MAX)
+                {
+                    tuya_ble_common_uart_data_unpack_reset();
+                }
+                else
+                {
+                    //data and sum
+                    uart_data_len += 1;
+                    current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_DATA;
+                }
+            }
+            break;
 
+        case TUYA_BLE_UART_REV_STATE_FOUND_DATA:
+            copy_len = ((len-i)<uart_data_len) ? (len-i) : uart_data_len;
+            for(j=0; j<copy_len; j++)
+            {
+                if(tuya_ble_common_uart_head_shift(p_data[i+j]))
+                {
+                    break;
+                }
+            }
+            if(j<copy_len)
+            {
+                i += j+1;
+                break;
+            }
+            memcpy(&UART_RX_Buffer[UART_RX_Count],&p_data[i],copy_len);
+            UART_RX_Count += copy_len;
+            uart_data_len -= copy_len;
+            i += copy_len;
+            if(uart_data_len==0)
+            {
+                *p_done = true;
+                return i;
+            }
+            break;
+
+        default:
+            tuya_ble_common_uart_data_unpack_reset();
+            break;
+        };
+    }
+
+    return i;
 }
 
 tuya_ble_status_t tuya_ble_common_uart_receive_data(uint8_t *p_data,uint16_t len)
@@ -281,48 +322,50 @@ tuya_ble_status_t tuya_ble_common_uart_receive_data(uint8_t *p_data,uint16_t len
     tuya_ble_status_t ret = TUYA_BLE_ERR_NOT_FOUND;
     tuya_ble_evt_param_t event;
     uint8_t* uart_evt_buffer;
-    uint16_t i;
+    uint16_t used_len;
+    bool done;
 
-    for(i=0; i<len; i++)
+    while(len>0)
     {
-        if(tuya_ble_common_uart_data_unpack(p_data[i]))
+        used_len = tuya_ble_common_uart_data_unpack(p_data,len,&done);
+        p_data += used_len;
+        len -= used_len;
+
+        if(!done)
         {
+            continue;
+        }
 
-            uart_evt_buffer=(uint8_t*)tuya_ble_malloc(UART_RX_Count);
+        //the sum is checked by tuya_ble_handle_uart_cmd_evt, some production test frames go without
+        uart_evt_buffer=(uint8_t*)tuya_ble_malloc(UART_RX_Count);
 
-            if(uart_evt_buffer==NULL)
-            {
-                TUYA_BLE_LOG_ERROR("tuya_MemGet uart evt buffer fail.");
-                ret = TUYA_BLE_ERR_NO_MEM;
-            }
-            else
-            {
-                event.hdr.event = TUYA_BLE_EVT_UART_CMD;
+        if(uart_evt_buffer==NULL)
+        {
+            TUYA_BLE_LOG_ERROR("tuya_MemGet uart evt buffer fail.");
+            ret = TUYA_BLE_ERR_NO_MEM;
+        }
+        else
+        {
+            event.hdr.event = TUYA_BLE_EVT_UART_CMD;
 
-                event.uart_cmd_data.data_len = UART_RX_Count;
+            event.uart_cmd_data.data_len = UART_RX_Count;
 
-                event.uart_cmd_data.p_data = uart_evt_buffer;
+            event.uart_cmd_data.p_data = uart_evt_buffer;
 
-                memcpy(event.uart_cmd_data.p_data,&UART_RX_Buffer[0],event.uart_cmd_data.data_len);
+            memcpy(event.uart_cmd_data.p_data,&UART_RX_Buffer[0],event.uart_cmd_data.data_len);
 
-                if(tuya_ble_event_send(&event)!=0)
-                {
-                    TUYA_BLE_LOG_ERROR("tuya_event_send uart data error.");
-                    tuya_ble_free(uart_evt_buffer);
-                    ret = TUYA_BLE_ERR_BUSY;
-                }
-                else
-                {
-                    ret = TUYA_BLE_SUCCESS;
-                }
+            if(tuya_ble_event_send(&event)!=0)
+            {
+                TUYA_BLE_LOG_ERROR("tuya_event_send uart data error.");
+                tuya_ble_free(uart_evt_buffer);
+                ret = TUYA_BLE_ERR_BUSY;
+            }
+            else
+            {
+                ret = TUYA_BLE_SUCCESS;
             }
-            memset(UART_RX_Buffer_temp,0,3);
-            memset(UART_RX_Buffer,0,sizeof(UART_RX_Buffer));
-            UART_RX_Count = 0;
-            current_uart_rev_state_type = TUYA_BLE_UART_REV_STATE_FOUND_NULL;
-            uart_data_len = 0;
-
         }
+        tuya_ble_common_uart_data_unpack_reset();
     }
 
     return ret;
@@ -505,6 +548,8 @@ tuya_ble_status_t tuya_ble_device_update_bound_state(uint8_t state)
 }
 
 
+static uint32_t tuya_ble_dp_report_seq = 0;
+
 /*
  *@brief
  *@param
@@ -517,7 +562,6 @@ tuya_ble_status_t tuya_ble_dp_data_report(uint8_t *p_data,uint32_t len)
     tuya_ble_evt_param_t evt;
     uint8_t *ble_evt_buffer;
     mtp_ret ret;
-    klv_node_s *list = NULL;
 
     if(tuya_ble_connect_status_get()!=BONDING_CONN)
     {
@@ -529,12 +573,11 @@ tuya_ble_status_t tuya_ble_dp_data_report(uint8_t *p_data,uint32_t len)
 		TUYA_BLE_LOG_ERROR("report dp data len error,data len = %d , max data len = %d",len,TUYA_BLE_REPORT_MAX_DP_DATA_LEN);
         return TUYA_BLE_ERR_INVALID_LENGTH;
     }
-    ret = data_2_klvlist(p_data,len,&list,0);
+    ret = klv_data_check(p_data,len,0);
     if(MTP_OK != ret)
     {
         return TUYA_BLE_ERR_INVALID_PARAM;
     }
-    free_klv_list(list);
 
     ble_evt_buffer=(uint8_t *)tuya_ble_malloc(len);
     if(ble_evt_buffer==NULL)
@@ -549,16 +592,28 @@ tuya_ble_status_t tuya_ble_dp_data_report(uint8_t *p_data,uint32_t len)
     evt.hdr.event = TUYA_BLE_EVT_DP_DATA_REPORTED;
     evt.reported_data.p_data = ble_evt_buffer;
     evt.reported_data.data_len = len;
+    evt.reported_data.seq = tuya_ble_dp_report_seq + 1;
 
     if(tuya_ble_event_send(&evt)!=0)
     {
         tuya_ble_free(ble_evt_buffer);
         return TUYA_BLE_ERR_NO_EVENT;
     }
+    tuya_ble_dp_report_seq++;
 
     return TUYA_BLE_SUCCESS;
 }
 
+/*
+ *@brief    sequence number of the last dp report queued, the first one is 1
+ *@note     the response to a report carries its sequence number, see tuya_ble_dp_data_report_response_t
+ *
+ * */
+uint32_t tuya_ble_dp_data_report_seq_get(void)
+{
+    return tuya_ble_dp_report_seq;
+}
+
 /*
  *@brief
  *@param
@@ -572,7 +627,6 @@ tuya_ble_status_t tuya_ble_dp_data_with_time_report(uint32_t timestamp,uint8_t *
     tuya_ble_evt_param_t evt;
     uint8_t *ble_evt_buffer;
     mtp_ret ret;
-    klv_node_s *list = NULL;
 
     if(tuya_ble_connect_status_get()!=BONDING_CONN)
     {
@@ -583,12 +637,11 @@ tuya_ble_status_t tuya_ble_dp_data_with_time_report(uint32_t timestamp,uint8_t *
     {
         return TUYA_BLE_ERR_INVALID_LENGTH;
     }
-    ret = data_2_klvlist(p_data,len,&list,0);
+    ret = klv_data_check(p_data,len,0);
     if(MTP_OK != ret)
     {
         return TUYA_BLE_ERR_INVALID_PARAM;
     }
-    free_klv_list(list);
     ble_evt_buffer=(uint8_t *)tuya_ble_malloc(len);
     if(ble_evt_buffer==NULL)
     {
@@ -627,7 +680,6 @@ tuya_ble_status_t tuya_ble_dp_data_with_time_ms_string_report(uint8_t *time_stri
     tuya_ble_evt_param_t evt;
     uint8_t *ble_evt_buffer;
     mtp_ret ret;
-    klv_node_s *list = NULL;
 
     if(tuya_ble_connect_status_get()!=BONDING_CONN)
     {
@@ -638,12 +690,11 @@ tuya_ble_status_t tuya_ble_dp_data_with_time_ms_string_report(uint8_t *time_stri
     {
         return TUYA_BLE_ERR_INVALID_LENGTH;
     }
-    ret = data_2_klvlist(p_data,len,&list,0);
+    ret = klv_data_check(p_data,len,0);
     if(MTP_OK != ret)
     {
         return TUYA_BLE_ERR_INVALID_PARAM;
     }
-    free_klv_list(list);
     ble_evt_buffer=(uint8_t *)tuya_ble_malloc(len);
     if(ble_evt_buffer==NULL)
     {
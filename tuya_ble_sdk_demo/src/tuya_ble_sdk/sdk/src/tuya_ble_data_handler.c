@@ -51,7 +51,6 @@ static uint32_t tuya_ble_mcu_hardware_version = 0;
 static  tuya_ble_r_air_recv_packet  air_recv_packet;  
 
 static frm_trsmitr_proc_s ty_trsmitr_proc;
-static frm_trsmitr_proc_s ty_trsmitr_proc_send;
 
 uint8_t tuya_ble_pair_rand[6] = {0};
 uint8_t tuya_ble_pair_rand_valid = 0;
@@ -59,6 +58,14 @@ uint8_t tuya_ble_pair_rand_valid = 0;
 static uint32_t tuya_ble_receive_sn = 0;
 static uint32_t tuya_ble_send_sn = 1;
 
+//the frame sn of the last dp reports, the response to a report acks its frame sn
+#define TUYA_BLE_DP_REPORT_SN_NUM   8
+static struct {
+    uint32_t sn;
+    uint32_t seq;
+} tuya_ble_dp_report_sn[TUYA_BLE_DP_REPORT_SN_NUM];
+static uint8_t tuya_ble_dp_report_sn_idx = 0;
+
 
 tuya_ble_ota_status_t tuya_ble_ota_status;
 
@@ -85,6 +92,8 @@ void tuya_ble_reset_ble_sn(void)
     tuya_ble_receive_sn = 0;
     tuya_ble_send_sn = 1;
     tuya_ble_device_exit_critical();
+    //the sn are used again, reports of an earlier link are never answered
+    memset(tuya_ble_dp_report_sn,0,sizeof(tuya_ble_dp_report_sn));
 }
 
 
@@ -145,6 +154,32 @@ static bool buffer_value_is_all_x(uint8_t *buffer,uint16_t len,uint8_t value)
     return ret;
 }
 
+#if (TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS > 0)
+static tuya_ble_timer_t air_recv_timer = NULL;
+static uint32_t air_recv_subpkg_cnt = 0;
+
+static void tuya_ble_air_recv_stale_handler(int32_t evt_id,void *data)
+{
+    // a sub package came after the timeout was posted, the frame is alive
+    if((air_recv_packet.recv_data)&&((uint32_t)evt_id == air_recv_subpkg_cnt))
+    {
+        TUYA_BLE_LOG_ERROR("ble_data_unpack frame timeout,[%d] of [%d] received.",air_recv_packet.recv_len,air_recv_packet.recv_len_max);
+        tuya_ble_air_recv_packet_free();
+    }
+}
+
+static void tuya_ble_air_recv_timer_callback(tuya_ble_timer_t timer)
+{
+    tuya_ble_custom_evt_t custom_evt;
+
+    // the frame is dropped in the main process, not in the timer context
+    custom_evt.evt_id = air_recv_subpkg_cnt;
+    custom_evt.data = NULL;
+    custom_evt.custom_event_handler = tuya_ble_air_recv_stale_handler;
+    tuya_ble_custom_event_send(custom_evt);
+}
+#endif
+
 void tuya_ble_air_recv_packet_free(void)
 {
     if(air_recv_packet.recv_data)
@@ -154,86 +189,142 @@ void tuya_ble_air_recv_packet_free(void)
         air_recv_packet.recv_len_max = 0;
         air_recv_packet.recv_len = 0;
     }
+    // sub packages of the dropped frame are refused until the next first one
+    trsmitr_init(&ty_trsmitr_proc);
+#if (TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS > 0)
+    if(air_recv_timer)
+    {
+        tuya_ble_timer_stop(air_recv_timer);
+    }
+#endif
+}
+
+/*
+ * everything the first sub package tells is checked before the frame buffer is taken,
+ * the frame is | encryption mode | iv(16, not for ENCRYPTION_MODE_NONE) | data(n*16) |
+ */
+static uint8_t ble_data_frame_head_check(uint32_t total_len,uint8_t *head,uint8_t head_len)
+{
+    if((total_len>TUYA_BLE_AIR_FRAME_MAX)||(total_len==0)||(head_len==0))
+    {
+        TUYA_BLE_LOG_ERROR("ble_data_unpack total size [%d ]error.",total_len);
+        return 1;
+    }
+
+    if(ty_trsmitr_proc.version<2)  //协议主版本号低于2，不解析，返回。
+    {
+        TUYA_BLE_LOG_ERROR("ty_ble_rx_proc version not compatibility!");
+        return 1;
+    }
+
+    if(head[0]>=ENCRYPTION_MODE_MAX)
+    {
+        TUYA_BLE_LOG_ERROR("ble_data_unpack encryption mode [%d] error.",head[0]);
+        return 1;
+    }
+
+    if(tuya_ble_current_para.sys_settings.bound_flag==1)//当前已绑定状态
+    {
+        if(ENCRYPTION_MODE_NONE==head[0])
+        {
+            TUYA_BLE_LOG_ERROR("ty_ble_rx_proc data encryption mode error since bound_flag = 1.");
+            return 1;
+        }
+    }
+
+    if((ENCRYPTION_MODE_NONE!=head[0])&&((total_len<=17)||((total_len-17)%16!=0)))
+    {
+        TUYA_BLE_LOG_ERROR("ble_data_unpack encrypted size [%d] error.",total_len);
+        return 1;
+    }
+
+    return 0;
 }
 
 static uint32_t ble_data_unpack(uint8_t *buf,uint32_t len)
 {
-    static uint32_t offset = 0;
     mtp_ret ret;
+    uint8_t subpkg_len;
 
     ret = trsmitr_recv_pkg_decode(&ty_trsmitr_proc, buf, len);
     if(MTP_OK != ret && MTP_TRSMITR_CONTINUE != ret)
     {
-        air_recv_packet.recv_len_max = 0;
-        air_recv_packet.recv_len = 0;
-        if(air_recv_packet.recv_data)
-        {
-            tuya_ble_free(air_recv_packet.recv_data);
-            air_recv_packet.recv_data = NULL;
-        }
-        
+        TUYA_BLE_LOG_ERROR("ble_data_unpack decode error [%d].",ret);
+        tuya_ble_air_recv_packet_free();
         return 1;
     }
 
-    if(FRM_PKG_FIRST == ty_trsmitr_proc.pkg_desc)
-    {
+    subpkg_len = get_trsmitr_subpkg_len(&ty_trsmitr_proc);
+
+    if(0 == ty_trsmitr_proc.subpkg_num)
+    {   // a new frame, the one in progress is given up
         if(air_recv_packet.recv_data)
         {
             tuya_ble_free(air_recv_packet.recv_data);
             air_recv_packet.recv_data = NULL;
         }
+        air_recv_packet.recv_len = 0;
         air_recv_packet.recv_len_max = get_trsmitr_frame_total_len(&ty_trsmitr_proc);
-        if((air_recv_packet.recv_len_max>TUYA_BLE_AIR_FRAME_MAX)||(air_recv_packet.recv_len_max==0))
+        if(ble_data_frame_head_check(air_recv_packet.recv_len_max,get_trsmitr_subpkg(&ty_trsmitr_proc),subpkg_len))
         {
-            air_recv_packet.recv_len_max = 0;
-            air_recv_packet.recv_len = 0;
-            TUYA_BLE_LOG_ERROR("ble_data_unpack total size [%d ]error.",air_recv_packet.recv_len_max);
+            tuya_ble_air_recv_packet_free();
             return 2;
         }
-        air_recv_packet.recv_len = 0;
         air_recv_packet.recv_data = tuya_ble_malloc(air_recv_packet.recv_len_max);
         if(air_recv_packet.recv_data==NULL)
         {
             TUYA_BLE_LOG_ERROR("ble_data_unpack malloc failed.");
+            tuya_ble_air_recv_packet_free();
             return 2;
         }
-        memset(air_recv_packet.recv_data,0,air_recv_packet.recv_len_max);
-        offset = 0;
     }
-    if((offset+get_trsmitr_subpkg_len(&ty_trsmitr_proc))<=air_recv_packet.recv_len_max)
+
+    if(air_recv_packet.recv_data==NULL)
     {
-        if(air_recv_packet.recv_data)
-        {
-            memcpy(air_recv_packet.recv_data+offset,get_trsmitr_subpkg(&ty_trsmitr_proc),get_trsmitr_subpkg_len(&ty_trsmitr_proc));
-            offset += get_trsmitr_subpkg_len(&ty_trsmitr_proc);
-            air_recv_packet.recv_len = offset;
-        }
-        else
-        {
-            TUYA_BLE_LOG_ERROR("ble_data_unpack error.");
-            air_recv_packet.recv_len_max = 0;
-            air_recv_packet.recv_len = 0;
-            return 2;
-        }
+        TUYA_BLE_LOG_ERROR("ble_data_unpack error.");
+        tuya_ble_air_recv_packet_free();
+        return 2;
     }
-    else
+
+    if((air_recv_packet.recv_len+subpkg_len)>air_recv_packet.recv_len_max)
     {
-        ret = MTP_INVALID_PARAM;
-        TUYA_BLE_LOG_ERROR("ble_data_unpack[%d] error:MTP_INVALID_PARAM");
+        TUYA_BLE_LOG_ERROR("ble_data_unpack[%d] error:MTP_INVALID_PARAM",air_recv_packet.recv_len);
         tuya_ble_air_recv_packet_free();
+        return 2;
     }
 
+    memcpy(air_recv_packet.recv_data+air_recv_packet.recv_len,get_trsmitr_subpkg(&ty_trsmitr_proc),subpkg_len);
+    air_recv_packet.recv_len += subpkg_len;
+
     if(ret == MTP_OK)
     {
-        offset=0;
+#if (TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS > 0)
+        if(air_recv_timer)
+        {
+            tuya_ble_timer_stop(air_recv_timer);
+        }
+#endif
         TUYA_BLE_LOG_DEBUG("ble_data_unpack[%d]",air_recv_packet.recv_len);
 
         return 0;
     }
-    else
+
+#if (TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS > 0)
+    air_recv_subpkg_cnt++;
+    if(air_recv_timer==NULL)
     {
-        return 2;
+        if(tuya_ble_timer_create(&air_recv_timer,TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS,TUYA_BLE_TIMER_SINGLE_SHOT,tuya_ble_air_recv_timer_callback) != TUYA_BLE_SUCCESS)
+        {
+            TUYA_BLE_LOG_ERROR("air_recv_timer creat failed");
+            air_recv_timer = NULL;
+        }
+    }
+    if(air_recv_timer)
+    {
+        tuya_ble_timer_restart(air_recv_timer,TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS);
     }
+#endif
+    return 2;
 }
 
 static uint8_t ble_cmd_data_crc_check(uint8_t *input,uint16_t len)
@@ -279,31 +370,7 @@ void tuya_ble_commonData_rx_proc(uint8_t *buf,uint16_t len)
         return;      //
     }
 
-    if(air_recv_packet.recv_len>TUYA_BLE_AIR_FRAME_MAX)
-    {
-        TUYA_BLE_LOG_ERROR("air_recv_packet.recv_len bigger than TUYA_BLE_AIR_FRAME_MAX.");
-        tuya_ble_air_recv_packet_free();
-        return;
-    }
-
-    if(ty_trsmitr_proc.version<2)  //协议主版本号低于2，不解析，返回。
-    {
-        TUYA_BLE_LOG_ERROR("ty_ble_rx_proc version not compatibility!");
-        tuya_ble_air_recv_packet_free();
-        return;
-    }
-
-
-    if(tuya_ble_current_para.sys_settings.bound_flag==1)//当前已绑定状态
-    {
-        if(ENCRYPTION_MODE_NONE==air_recv_packet.recv_data[0])
-        {
-            TUYA_BLE_LOG_ERROR("ty_ble_rx_proc data encryption mode error since bound_flag = 1.");
-            tuya_ble_air_recv_packet_free();
-            return;
-        }
-    }
-
+    // size, version and encryption mode were checked on the first sub package
     current_encry_mode = air_recv_packet.recv_data[0];
 
     TUYA_BLE_LOG_HEXDUMP_DEBUG("received encry data",(uint8_t*)air_recv_packet.recv_data,air_recv_packet.recv_len);//
@@ -1173,7 +1240,6 @@ static void tuya_ble_handle_unix_time_date_resp(uint8_t*recv_data,uint16_t recv_
 static void tuya_ble_handle_dp_write_req(uint8_t*recv_data,uint16_t recv_len)
 {
     mtp_ret ret;
-    klv_node_s *list = NULL;
     uint8_t p_buf[1];
     uint16_t data_len = 0;
     uint32_t ack_sn = 0;
@@ -1194,7 +1260,7 @@ static void tuya_ble_handle_dp_write_req(uint8_t*recv_data,uint16_t recv_len)
         return;
     }
     TUYA_BLE_LOG_HEXDUMP_DEBUG("cmd_dp_write data : ",recv_data+13,data_len);
-    ret = data_2_klvlist(&recv_data[13],data_len,&list,0);
+    ret = klv_data_check(&recv_data[13],data_len,0);
     if(MTP_OK != ret)
     {
         TUYA_BLE_LOG_ERROR("cmd rx fail-%d",ret);
@@ -1203,7 +1269,6 @@ static void tuya_ble_handle_dp_write_req(uint8_t*recv_data,uint16_t recv_len)
         return;
     }
 
-    free_klv_list(list);
     p_buf[0] = 0x00;
 
     tuya_ble_commData_send(FRM_CMD_RESP,ack_sn,p_buf,1,ENCRYPTION_MODE_SESSION_KEY);
@@ -1444,12 +1509,31 @@ static void tuya_ble_handle_device_reset_req(uint8_t*recv_data,uint16_t recv_len
 #endif
 }
 
+static uint32_t tuya_ble_dp_report_seq_find(uint32_t sn)
+{
+    for(uint8_t i=0; i<TUYA_BLE_DP_REPORT_SN_NUM; i++)
+    {
+        if((tuya_ble_dp_report_sn[i].seq != 0) && (tuya_ble_dp_report_sn[i].sn == sn))
+        {
+            return tuya_ble_dp_report_sn[i].seq;
+        }
+    }
+    return 0;
+}
+
 static void tuya_ble_handle_dp_data_report_res(uint8_t*recv_data,uint16_t recv_len)
 {
     tuya_ble_cb_evt_param_t event;
+    uint32_t ack_sn;
+
+    ack_sn  = recv_data[5]<<24;
+    ack_sn += recv_data[6]<<16;
+    ack_sn += recv_data[7]<<8;
+    ack_sn += recv_data[8];
 
     event.evt = TUYA_BLE_CB_EVT_DP_DATA_REPORT_RESPONSE;
     event.dp_response_data.status = recv_data[13];
+    event.dp_response_data.seq = tuya_ble_dp_report_seq_find(ack_sn);
 
     if(tuya_ble_cb_event_send(&event)!=0)
     {
@@ -1547,18 +1631,11 @@ void tuya_ble_evt_process(uint16_t cmd,uint8_t*recv_data,uint32_t recv_len)
 
 uint8_t tuya_ble_commData_send(uint16_t cmd,uint32_t ack_sn,uint8_t *data,uint16_t len,uint8_t encryption_mode)
 {
-    mtp_ret ret;
-    uint8_t send_len = 0;
-    uint8_t p_buf[20];
-    uint32_t err=0;
-    int8_t retries_cnt = 0;
     uint8_t iv[16];
-    uint16_t rand_value = 0,i=0;
     uint16_t crc16 = 0;
     uint16_t en_len  = 0;
     uint32_t out_len = 0;
     uint32_t temp_len = 0;
-	uint32_t package_number = 0;
     tuya_ble_r_air_send_packet  air_send_packet;
     
     memset(&air_send_packet,0,sizeof(air_send_packet));
@@ -1579,12 +1656,7 @@ uint8_t tuya_ble_commData_send(uint16_t cmd,uint32_t ack_sn,uint8_t *data,uint16
     //生成随机IV
     if(encryption_mode != ENCRYPTION_MODE_NONE)
     {
-        for(i=0; i<16; i+=2)
-        {
-            rand_value = rand();
-            iv[i+0] = rand_value>>8;
-            iv[i+1] = rand_value;
-        }
+        tuya_ble_rand_generator(iv,16);
         en_len = 17;
     }
     else
@@ -1709,29 +1781,37 @@ uint8_t tuya_ble_commData_send(uint16_t cmd,uint32_t ack_sn,uint8_t *data,uint16
     }
     
     tuya_ble_free(air_send_packet.send_data);
-    package_number = 0;
-    trsmitr_init(&ty_trsmitr_proc_send);
-    do
-    {
-        ret = trsmitr_send_pkg_encode(&ty_trsmitr_proc_send,TUYA_BLE_PROTOCOL_VERSION_HIGN,(uint8_t *)(air_send_packet.encrypt_data_buf), air_send_packet.encrypt_data_buf_len);
-        if (MTP_OK != ret && MTP_TRSMITR_CONTINUE != ret)
-        {
-            tuya_ble_free(air_send_packet.encrypt_data_buf);  
-            return 1;
-        }
-        send_len = get_trsmitr_subpkg_len(&ty_trsmitr_proc_send);
-        memcpy(p_buf,get_trsmitr_subpkg(&ty_trsmitr_proc_send),send_len);
-		package_number++;
-		tuya_ble_gatt_send_data_enqueue(p_buf,send_len);
-        
-    } while (ret == MTP_TRSMITR_CONTINUE);
 
-    TUYA_BLE_LOG_INFO("ble_commData_send len = %d , package_number = %d , protocol version : 0x%02x , error code : 0x%02x",air_send_packet.encrypt_data_buf_len,package_number,TUYA_BLE_PROTOCOL_VERSION_HIGN,err);
+    //the queue owns encrypt_data_buf from here and cuts it into sub packages at send time
+    if(tuya_ble_gatt_send_frame_enqueue(air_send_packet.encrypt_data_buf,air_send_packet.encrypt_data_buf_len) != TUYA_BLE_SUCCESS)
+    {
+        TUYA_BLE_LOG_ERROR("ble_commData_send enqueue failed.");
+        return 3;
+    }
 
-    tuya_ble_free(air_send_packet.encrypt_data_buf);  
+    TUYA_BLE_LOG_INFO("ble_commData_send len = %d , protocol version : 0x%02x",air_send_packet.encrypt_data_buf_len,TUYA_BLE_PROTOCOL_VERSION_HIGN);
 
     return 0;
 }
 
+/*
+ *@brief    send a dp report and keep the sn of its frame
+ *@param    seq - tuya_ble_dp_data_reported_t.seq
+ *
+ * */
+uint8_t tuya_ble_dp_data_report_send(uint32_t seq,uint8_t *data,uint16_t len,uint8_t encryption_mode)
+{
+    uint8_t ret = tuya_ble_commData_send(FRM_STAT_REPORT,0,data,len,encryption_mode);
+
+    if(ret == 0)
+    {
+        //the frame took the last sn
+        tuya_ble_dp_report_sn[tuya_ble_dp_report_sn_idx].sn = tuya_ble_send_sn - 1;
+        tuya_ble_dp_report_sn[tuya_ble_dp_report_sn_idx].seq = seq;
+        tuya_ble_dp_report_sn_idx = (tuya_ble_dp_report_sn_idx + 1) % TUYA_BLE_DP_REPORT_SN_NUM;
+    }
+    return ret;
+}
+
 
 
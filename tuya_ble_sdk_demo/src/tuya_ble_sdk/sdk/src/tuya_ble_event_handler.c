@@ -31,6 +31,7 @@
 #include "tuya_ble_main.h"
 #include "tuya_ble_secure.h"
 #include "tuya_ble_data_handler.h"
+#include "tuya_ble_gatt_send_queue.h"
 #include "tuya_ble_storage.h"
 #include "tuya_ble_sdk_version.h"
 #include "tuya_ble_event.h"
@@ -149,7 +150,7 @@ void tuya_ble_handle_dp_data_reported_evt(tuya_ble_evt_param_t *evt)
     {
         encry_mode = ENCRYPTION_MODE_KEY_4;
     }
-    tuya_ble_commData_send(FRM_STAT_REPORT,0,evt->reported_data.p_data,evt->reported_data.data_len,encry_mode);
+    tuya_ble_dp_data_report_send(evt->reported_data.seq,evt->reported_data.p_data,evt->reported_data.data_len,encry_mode);
 
     if(evt->reported_data.p_data)
     {
@@ -353,7 +354,7 @@ void tuya_ble_handle_data_prod_test_response_evt(tuya_ble_evt_param_t *evt)
 
     if(evt->prod_test_res_data.channel==0)
     {
-        tuya_ble_common_uart_send_data(evt->prod_test_res_data.p_data,evt->prod_test_res_data.data_len);
+        tuya_ble_uart_common_send_data(evt->prod_test_res_data.p_data,evt->prod_test_res_data.data_len);
     }
     else if(evt->prod_test_res_data.channel==1)
     {
@@ -600,6 +601,9 @@ void tuya_ble_handle_connect_change_evt(tuya_ble_evt_param_t *evt)
         {
             tuya_ble_connect_status_set(UNBONDING_UNCONN);
         }
+        
+        //no tx complete comes for a notification lost with the link
+        tuya_ble_gatt_send_tx_complete();
     }
     else
     {
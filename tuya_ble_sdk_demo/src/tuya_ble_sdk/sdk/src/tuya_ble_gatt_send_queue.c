@@ -31,14 +31,34 @@
 #include "tuya_ble_main.h"
 #include "tuya_ble_log.h"
 
+#include "tuya_ble_internal_config.h"
+#include "tuya_ble_mutli_tsf_protocol.h"
+
+/* the queue holds whole encoded frames, each one is cut into sub packages
+ * only when the link can take the next one, straight from the frame buffer */
 static tuya_ble_queue_t gatt_send_queue;
 static tuya_ble_gatt_send_data_t send_buf[TUYA_BLE_GATT_SEND_DATA_QUEUE_SIZE];
 
+static frm_trsmitr_proc_s gatt_send_trsmitr;
+static uint8_t gatt_subpkg_pending = 0;  //sub package encoded but not accepted by the link yet
+static uint8_t gatt_subpkg_last = 0;     //it is the last one of the head frame
+
 static uint8_t gatt_queue_flag = 0;
+static uint8_t gatt_wait_tx_complete = 0;  //the link was busy, the next tx complete resumes sending
+static uint8_t gatt_send_running = 0;      //keeps tx complete from re-entering the send loop
+
+#if !TUYA_BLE_GATT_SEND_ON_TX_COMPLETE
+static tuya_ble_timer_t gatt_retry_timer = NULL;  //polls the link again when the event queue was full
+#endif
 
 void tuya_ble_gatt_send_queue_init(void)
 {
 	gatt_queue_flag = 0;
+	gatt_wait_tx_complete = 0;
+	gatt_send_running = 0;
+	gatt_subpkg_pending = 0;
+	gatt_subpkg_last = 0;
+	trsmitr_init(&gatt_send_trsmitr);
     tuya_ble_queue_init(&gatt_send_queue, (void*) send_buf, TUYA_BLE_GATT_SEND_DATA_QUEUE_SIZE, sizeof(tuya_ble_gatt_send_data_t));
 }
 
@@ -54,14 +74,71 @@ static void tuya_ble_gatt_send_queue_free(void)
 		 }
 		 memset(&data,0,sizeof(tuya_ble_gatt_send_data_t));
 	 }	
+	 gatt_subpkg_pending = 0;
+	 gatt_subpkg_last = 0;
+	 gatt_wait_tx_complete = 0;
+	 trsmitr_init(&gatt_send_trsmitr);
+#if !TUYA_BLE_GATT_SEND_ON_TX_COMPLETE
+	 if(gatt_retry_timer)
+	 {
+		 tuya_ble_timer_stop(gatt_retry_timer);
+	 }
+#endif
+}
+
+#if !TUYA_BLE_GATT_SEND_ON_TX_COMPLETE
+static uint8_t tuya_ble_gatt_send_event_post(void)
+{
+	tuya_ble_evt_param_t event;
+
+	event.hdr.event = TUYA_BLE_EVT_GATT_SEND_DATA;
+	event.hdr.event_handler = tuya_ble_gatt_send_data_handle;
+	return tuya_ble_event_send(&event);
+}
+
+static void tuya_ble_gatt_send_retry_timer_callback(tuya_ble_timer_t timer)
+{
+	if(tuya_ble_gatt_send_event_post()!=0)
+	{
+		tuya_ble_timer_restart(gatt_retry_timer,TUYA_BLE_GATT_SEND_RETRY_MS);
+	}
+}
+
+/* the event queue is full, the frames stay queued and the link is polled again
+ * by the retry timer, or earlier by the next tx complete */
+static void tuya_ble_gatt_send_retry_later(void)
+{
+	gatt_wait_tx_complete = 1;
+	if(gatt_retry_timer==NULL)
+	{
+		if(tuya_ble_timer_create(&gatt_retry_timer,TUYA_BLE_GATT_SEND_RETRY_MS,TUYA_BLE_TIMER_SINGLE_SHOT,tuya_ble_gatt_send_retry_timer_callback) != TUYA_BLE_SUCCESS)
+		{
+			TUYA_BLE_LOG_ERROR("gatt_retry_timer creat failed");
+			gatt_retry_timer = NULL;
+			return;
+		}
+	}
+	tuya_ble_timer_restart(gatt_retry_timer,TUYA_BLE_GATT_SEND_RETRY_MS);
+}
+#endif
+
+static void tuya_ble_gatt_send_frame_done(tuya_ble_gatt_send_data_t *data)
+{
+	tuya_ble_free(data->buf);
+	tuya_ble_queue_decrease(&gatt_send_queue);
+	gatt_subpkg_pending = 0;
+	gatt_subpkg_last = 0;
+	trsmitr_init(&gatt_send_trsmitr);
 }
 
 void tuya_ble_gatt_send_data_handle(void *evt)
 {
 	tuya_ble_gatt_send_data_t data   = {0};
-	tuya_ble_evt_param_t event;
 	tuya_ble_connect_status_t currnet_connect_status;
+	mtp_ret ret;
 	
+	gatt_send_running = 1;
+	gatt_wait_tx_complete = 0;
 	while (tuya_ble_queue_get(&gatt_send_queue, &data) == TUYA_BLE_SUCCESS) 
 	{   
 		currnet_connect_status = tuya_ble_connect_status_get();
@@ -71,20 +148,38 @@ void tuya_ble_gatt_send_data_handle(void *evt)
 			break;
 		}
 		
-        if(tuya_ble_gatt_send_data(data.buf,data.size) == TUYA_BLE_SUCCESS)
+		if(gatt_subpkg_pending == 0)
+		{
+			ret = trsmitr_send_pkg_encode(&gatt_send_trsmitr,TUYA_BLE_PROTOCOL_VERSION_HIGN,data.buf,data.size);
+			if (MTP_OK != ret && MTP_TRSMITR_CONTINUE != ret)
+			{
+				TUYA_BLE_LOG_ERROR("gatt send frame encode error.");
+				tuya_ble_gatt_send_frame_done(&data);
+				continue;
+			}
+			gatt_subpkg_pending = 1;
+			gatt_subpkg_last = (ret == MTP_OK);
+		}
+		
+        if(tuya_ble_gatt_send_data(get_trsmitr_subpkg(&gatt_send_trsmitr),get_trsmitr_subpkg_len(&gatt_send_trsmitr)) == TUYA_BLE_SUCCESS)
         {
-			tuya_ble_free(data.buf);
-			tuya_ble_queue_decrease(&gatt_send_queue);
+			gatt_subpkg_pending = 0;
+			if(gatt_subpkg_last)
+			{
+				tuya_ble_gatt_send_frame_done(&data);
+			}
         }
 		else
 		{	  
-			event.hdr.event = TUYA_BLE_EVT_GATT_SEND_DATA;
-			event.hdr.event_handler = tuya_ble_gatt_send_data_handle;
-            if(tuya_ble_event_send(&event)!=0)
+#if TUYA_BLE_GATT_SEND_ON_TX_COMPLETE
+			gatt_wait_tx_complete = 1;
+#else
+            if(tuya_ble_gatt_send_event_post()!=0)
             {
-				tuya_ble_gatt_send_queue_free();
-				TUYA_BLE_LOG_ERROR("TUYA_BLE_EVT_GATT_SEND_DATA  error.");
+				TUYA_BLE_LOG_WARNING("TUYA_BLE_EVT_GATT_SEND_DATA busy, retry later.");
+				tuya_ble_gatt_send_retry_later();
             }
+#endif
 
 		    break;
 
@@ -95,41 +190,50 @@ void tuya_ble_gatt_send_data_handle(void *evt)
 		tuya_ble_queue_flush(&gatt_send_queue);
 		gatt_queue_flag = 0;	
 	}
-	
+	gatt_send_running = 0;
 }
 
+/* called by the port when the link took a notification, the next sub package goes
+ * out from here. the running flag keeps it out of an active send loop, so the depth
+ * is one pass even if a port completes synchronously. also called on disconnect,
+ * a waiting queue is dropped by that pass */
+void tuya_ble_gatt_send_tx_complete(void)
+{
+	if(gatt_wait_tx_complete && !gatt_send_running)
+	{
+		tuya_ble_gatt_send_data_handle(NULL);
+	}
+}
 
 
-tuya_ble_status_t tuya_ble_gatt_send_data_enqueue(uint8_t *p_data, uint8_t data_len)
+
+/* p_frame must come from tuya_ble_malloc, the queue frees it once sent or dropped */
+tuya_ble_status_t tuya_ble_gatt_send_frame_enqueue(uint8_t *p_frame, uint16_t frame_len)
 {
 	tuya_ble_gatt_send_data_t data   = {0};
 	
-	data.buf = tuya_ble_malloc(data_len);
-	
-	if(data.buf)
+	data.buf = p_frame;
+	data.size = frame_len;
+	if(tuya_ble_enqueue(&gatt_send_queue,&data)==TUYA_BLE_SUCCESS)
 	{
-		memcpy(data.buf,p_data,data_len);
-		data.size = data_len;
-		if(tuya_ble_enqueue(&gatt_send_queue,&data)==TUYA_BLE_SUCCESS)
-		{
-			if(gatt_queue_flag==0)
-			{
-				gatt_queue_flag = 1;
-				tuya_ble_gatt_send_data_handle(NULL);
-			}			
-			return TUYA_BLE_SUCCESS;
-		}
-	    else
+		if(gatt_queue_flag==0)
 		{
-			tuya_ble_free(data.buf);
-			return TUYA_BLE_ERR_NO_MEM;
-		}
+			gatt_queue_flag = 1;
+			tuya_ble_gatt_send_data_handle(NULL);
+		}			
+		return TUYA_BLE_SUCCESS;
 	}
 	else
 	{
+		tuya_ble_free(p_frame);
 		return TUYA_BLE_ERR_NO_MEM;
 	}
-	
+}
+
+/* frames waiting, the head one may be partly sent */
+uint8_t tuya_ble_gatt_send_queue_used(void)
+{
+	return tuya_ble_get_queue_used(&gatt_send_queue);
 }
 
 
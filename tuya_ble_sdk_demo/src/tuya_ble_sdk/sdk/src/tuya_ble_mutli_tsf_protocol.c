@@ -293,7 +293,7 @@ mtp_ret trsmitr_recv_pkg_decode(frm_trsmitr_proc_s *frm_trsmitr, uint8_t *raw_da
     uint8_t digit;
     frame_subpkg_num_t subpkg_num = 0;
 //Package number
-    for (i = 0; i < 4; i++) {
+    for (i = 0; i < 4 && sunpkg_offset < raw_data_len; i++) {
         digit = raw_data[sunpkg_offset++];
         subpkg_num += (digit & 0x7f) * multiplier;
         multiplier *= 0x80;
@@ -311,6 +311,10 @@ mtp_ret trsmitr_recv_pkg_decode(frm_trsmitr_proc_s *frm_trsmitr, uint8_t *raw_da
         frm_trsmitr->pkg_trsmitr_cnt = 0;
         frm_trsmitr->pkg_desc = FRM_PKG_FIRST;
     }
+    else if (FRM_PKG_INIT == frm_trsmitr->pkg_desc || FRM_PKG_END == frm_trsmitr->pkg_desc)
+    {   // no frame in progress, the first package was lost or dropped
+        return MTP_TRSMITR_ERROR;
+    }
     else
     {
         frm_trsmitr->pkg_desc = FRM_PKG_MIDDLE;
@@ -323,16 +327,15 @@ mtp_ret trsmitr_recv_pkg_decode(frm_trsmitr_proc_s *frm_trsmitr, uint8_t *raw_da
     // is receive the subpackage num valid?
     if (frm_trsmitr->pkg_desc != FRM_PKG_FIRST)
     {
-        if (subpkg_num < frm_trsmitr->subpkg_num)
-        {
-            return MTP_TRSMITR_ERROR;
-        }
-        else if (subpkg_num == frm_trsmitr->subpkg_num)
-        {
+        if (subpkg_num == frm_trsmitr->subpkg_num)
+        {   // repeated package, nothing new to take
+            frm_trsmitr->subpkg_len = 0;
             return MTP_TRSMITR_CONTINUE;
         }
-
-        if (subpkg_num - frm_trsmitr->subpkg_num > 1) {
+        else if (subpkg_num < frm_trsmitr->subpkg_num || \
+                subpkg_num - frm_trsmitr->subpkg_num > 1)
+        {   // lost or out of order, the frame can not be completed any more
+            frm_trsmitr->pkg_desc = FRM_PKG_INIT;
             return MTP_TRSMITR_ERROR;
         }
     }
@@ -342,7 +345,7 @@ mtp_ret trsmitr_recv_pkg_decode(frm_trsmitr_proc_s *frm_trsmitr, uint8_t *raw_da
     {
         // frame len decode
         multiplier = 1;
-        for (i = 0; i < 4; i++)
+        for (i = 0; i < 4 && sunpkg_offset < raw_data_len; i++)
         {
             digit = raw_data[sunpkg_offset++];
             frm_trsmitr->total += (digit & 0x7f) * multiplier;
@@ -354,8 +357,10 @@ mtp_ret trsmitr_recv_pkg_decode(frm_trsmitr_proc_s *frm_trsmitr, uint8_t *raw_da
             }
         }
 
-        if (frm_trsmitr->total >= 0x10000000)
+        if (0 == frm_trsmitr->total || frm_trsmitr->total >= 0x10000000 || \
+                sunpkg_offset >= raw_data_len)
         {
+            frm_trsmitr->pkg_desc = FRM_PKG_INIT;
             return MTP_COM_ERROR;
         }
 
@@ -364,6 +369,12 @@ mtp_ret trsmitr_recv_pkg_decode(frm_trsmitr_proc_s *frm_trsmitr, uint8_t *raw_da
         frm_trsmitr->seq = raw_data[sunpkg_offset++] & FRM_SEQ_OFFSET;
     }
 
+    if (sunpkg_offset > raw_data_len)
+    {
+        frm_trsmitr->pkg_desc = FRM_PKG_INIT;
+        return MTP_COM_ERROR;
+    }
+
     uint8_t recv_data = raw_data_len - sunpkg_offset;
     if((frm_trsmitr->total - frm_trsmitr->pkg_trsmitr_cnt) < recv_data)
     {
@@ -382,6 +393,185 @@ mtp_ret trsmitr_recv_pkg_decode(frm_trsmitr_proc_s *frm_trsmitr, uint8_t *raw_da
     frm_trsmitr->pkg_desc = FRM_PKG_END;
     return MTP_OK;
 }
+/***********************************************************
+*  Function: klv_head_len
+*  description: bytes in front of the data, id + type + len
+*  Input: type:0-data中len占1个字节，1-data中len占两个字节
+*  Output:
+*  Return:
+***********************************************************/
+static uint32_t klv_head_len(uint8_t type)
+{
+    return (1 == type) ? 4 : 3;
+}
+
+/***********************************************************
+*  Function: klv_type_len_check
+*  description: fixed length dp types must carry their length
+*  Input:
+*  Output:
+*  Return:
+***********************************************************/
+static mtp_ret klv_type_len_check(dp_type type,uint16_t len)
+{
+    if(type > DT_LMT) {
+        return MTP_INVALID_PARAM;
+    }
+
+    if(DT_VALUE == type && DT_VALUE_LEN != len) {
+        return MTP_INVALID_PARAM;
+    } else if(DT_BITMAP == type && (0 == len || len > DT_BITMAP_MAX)) {
+        return MTP_INVALID_PARAM;
+    } else if(DT_BOOL == type && DT_BOOL_LEN != len) {
+        return MTP_INVALID_PARAM;
+    } else if(DT_ENUM == type && DT_ENUM_LEN != len) {
+        return MTP_INVALID_PARAM;
+    }
+    return MTP_OK;
+}
+
+/***********************************************************
+*  Function: klv_data_fill
+*  description: copy the dp data, value and bitmap are taken from
+*               a uint32_t and changed to big-end
+*  Input:
+*  Output:
+*  Return:
+***********************************************************/
+static void klv_data_fill(uint8_t *dst,dp_type type,void *data,uint16_t len)
+{
+    if(DT_VALUE == type || \
+            DT_BITMAP == type)
+    {   // change to big-end
+        uint32_t tmp = *(uint32_t *)data;
+        uint16_t i;
+        for(i = 0; i < len; i++)
+        {
+            dst[i] = (tmp >> ((len-1-i)*8)) & 0xff;
+        }
+    }
+    else
+    {
+        memcpy(dst,(uint8_t*)data,len);
+    }
+}
+
+/***********************************************************
+*  Function: klv_view_next
+*  description: read the dp at offset without copying it,
+*               view->data points into data
+*  Input: data len offset type:0-data中len占1个字节，1-data中len占两个字节
+*  Output: view, offset moves to the next dp
+*  Return: MTP_COM_ERROR if the dp is cut
+***********************************************************/
+mtp_ret klv_view_next(uint8_t *data,uint32_t len,uint32_t *offset,klv_view_s *view,uint8_t type)
+{
+    uint32_t pos;
+
+    if(NULL == data || NULL == offset || NULL == view)
+    {
+        return MTP_INVALID_PARAM;
+    }
+
+    pos = *offset;
+    // not full klv
+    if((pos > len) || ((len-pos) < klv_head_len(type)))
+    {
+        return MTP_COM_ERROR;
+    }
+
+    view->id = data[pos++];
+    view->type = data[pos++];
+    if(1 == type)
+    {
+        view->len = data[pos++];
+        view->len = (view->len<<8) + data[pos++];
+    }
+    else
+    {
+        view->len = data[pos++];
+    }
+    if((len-pos) < view->len)
+    {   // is remain data len enougn?
+        return MTP_COM_ERROR;
+    }
+    view->data = &data[pos];
+
+    *offset = pos + view->len;
+    return MTP_OK;
+}
+
+/***********************************************************
+*  Function: klv_data_check
+*  description: walk all dps of data in place, nothing is allocated
+*  Input: data len type:0-data中len占1个字节，1-data中len占两个字节
+*  Output:
+*  Return: MTP_OK if data is one or more complete dps
+***********************************************************/
+mtp_ret klv_data_check(uint8_t *data,uint32_t len,uint8_t type)
+{
+    uint32_t offset = 0;
+    klv_view_s view;
+    mtp_ret ret;
+
+    if(NULL == data)
+    {
+        return MTP_INVALID_PARAM;
+    }
+
+    do
+    {
+        ret = klv_view_next(data,len,&offset,&view,type);
+        if(MTP_OK != ret)
+        {
+            return ret;
+        }
+    } while(offset < len);
+
+    return MTP_OK;
+}
+
+/***********************************************************
+*  Function: klv_data_put
+*  description: encode one dp at offset of buf
+*  Input: buf size offset id type data len
+*         len_type:0-data中len占1个字节，1-data中len占两个字节
+*  Output: offset moves behind the dp
+*  Return: MTP_COM_ERROR if buf has no room, buf is not changed then
+***********************************************************/
+mtp_ret klv_data_put(uint8_t *buf,uint32_t size,uint32_t *offset,uint8_t id,dp_type type,\
+                     void *data,uint16_t len,uint8_t len_type)
+{
+    uint32_t pos;
+
+    if(NULL == buf || NULL == offset || (NULL == data && 0 != len))
+    {
+        return MTP_INVALID_PARAM;
+    }
+    if(MTP_OK != klv_type_len_check(type,len) || (0 == len_type && len > 0xFF))
+    {
+        return MTP_INVALID_PARAM;
+    }
+
+    pos = *offset;
+    if((pos > size) || ((size-pos) < (klv_head_len(len_type)+len)))
+    {
+        return MTP_COM_ERROR;
+    }
+
+    buf[pos++] = id;
+    buf[pos++] = type;
+    if(1 == len_type)
+    {
+        buf[pos++] = len >> 8;
+    }
+    buf[pos++] = len & 0xff;
+    klv_data_fill(&buf[pos],type,data,len);
+
+    *offset = pos + len;
+    return MTP_OK;
+}
+
 /***********************************************************
 *  Function: free_klv_list
 *  description:
@@ -391,23 +581,39 @@ mtp_ret trsmitr_recv_pkg_decode(frm_trsmitr_proc_s *frm_trsmitr, uint8_t *raw_da
 ***********************************************************/
 void free_klv_list(klv_node_s *list)
 {
-    if (NULL == list)
-    {
-        return;
-    }
-
     klv_node_s *node = list;
     klv_node_s *next_node = NULL;
 
-    do
+    while(node)
     {
         next_node = node->next;
-        //free(node);
-        tuya_ble_free((uint8_t*)(node->data));
-
+        // the data lives in the same block as the node
         tuya_ble_free((uint8_t*)node);
         node = next_node;
-    } while (node);
+    }
+}
+
+/***********************************************************
+*  Function: klv_node_alloc
+*  description: one block for the node and its data
+*  Input:
+*  Output:
+*  Return:
+***********************************************************/
+static klv_node_s *klv_node_alloc(uint8_t id,dp_type type,uint16_t len)
+{
+    klv_node_s *node = (klv_node_s *)tuya_ble_malloc(sizeof(klv_node_s)+len);
+
+    if(NULL == node)
+    {
+        return NULL;
+    }
+    node->next = NULL;
+    node->id = id;
+    node->type = type;
+    node->len = len;
+    node->data = (uint8_t *)(node+1);
+    return node;
 }
 
 /***********************************************************
@@ -421,54 +627,22 @@ klv_node_s *make_klv_list(klv_node_s *list,uint8_t id,dp_type type,\
                           void *data,uint8_t len)
 {
     klv_node_s *node;
-    
+
     if(NULL == data || type >= DT_LMT) {
         return NULL;
     }
 
-    if(DT_VALUE == type && DT_VALUE_LEN != len) {
-        goto err_ret;
-    } else if(DT_BITMAP == type && len > DT_BITMAP_MAX) {
-        goto err_ret;
-    } else if(DT_BOOL == type && DT_BOOL_LEN != len) {
-        goto err_ret;
-    } else if(DT_ENUM == type && DT_ENUM_LEN != len) {
+    if(MTP_OK != klv_type_len_check(type,len)) {
         goto err_ret;
     }
 
-    
-    node = (klv_node_s *)tuya_ble_malloc(sizeof(klv_node_s));
-
+    node = klv_node_alloc(id,type,len);
     if(NULL == node)
     {
         goto err_ret;
     }
-    memset(node, 0, sizeof(klv_node_s));
-    node->data =tuya_ble_malloc(len);
-    if ((NULL == node)||(node->data==NULL))
-    {
-        tuya_ble_free(node->data);
-        tuya_ble_free((uint8_t*)node);
-        goto err_ret;
-    }
-    node->id = id;
-    node->len = len;
-    node->type = type;
+    klv_data_fill(node->data,type,data,len);
 
-    if(DT_VALUE == type || \
-            DT_BITMAP == type)
-    {   // change to big-end
-        uint32_t tmp = *(uint32_t *)data;
-       // unsigned char shift = 0;
-        node->data[0] = (tmp >> 24) & 0xff;
-        node->data[1] = (tmp >> 16) & 0xff;
-        node->data[2] = (tmp >> 8) & 0xff;
-        node->data[3] = (tmp >> 0) & 0xff;
-    } 
-    else
-    {    
-        memcpy((void *)node->data,(uint8_t*)data,len);
-    }
     node->next = list;
     return node;
 
@@ -497,7 +671,7 @@ mtp_ret klvlist_2_data(klv_node_s *list,uint8_t **data,uint32_t *len,uint8_t typ
     uint32_t mk_data_len = 0;
     while(node)
     {
-        mk_data_len += sizeof(klv_node_s)+node->len-sizeof(struct s_klv_node *);
+        mk_data_len += klv_head_len(type)+node->len;
         node = node->next;
     }
 
@@ -516,8 +690,8 @@ mtp_ret klvlist_2_data(klv_node_s *list,uint8_t **data,uint32_t *len,uint8_t typ
         mk_data[offset++] = node->type;
         if(1 == type)
         {
-            mk_data[offset++] = 0;
-            mk_data[offset++] = node->len;
+            mk_data[offset++] = node->len >> 8;
+            mk_data[offset++] = node->len & 0xff;
         }
         else
         {
@@ -550,82 +724,29 @@ mtp_ret data_2_klvlist(uint8_t *data,uint32_t len,klv_node_s **list,uint8_t type
     uint32_t offset = 0;
     klv_node_s *klv_list = NULL;
     klv_node_s *node = NULL;
+    klv_view_s view;
+    mtp_ret ret;
     do
     {
-        // not full klv
-        if(type == 1)
-        {
-            if((len-offset) < 4)
-            {
-                free_klv_list(klv_list);
-                return MTP_COM_ERROR;
-            }
-        }
-        else
-        {
-            if((len-offset) < 3)
-            {
-                free_klv_list(klv_list);
-                return MTP_COM_ERROR;
-            }
-        }
-
-        node = (klv_node_s *)tuya_ble_malloc(sizeof(klv_node_s));
-        if(NULL == node)
+        ret = klv_view_next(data,len,&offset,&view,type);
+        if(MTP_OK != ret)
         {
             free_klv_list(klv_list);
-            return MTP_MALLOC_ERR;
-        }
-        memset(node,0,sizeof(sizeof(klv_node_s)));
-        if(1 == type)
-        {
-            node->data=tuya_ble_malloc(data[3+offset]);  //这里虽然len用两个字节表示，但是只用了低字节
-        }
-        else
-        {
-            node->data=tuya_ble_malloc(data[2+offset]);
+            return ret;
         }
 
-        if(NULL == node||node->data==NULL)
+        node = klv_node_alloc(view.id,view.type,view.len);
+        if(NULL == node)
         {
-            tuya_ble_free(node->data);
-            tuya_ble_free((uint8_t*)node);
             free_klv_list(klv_list);
             return MTP_MALLOC_ERR;
         }
-
-
-        node->id = data[offset++];
-        node->type = data[offset++];
-        if(1 == type)
-        {
-            //offset++;
-            node->len = data[offset++];
-            node->len = (node->len<<8) + data[offset++];
-        }
-        else
-        {
-            node->len = data[offset++];
-        }
-        if((len-offset) < node->len)
-        {   // is remain data len enougn?
-            tuya_ble_free(node->data);
-            tuya_ble_free((uint8_t*)node);
-            free_klv_list(klv_list);
-            return MTP_COM_ERROR;
-        }
-
-        memcpy(node->data,&data[offset],node->len);
-        offset += node->len;
+        memcpy(node->data,view.data,view.len);
 
         node->next = klv_list;
         klv_list = node;
     } while(offset < len);
 
-    if(NULL == klv_list)
-    {
-        return MTP_COM_ERROR;
-    }
     *list = klv_list;
     return MTP_OK;
 }
@@ -151,6 +151,30 @@
 #define TUYA_BLE_GATT_SEND_DATA_QUEUE_SIZE 10
 #endif
 
+/*
+ * if 1 ,a busy link is not polled again through the event queue, the port calls
+ * tuya_ble_gatt_send_tx_complete() when a notification leaves and sending resumes from there.
+ */
+#ifndef  TUYA_BLE_GATT_SEND_ON_TX_COMPLETE
+#define TUYA_BLE_GATT_SEND_ON_TX_COMPLETE 0
+#endif
+
+/*
+ * when the event queue has no room to poll a busy link again, the queued frames are kept
+ * and sending is tried again after this time.
+ */
+#ifndef  TUYA_BLE_GATT_SEND_RETRY_MS
+#define TUYA_BLE_GATT_SEND_RETRY_MS 20
+#endif
+
+/*
+ * a frame whose next sub package does not come within this time is dropped and its buffer freed,
+ * 0 keeps an unfinished frame until the next first sub package or the disconnection.
+ */
+#ifndef  TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS
+#define TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS 0
+#endif
+
 /*
  * if defined ,include UART module
  */
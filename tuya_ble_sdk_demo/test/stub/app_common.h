@@ -0,0 +1,74 @@
+//stub of app/app_common/app_common.h for app_flash.c, app_dp_batch.c and lock_dynamic_pwd.c, only the lock types are real
+#ifndef __APP_COMMON_H__
+#define __APP_COMMON_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "suble_common.h"
+
+typedef enum {
+    APP_PORT_SUCCESS  = 0x00,
+    APP_PORT_ERROR_COMMON  = 0x01,
+} app_port_status_t;
+
+enum {
+    SF_AREA_0 = 0,
+    SF_AREA_1,
+    SF_AREA_2,
+    SF_AREA_3,
+    SF_AREA_4,
+};
+
+typedef enum {
+    UNBONDING_UNCONN = 0,
+    UNBONDING_CONN,
+    BONDING_UNCONN,
+    BONDING_CONN,
+} tuya_ble_connect_status_t;
+
+typedef struct {
+    uint8_t mac[6];
+} slave_info_t;
+
+uint32_t app_port_nv_set(uint32_t area_id, uint16_t id, void *buf, uint8_t size);
+uint32_t app_port_nv_get(uint32_t area_id, uint16_t id, void *buf, uint8_t size);
+uint32_t app_port_nv_del(uint32_t area_id, uint16_t id);
+uint32_t app_port_nv_set_default(void);
+tuya_ble_connect_status_t app_port_get_connect_status(void);
+uint32_t app_port_dp_report_send(uint8_t *buf, uint32_t size);
+typedef uint32_t tuya_ble_status_t;
+tuya_ble_status_t tuya_ble_master_info_init(slave_info_t* info, uint8_t slave_max_num);
+
+uint32_t lock_hard_doorcard_delete(uint8_t hardid);
+uint32_t lock_hard_finger_delete(uint8_t hardid);
+uint32_t lock_hard_face_delete(uint8_t hardid);
+
+#include "lock_dp_parser.h"
+
+//see tuya_ble_internal_config.h
+#define TUYA_BLE_REPORT_MAX_DP_DATA_LEN     (255+3)
+
+#define TUYA_APP_LOG_INFO(...)
+#define TUYA_APP_LOG_HEXDUMP_INFO(...)
+#define TUYA_APP_LOG_ERROR(...)
+
+//lock_dynamic_pwd.c, with cpt/hash copied next to it
+#if __has_include("hmac-sha1.h")
+#include "hmac-sha1.h"
+
+//see tuya_ble_type.h and tuya_ble_main.h
+#define LOGIN_KEY_LEN                       6
+
+typedef struct {
+    struct {
+        uint8_t login_key[LOGIN_KEY_LEN];
+    } sys_settings;
+} tuya_ble_parameters_settings_t;
+
+extern tuya_ble_parameters_settings_t tuya_ble_current_para;
+
+uint32_t app_port_get_timestamp(void);
+#endif
+
+#endif //__APP_COMMON_H__
@@ -0,0 +1,8 @@
+//stub of app/app_common/app_port.h for suble_key.c
+#ifndef __APP_PORT_H__
+#define __APP_PORT_H__
+
+#include "app_common.h"
+#include "tuya_ble_master_port.h"
+
+#endif //__APP_PORT_H__
@@ -0,0 +1,17 @@
+//stub of the ble stack ea.h for suble_adv_scan.c and elog_flash_port.c
+#ifndef EA_H_
+#define EA_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//see co_bt.h
+#define MAX_SLOT_CLOCK      ((1L<<27) - 1)
+
+//ble slot clock, 625us, rounded to the slot
+uint32_t ea_time_get_slot_rounded(void);
+
+//true if the radio lets the cpu go, sleep_duration is cut to the slots before the next event
+bool ea_sleep_check(uint32_t *sleep_duration, uint32_t wakeup_delay);
+
+#endif //EA_H_
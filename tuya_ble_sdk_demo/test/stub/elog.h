@@ -0,0 +1,22 @@
+//stub of cpt/easylogger/inc/elog.h for elog_bin.c
+#ifndef __ELOG_H__
+#define __ELOG_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define ELOG_BIN_OUTPUT_ENABLE
+
+#define ELOG_LVL_ASSERT                      0
+#define ELOG_LVL_ERROR                       1
+#define ELOG_LVL_WARN                        2
+#define ELOG_LVL_INFO                        3
+#define ELOG_LVL_DEBUG                       4
+#define ELOG_LVL_VERBOSE                     5
+
+bool elog_get_output_enabled(void);
+void elog_bin_printf(uint8_t level, const char *format, ...);
+void elog_bin_hexdump(const char *name, uint8_t width, uint8_t *buf, uint16_t size);
+
+#endif //__ELOG_H__
@@ -0,0 +1,8 @@
+//stub of the ble stack ll.h, the host tests run on one thread
+#ifndef _LL_H_
+#define _LL_H_
+
+#define GLOBAL_INT_DISABLE()    do {
+#define GLOBAL_INT_RESTORE()    } while(0)
+
+#endif //_LL_H_
@@ -0,0 +1,11 @@
+//stub of the ble stack lld_evt.h for suble_rand.c and suble_timer.c
+#ifndef LLD_EVT_H_
+#define LLD_EVT_H_
+
+#include <stdint.h>
+
+void lld_evt_time_get_us(uint32_t *slot, uint32_t *slot1);
+//ble slot clock, 625us, 27 bits
+uint32_t lld_evt_time_get(void);
+
+#endif //LLD_EVT_H_
@@ -0,0 +1,10 @@
+//stub of app/app_lock/lock_timer.h for suble_key.c
+#ifndef __LOCK_TIMER_H__
+#define __LOCK_TIMER_H__
+
+#include "app_common.h"
+
+void lock_factory_handler(void);
+uint32_t lock_open_record_report(uint32_t timestamp, uint8_t dp_id, uint32_t hardid, uint16_t slaveid);
+
+#endif //__LOCK_TIMER_H__
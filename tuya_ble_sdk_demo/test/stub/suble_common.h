@@ -0,0 +1,314 @@
+//stub of suble/suble_common.h, only what the suble units under test use
+#ifndef __SUBLE_COMMON_H__
+#define __SUBLE_COMMON_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define SUBLE_BT_MAC_LEN                        6
+
+typedef enum {
+    SUBLE_SUCCESS = 0x00,
+    SUBLE_ERROR_COMMON,
+} suble_status_t;
+
+//kernel, see ke_timer.h and appm_task.h
+#define TASK_APPM                               0
+#define SUBLE_TIMER_WHEEL                       1
+void ke_timer_set(uint16_t timer_id, uint16_t task, uint32_t delay);
+void ke_timer_clear(uint16_t timer_id, uint16_t task);
+
+void Delay_ms(int num);
+void Delay_us(int num);
+
+/* suble_gap, with the stack and app parts suble_gap.c uses
+ **************************************************/
+#define GAP_INVALID_CONIDX                      0xFF
+#define GAP_ERR_NO_ERROR                        0x00
+#define GAP_ERR_COMMAND_DISALLOWED              0x43
+#define ROLE_MASTER                             0
+#define ROLE_END                                2
+
+struct bd_addr { uint8_t addr[SUBLE_BT_MAC_LEN]; };
+struct gap_bdaddr { struct bd_addr addr; uint8_t addr_type; };
+struct gapc_conn_param { uint16_t intv_min; uint16_t intv_max; uint16_t latency; uint16_t time_out; };
+extern struct bd_addr co_default_bdaddr;
+
+uint8_t appc_update_param(uint8_t conidx, uint16_t intv_min, uint16_t intv_max, uint16_t latency, uint16_t time_out);
+uint8_t appm_start_connencting(struct gap_bdaddr bdaddr);
+void appm_disconnect(uint8_t conidx);
+
+enum { APP_EVT_CONNECTED = 0, APP_EVT_DISCONNECTED };
+void tuya_ble_app_evt_send(int evtid);
+void tuya_ble_aes128_cbc_cache_clear(void);
+
+#define SUBLE_PRINTF(...)
+#define SUBLE_HEXDUMP(...)
+
+#define TUYA_DEVICE_MAC                         "DC234D12ED2E"
+#define SUBLE_BT_MAC_STR_LEN                    (SUBLE_BT_MAC_LEN*2)
+#define SUBLE_FLASH_BT_MAC_ADDR                 0x7F000
+#define SUBLE_FLASH_LOG_START_ADDR              0x72000
+#define SUBLE_FLASH_LOG_END_ADDR                0x76000
+#define SUBLE_CONN_INTERVAL_MIN                 180
+#define SUBLE_CONN_INTERVAL_MAX                 200
+#define SUBLE_CONN_SUP_TIMEOUT                  5000
+
+typedef enum {
+    SUBLE_GAP_EVT_CONNECTED = 0x00,
+    SUBLE_GAP_EVT_DISCONNECTED,
+    SUBLE_GAP_EVT_CONNECT_TIMEOUT,
+} suble_gap_result_t;
+
+typedef enum {
+    SUBLE_LINK_MODE_NONE = 0x00,
+    SUBLE_LINK_MODE_IDLE,
+    SUBLE_LINK_MODE_BULK,
+} suble_link_mode_t;
+
+typedef enum {
+    SUBLE_LINK_OP_OTA           = 0x01,
+    SUBLE_LINK_OP_OPEN_METH_SYNC= 0x02,
+    SUBLE_LINK_OP_OFFLINE_EVT   = 0x04,
+} suble_link_op_t;
+
+typedef struct
+{
+    uint16_t condix;
+    uint8_t  role;
+    struct gap_bdaddr mac;
+} conn_info_t;
+
+typedef void (*suble_connect_result_handler_t)(uint32_t evt, uint8_t* buf, uint32_t size);
+
+extern conn_info_t g_conn_info[];
+
+uint32_t suble_gap_connect(struct gap_bdaddr bdaddr, suble_connect_result_handler_t handler);
+void suble_gap_conn_handler(void);
+void suble_gap_disconn_handler(void);
+void suble_gap_master_disconn_handler(void);
+void suble_gap_link_start(void);
+void suble_gap_link_stop(void);
+void suble_gap_link_op_begin(suble_link_op_t op);
+void suble_gap_link_op_end(suble_link_op_t op);
+void suble_gap_link_relax(void);
+void suble_gap_link_traffic(void);
+void suble_gap_link_param_result(uint16_t condix, bool accepted);
+void suble_gap_link_param_updated(uint16_t condix, uint16_t interval, uint16_t latency);
+
+void suble_svc_notify_reset(void);
+void suble_flash_read(uint32_t addr, uint8_t *buf, uint32_t size);
+void suble_flash_write(uint32_t addr, uint8_t *buf, uint32_t size);
+void suble_flash_erase(uint32_t addr, uint32_t num);
+void suble_util_reverse_byte(void* buf, uint32_t size);
+uint32_t suble_util_str_hexstr2hexarray(uint8_t* hexstr, uint32_t size, uint8_t* hexarray);
+
+/* suble_svc, with the stack and app parts suble_svc.c uses
+ **************************************************/
+#include <stddef.h>
+#if __has_include("tuya_ble_api.h")
+#include "tuya_ble_api.h" //tuya_ble_gatt_receive_data
+#endif
+
+#define APPC_IDX_MAX                            2
+#define ATT_ERR_NO_ERROR                        0x00
+#define ATT_ERR_INVALID_HANDLE                  0x01
+#define GAP_ERR_NOT_FOUND                       0x49
+#define SF_SUCCESS                              0x00
+#define SUBLE_SVC_NOTIFY_DEPTH                  (4)
+#define SUBLE_SVC_C_CACHE_NV_AREA               (0) //SF_AREA_0
+#define SUBLE_SVC_C_CACHE_NV_ID                 (0x0100)
+
+typedef enum {
+    SUBLE_SVC_C_EVT_DISCOVERY_COMPLETE = 0x00,
+    SUBLE_SVC_C_EVT_RECEIVE_DATA_FROM_SLAVE,
+} suble_svc_result_t;
+
+typedef void (*suble_svc_result_handler_t)(uint32_t evt, uint8_t* buf, uint32_t size);
+
+//see sdp_service.h, only the handles
+struct sdp_svc_cache
+{
+    uint16_t shdl;
+    uint16_t ehdl;
+    uint16_t write_hdl;
+    uint16_t notif_hdl;
+};
+
+//see appc.h
+struct appc_env_tag
+{
+    uint8_t  role;
+    struct   gap_bdaddr con_dev_addr;
+    uint16_t svc_write_handle;
+    uint16_t svc_notif_handle;
+};
+extern struct appc_env_tag *appc_env[APPC_IDX_MAX];
+
+uint8_t sdp_export_svc_info(uint8_t conidx, struct sdp_svc_cache *cache);
+uint8_t sdp_restore_svc_info(uint8_t conidx, struct sdp_svc_cache const *cache);
+uint8_t appc_write_service_data_req(uint8_t conidx, uint16_t handle, uint16_t data_len, uint8_t *data);
+uint8_t appc_write_service_ntf_cfg_req(uint8_t conidx, uint16_t handle, uint16_t ntf_cfg);
+void app_fff1_send_lvl(uint8_t* buf, uint8_t len);
+uint32_t sf_nv_write(uint32_t area_id, uint16_t id, void *buf, uint8_t size);
+uint32_t sf_nv_read(uint32_t area_id, uint16_t id, void *buf, uint8_t size);
+uint32_t sf_nv_delete(uint32_t area_id, uint16_t id);
+uint16_t suble_util_crc16(uint8_t* buf, uint32_t size, uint16_t* p_crc);
+
+void suble_db_discovery_start(suble_svc_result_handler_t handler);
+uint32_t suble_svc_c_send_data(uint16_t condix, uint8_t* pBuf, uint16_t len);
+void suble_svc_c_discovery_complete(void);
+uint32_t suble_svc_c_cache_restore(uint8_t condix);
+void suble_svc_c_ntf_cfg_enable(uint8_t condix);
+uint32_t suble_svc_c_cache_check(uint8_t condix, uint8_t status);
+
+/* suble_adv_scan, with the stack and app parts suble_adv_scan.c uses
+ **************************************************/
+#define SUBLE_ADV_DATA_MAX_LEN                  (31)
+#define SUBLE_ADV_INTERVAL_MIN                  (100)
+#define SUBLE_ADV_INTERVAL_MAX                  (100)
+#define ADV_DATA_LEN                            0x1F
+#define GAP_LE_GEN_DISCOVERABLE_FLG             0x02
+#define GAP_BR_EDR_NOT_SUPPORTED                0x04
+#define GAPM_ADV_UNDIRECT                       0x00
+#define APPM_ADVERTISING                        3
+#define APPM_SET_FIELD(field, value)
+
+enum
+{
+    GAP_AD_TYPE_FLAGS                      = 0x01,
+    GAP_AD_TYPE_MORE_16_BIT_UUID           = 0x02,
+    GAP_AD_TYPE_COMPLETE_LIST_16_BIT_UUID  = 0x03,
+    GAP_AD_TYPE_COMPLETE_NAME              = 0x09,
+    GAP_AD_TYPE_SERVICE_16_BIT_DATA        = 0x16,
+    GAP_AD_TYPE_MANU_SPECIFIC_DATA         = 0xFF,
+};
+
+//see co_bt.h
+struct adv_report
+{
+    uint8_t        evt_type;
+    uint8_t        adv_addr_type;
+    struct bd_addr adv_addr;
+    uint8_t        data_len;
+    uint8_t        data[ADV_DATA_LEN];
+    uint8_t        rssi;
+};
+
+typedef enum {
+    SUBLE_SCAN_EVT_ADV_REPORT = 0x00,
+    SUBLE_SCAN_EVT_SCAN_TIMEOUT,
+} suble_scan_result_t;
+
+typedef struct
+{
+    double  adv_interval_min; //ms
+    double  adv_interval_max; //ms
+    uint8_t adv_type;
+    uint8_t adv_power;
+    uint8_t adv_channal_map;
+} adv_param_t;
+
+typedef struct
+{
+    uint32_t len;
+    uint8_t  value[SUBLE_ADV_DATA_MAX_LEN];
+} adv_data_t;
+
+typedef void (*suble_scan_result_handler_t)(uint32_t evt, uint8_t* buf, uint32_t size);
+
+uint8_t ke_state_get(uint16_t task);
+void appm_scan_adv_con_schedule(void);
+void appm_update_adv_data(uint8_t* adv_buff, uint8_t adv_len, uint8_t* scan_buff, uint8_t scan_len);
+
+void suble_scan_evt_handler(struct adv_report const *p_param);
+void suble_scan_start(suble_scan_result_handler_t handler);
+
+/* suble_gpio and suble_key
+ **************************************************/
+#define ANTILOCK_BUTTON_PIN                     0x10
+
+enum
+{
+    SUBLE_LEVEL_INVALID = 0xFF,
+    SUBLE_LEVEL_LOW  = 0,
+    SUBLE_LEVEL_HIGH = 1,
+};
+
+uint8_t suble_gpio_get_input(uint8_t pin);
+void suble_gpio_irq_rearm(uint8_t pin);
+void suble_key_edge_handler(void);
+void suble_gap_disconnect(uint16_t condix, uint8_t hci_status_code);
+
+/* suble_timer
+ **************************************************/
+#define SUBLE_TIMER_COUNT_ENDLESS               0xFFFFFFFF
+
+typedef enum {
+    SUBLE_TIMER_SINGLE_SHOT,
+    SUBLE_TIMER_REPEATED,
+} suble_timer_mode_t;
+
+typedef void (*suble_timer_handler_t)(void*);
+
+typedef struct suble_timer_s
+{
+    struct suble_timer_s*  next;
+    struct suble_timer_s** pprev;
+    uint32_t deadline;
+    uint32_t period;
+    uint32_t count;
+    suble_timer_handler_t handler;
+} suble_timer_t;
+
+#define SUBLE_TIMER_DEF(_handler)   {NULL, NULL, 0, 0, 0, (_handler)}
+
+void suble_timer_handler(void);
+void suble_timer_start_0(suble_timer_t* timer, uint32_t ms, uint32_t count);
+void suble_timer_stop_0(suble_timer_t* timer);
+bool suble_timer_is_running(suble_timer_t* timer);
+uint32_t suble_timer_create(void** p_timer_id, uint32_t timeout_value_ms, suble_timer_mode_t mode, suble_timer_handler_t timeout_handler);
+uint32_t suble_timer_delete(void* timer_id);
+uint32_t suble_timer_start(void* timer_id);
+uint32_t suble_timer_stop(void* timer_id);
+void suble_local_timer_start(void);
+uint32_t suble_get_local_timestamp(void);
+void suble_update_timestamp(uint32_t app_timestamp);
+uint32_t suble_get_app_timestamp_when_update(void);
+uint32_t suble_get_timestamp(void);
+uint32_t suble_get_old_timestamp(uint32_t old_local_timestamp);
+uint32_t suble_get_timestamp_with_ms(uint16_t* ms);
+void suble_wdt_wake_start(void);
+
+/* suble_rand
+ **************************************************/
+
+void suble_gap_get_bt_mac(uint8_t *pMac, uint32_t size);
+uint16_t adc_get_value(void);
+
+void suble_rand_init(void);
+void suble_rand_seed(const uint8_t* seed, uint32_t len);
+void suble_rand_instantiate(const uint8_t* seed, uint32_t len);
+void suble_rand_bytes(uint8_t* buf, uint32_t size);
+
+/* the rest of what tuya_ble_port_bk3431q.c calls
+ **************************************************/
+typedef void (*suble_uart_tx_cb_t)(void);
+
+extern adv_data_t      g_adv_data;
+extern adv_data_t      g_scan_rsp;
+
+void suble_system_reset(void);
+void suble_enter_critical(void);
+void suble_exit_critical(void);
+void suble_adv_update_advDataAndScanRsp(void);
+void suble_gap_disconnect_for_tuya_ble_sdk(void);
+void suble_gap_set_bt_mac(uint8_t *pMac);
+bool suble_svc_notify(uint8_t* buf, uint32_t size);
+bool suble_uart1_send(const uint8_t* buf, uint32_t size);
+void suble_uart1_tx_cb_register(suble_uart_tx_cb_t cb);
+uint32_t suble_timer_restart(void* timer_id, uint32_t timeout_value_ms);
+void suble_delay_ms(uint32_t ms);
+
+#endif //__SUBLE_COMMON_H__
@@ -0,0 +1,10 @@
+//CUSTOMIZED_TUYA_BLE_CONFIG_FILE of the host tests of the tuya ble sdk units
+#ifndef __TUYA_BLE_CONFIG_HOST_H__
+#define __TUYA_BLE_CONFIG_HOST_H__
+
+#define TUYA_BLE_PORT_PLATFORM_HEADER_FILE  "tuya_ble_port_host.h"
+
+#define TUYA_BLE_LOG_ENABLE                 0
+#define TUYA_APP_LOG_ENABLE                 0
+
+#endif //__TUYA_BLE_CONFIG_HOST_H__
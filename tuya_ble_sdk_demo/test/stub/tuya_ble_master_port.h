@@ -0,0 +1,40 @@
+//stub of app/tuya_ble_sdk_demo/tuya_ble_master_port.h and tuya_ble_master.h for suble_key.c
+#ifndef __TUYA_BLE_MASTER_PORT_H__
+#define __TUYA_BLE_MASTER_PORT_H__
+
+#include "app_common.h"
+
+typedef enum
+{
+    TUYA_BLE_MASTER_EVT_TIMEOUT = 0x00,
+    TUYA_BLE_MASTER_EVT_SLAVEID_INVALID,
+    TUYA_BLE_MASTER_EVT_SCAN_TIMEOUT,
+    TUYA_BLE_MASTER_EVT_CONNECT_TIMEOUT,
+    TUYA_BLE_MASTER_EVT_BONDING,
+    TUYA_BLE_MASTER_EVT_OPEN_WITH_MASTER_SUCCESS,
+    TUYA_BLE_MASTER_EVT_OPEN_WITH_MASTER_FAILURE,
+    TUYA_BLE_MASTER_EVT_DISCONNECT,
+} tuya_ble_master_evt_t;
+
+typedef enum
+{
+    TUYA_BLE_MASTER_OPERATION_CLOSE = 0x00,
+    TUYA_BLE_MASTER_OPERATION_OPEN,
+} tuya_ble_master_operation_t;
+
+#pragma pack(1)
+typedef struct
+{
+    uint16_t slaveid;
+    uint32_t timestamp;
+} open_with_master_record_report_info_t;
+#pragma pack()
+
+typedef void (*tuya_ble_master_evt_handler_t)(uint32_t evt, uint8_t* buf, uint32_t size);
+
+extern volatile uint32_t g_open_fail_count;
+
+tuya_ble_status_t tuya_ble_master_scan_start(int32_t slaveid, tuya_ble_master_evt_handler_t handler);
+tuya_ble_status_t tuya_ble_master_open_with_master(uint8_t operation, uint8_t open_meth, void* open_meth_info, uint8_t open_meth_info_size);
+
+#endif //__TUYA_BLE_MASTER_PORT_H__
@@ -0,0 +1,15 @@
+//TUYA_BLE_PORT_PLATFORM_HEADER_FILE of the host tests, the sdk logs are compiled out
+#ifndef __TUYA_BLE_PORT_HOST_H__
+#define __TUYA_BLE_PORT_HOST_H__
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#define TUYA_BLE_PRINTF(...)
+#define TUYA_BLE_HEXDUMP(...)
+//tuya_ble_port_bk3431q.h brings it in through suble_common.h
+#define SUBLE_PRINTF(...)
+
+#endif //__TUYA_BLE_PORT_HOST_H__
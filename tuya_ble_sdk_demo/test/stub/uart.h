@@ -0,0 +1,13 @@
+//stub of the bk3435 driver uart.h for elog_port.c
+#ifndef _UART_H_
+#define _UART_H_
+
+#include <stdint.h>
+
+#define UART0_TX_FIFO_MAX_COUNT  512
+
+void uart2_send(unsigned char *buff, int len);
+uint16_t uart2_send_async(unsigned char *buff, uint16_t len);
+uint16_t uart2_tx_free_get(void);
+
+#endif //_UART_H_
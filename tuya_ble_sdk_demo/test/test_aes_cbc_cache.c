@@ -0,0 +1,247 @@
+//cbc key schedules kept by tuya_ble_port_bk3431q.c, against fresh mbedtls contexts
+#include <time.h>
+#include "test_common.h"
+#include "tuya_ble_port_bk3431q.h"
+
+#define FRAME_LEN_MAX           256
+#define SPEED_ROUNDS            20000
+
+/*********************************************************
+ * the key expansions, counted through the linker
+ */
+static uint32_t s_setkey_enc = 0;
+static uint32_t s_setkey_dec = 0;
+
+int __real_mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits);
+int __real_mbedtls_aes_setkey_dec(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits);
+
+int __wrap_mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits)
+{
+    s_setkey_enc++;
+    return __real_mbedtls_aes_setkey_enc(ctx, key, keybits);
+}
+
+int __wrap_mbedtls_aes_setkey_dec(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits)
+{
+    s_setkey_dec++;
+    return __real_mbedtls_aes_setkey_dec(ctx, key, keybits);
+}
+
+/*********************************************************
+ * the rest of the port, not used here
+ */
+adv_data_t g_adv_data;
+adv_data_t g_scan_rsp;
+
+void suble_adv_update_advDataAndScanRsp(void) {}
+void suble_gap_disconnect_for_tuya_ble_sdk(void) {}
+void suble_gap_get_bt_mac(uint8_t *pMac, uint32_t size) {}
+void suble_gap_set_bt_mac(uint8_t *pMac) {}
+bool suble_svc_notify(uint8_t* buf, uint32_t size) { return true; }
+void tuya_ble_uart_common_tx_complete(void) {}
+void suble_uart1_tx_cb_register(suble_uart_tx_cb_t cb) {}
+bool suble_uart1_send(const uint8_t* buf, uint32_t size) { return true; }
+uint32_t suble_timer_create(void** p_timer_id, uint32_t timeout_value_ms, suble_timer_mode_t mode, suble_timer_handler_t timeout_handler) { return 0; }
+uint32_t suble_timer_delete(void* timer_id) { return 0; }
+uint32_t suble_timer_start(void* timer_id) { return 0; }
+uint32_t suble_timer_restart(void* timer_id, uint32_t timeout_value_ms) { return 0; }
+uint32_t suble_timer_stop(void* timer_id) { return 0; }
+void suble_delay_ms(uint32_t ms) {}
+void suble_rand_bytes(uint8_t* buf, uint32_t size) {}
+void suble_system_reset(void) {}
+void suble_enter_critical(void) {}
+void suble_exit_critical(void) {}
+void suble_flash_erase(uint32_t addr, uint32_t num) {}
+void suble_flash_write(uint32_t addr, uint8_t *buf, uint32_t size) {}
+void suble_flash_read(uint32_t addr, uint8_t *buf, uint32_t size) {}
+
+/*********************************************************
+ * the per frame context of the old port
+ */
+static void ref_cbc(int mode, uint8_t *key, uint8_t *iv, uint8_t *input, uint16_t input_len, uint8_t *output)
+{
+    mbedtls_aes_context aes_ctx;
+
+    mbedtls_aes_init(&aes_ctx);
+    if(mode == MBEDTLS_AES_ENCRYPT) {
+        __real_mbedtls_aes_setkey_enc(&aes_ctx, key, 128);
+    } else {
+        __real_mbedtls_aes_setkey_dec(&aes_ctx, key, 128);
+    }
+    mbedtls_aes_crypt_cbc(&aes_ctx, mode, input_len, iv, input, output);
+    mbedtls_aes_free(&aes_ctx);
+}
+
+static void rand_fill(uint8_t* buf, uint32_t size)
+{
+    for(uint32_t idx=0; idx<size; idx++) {
+        buf[idx] = test_rand();
+    }
+}
+
+//one frame both ways, the output and the chained iv match the old port
+static void cbc_check(uint8_t *key, uint16_t len)
+{
+    uint8_t iv[16], ref_iv[16];
+    uint8_t input[FRAME_LEN_MAX];
+    uint8_t output[FRAME_LEN_MAX], ref_output[FRAME_LEN_MAX];
+    int mode = test_rand() % 2;
+
+    rand_fill(iv, sizeof(iv));
+    rand_fill(input, len);
+    memcpy(ref_iv, iv, sizeof(iv));
+    ref_cbc(mode, key, ref_iv, input, len, ref_output);
+    if(mode == MBEDTLS_AES_ENCRYPT) {
+        TEST_CHECK(tuya_ble_aes128_cbc_encrypt(key, iv, input, len, output));
+    } else {
+        TEST_CHECK(tuya_ble_aes128_cbc_decrypt(key, iv, input, len, output));
+    }
+    TEST_CHECK(memcmp(output, ref_output, len) == 0);
+    TEST_CHECK(memcmp(iv, ref_iv, sizeof(iv)) == 0);
+}
+
+//the expansions one call did
+static void cbc_call(uint8_t *key, int mode, uint32_t enc, uint32_t dec)
+{
+    uint32_t setkey_enc = s_setkey_enc;
+    uint32_t setkey_dec = s_setkey_dec;
+    uint8_t iv[16] = {0};
+    uint8_t buf[32] = {0};
+
+    if(mode == MBEDTLS_AES_ENCRYPT) {
+        tuya_ble_aes128_cbc_encrypt(key, iv, buf, sizeof(buf), buf);
+    } else {
+        tuya_ble_aes128_cbc_decrypt(key, iv, buf, sizeof(buf), buf);
+    }
+    TEST_CHECK_EQ(s_setkey_enc - setkey_enc, enc);
+    TEST_CHECK_EQ(s_setkey_dec - setkey_dec, dec);
+}
+
+/*********************************************************
+ * cases
+ */
+//each direction of a key is expanded once, two keys are kept, the least recently used one goes
+static void test_key_change(void)
+{
+    uint8_t key_a[16], key_b[16], key_c[16];
+
+    tuya_ble_aes128_cbc_cache_clear();
+    rand_fill(key_a, 16);
+    memcpy(key_b, key_a, 16);
+    key_b[15] ^= 0x80;
+    rand_fill(key_c, 16);
+
+    cbc_call(key_a, MBEDTLS_AES_ENCRYPT, 1, 0);
+    cbc_call(key_a, MBEDTLS_AES_ENCRYPT, 0, 0);
+    cbc_call(key_a, MBEDTLS_AES_DECRYPT, 0, 1);
+    cbc_call(key_a, MBEDTLS_AES_DECRYPT, 0, 0);
+    //one bit off is another key
+    cbc_call(key_b, MBEDTLS_AES_DECRYPT, 0, 1);
+    cbc_call(key_a, MBEDTLS_AES_ENCRYPT, 0, 0);
+    cbc_call(key_b, MBEDTLS_AES_DECRYPT, 0, 0);
+    //b was used last, a goes with both directions
+    cbc_call(key_c, MBEDTLS_AES_ENCRYPT, 1, 0);
+    cbc_call(key_b, MBEDTLS_AES_DECRYPT, 0, 0);
+    cbc_call(key_a, MBEDTLS_AES_DECRYPT, 0, 1);
+    cbc_call(key_a, MBEDTLS_AES_ENCRYPT, 1, 0);
+    cbc_call(key_c, MBEDTLS_AES_ENCRYPT, 1, 0);
+    cbc_call(key_b, MBEDTLS_AES_DECRYPT, 0, 1);
+
+    //the key buffer of the sdk is reused, the cache keeps its own copy
+    memcpy(key_c, key_b, 16);
+    key_c[0] ^= 1;
+    cbc_call(key_c, MBEDTLS_AES_ENCRYPT, 1, 0);
+    key_c[0] ^= 1;
+    cbc_call(key_c, MBEDTLS_AES_DECRYPT, 0, 0);
+}
+
+//a disconnect drops every kept schedule
+static void test_disconnect(void)
+{
+    uint8_t key_a[16], key_b[16];
+
+    tuya_ble_aes128_cbc_cache_clear();
+    rand_fill(key_a, 16);
+    rand_fill(key_b, 16);
+    cbc_call(key_a, MBEDTLS_AES_ENCRYPT, 1, 0);
+    cbc_call(key_b, MBEDTLS_AES_DECRYPT, 0, 1);
+
+    tuya_ble_aes128_cbc_cache_clear();
+    cbc_call(key_a, MBEDTLS_AES_ENCRYPT, 1, 0);
+    cbc_call(key_b, MBEDTLS_AES_DECRYPT, 0, 1);
+    cbc_check(key_a, 32);
+    cbc_check(key_b, 32);
+
+    tuya_ble_aes128_cbc_cache_clear();
+    tuya_ble_aes128_cbc_cache_clear();
+    cbc_call(key_b, MBEDTLS_AES_ENCRYPT, 1, 0);
+    cbc_check(key_b, 16);
+}
+
+//random keys from a small pool, lengths and directions, with disconnects between
+static void test_random(void)
+{
+    uint8_t key[5][16];
+    uint8_t out[16];
+
+    rand_fill((uint8_t*)key, sizeof(key));
+    tuya_ble_aes128_cbc_cache_clear();
+    for(uint32_t idx=0; idx<20000; idx++) {
+        if(test_rand() % 500 == 0) {
+            tuya_ble_aes128_cbc_cache_clear();
+        }
+        if(test_rand() % 100 == 0) {
+            rand_fill(key[test_rand() % 5], 16);
+        }
+        cbc_check(key[test_rand() % 5], 16 * (1 + test_rand() % (FRAME_LEN_MAX/16)));
+    }
+
+    //a length the padding did not round is refused
+    TEST_CHECK(!tuya_ble_aes128_cbc_encrypt(key[0], out, out, 20, out));
+    TEST_CHECK(!tuya_ble_aes128_cbc_decrypt(key[0], out, out, 15, out));
+}
+
+//a 20 byte command padded to 32, and a 256 byte frame
+static void test_speed(void)
+{
+    static const uint16_t frame_len[] = {32, 256};
+    uint8_t key[16], iv[16];
+    uint8_t buf[FRAME_LEN_MAX];
+
+    rand_fill(key, 16);
+    rand_fill(buf, sizeof(buf));
+    tuya_ble_aes128_cbc_cache_clear();
+    for(uint32_t idx=0; idx<2; idx++) {
+        uint16_t len = frame_len[idx];
+        clock_t start;
+        double old_s, new_s;
+
+        start = clock();
+        for(uint32_t round=0; round<SPEED_ROUNDS; round++) {
+            memset(iv, 0, sizeof(iv));
+            ref_cbc(round % 2, key, iv, buf, len, buf);
+        }
+        old_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+        start = clock();
+        for(uint32_t round=0; round<SPEED_ROUNDS; round++) {
+            memset(iv, 0, sizeof(iv));
+            if(round % 2) {
+                tuya_ble_aes128_cbc_encrypt(key, iv, buf, len, buf);
+            } else {
+                tuya_ble_aes128_cbc_decrypt(key, iv, buf, len, buf);
+            }
+        }
+        new_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf("aes128 cbc %u bytes: per frame context %.2f us, kept %.2f us\n",
+            len, old_s*1e6/SPEED_ROUNDS, new_s*1e6/SPEED_ROUNDS);
+    }
+}
+
+int main(void)
+{
+    test_key_change();
+    test_disconnect();
+    test_random();
+    test_speed();
+    return TEST_RESULT();
+}
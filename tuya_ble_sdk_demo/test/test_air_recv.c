@@ -0,0 +1,587 @@
+#include "test_common.h"
+#include "tuya_ble_port.h"
+#include "tuya_ble_mem.h"
+#include "tuya_ble_main.h"
+#include "tuya_ble_api.h"
+#include "tuya_ble_data_handler.h"
+#include "tuya_ble_mutli_tsf_protocol.h"
+#include "tuya_ble_secure.h"
+#include "tuya_ble_unix_time.h"
+
+#define FRAME_VERSION           3
+#define PKG_MAX                 80
+#define EVENT_QUEUE_SIZE        4
+
+/*********************************************************
+ * heap, every frame buffer must be given back
+ */
+static int32_t  s_heap_blocks = 0;
+static uint32_t s_heap_allocs = 0;
+
+void *tuya_ble_malloc(uint16_t size)
+{
+    s_heap_blocks++;
+    s_heap_allocs++;
+    return malloc(size);
+}
+
+tuya_ble_status_t tuya_ble_free(uint8_t *ptr)
+{
+    s_heap_blocks--;
+    free(ptr);
+    return TUYA_BLE_SUCCESS;
+}
+
+/*********************************************************
+ * the secure library, a whole frame ends here and is kept by the test
+ */
+tuya_ble_parameters_settings_t tuya_ble_current_para;
+
+static uint8_t  s_rx_frame[TUYA_BLE_AIR_FRAME_MAX];
+static uint32_t s_rx_len = 0;
+static uint32_t s_rx_num = 0;
+
+uint8_t tuya_ble_decryption(uint8_t const *in_buf,uint32_t in_len,uint32_t *out_len,uint8_t *out_buf,tuya_ble_parameters_settings_t *current_para_data,uint8_t *dev_rand)
+{
+    TEST_CHECK(in_len <= TUYA_BLE_AIR_FRAME_MAX);
+    memcpy(s_rx_frame, in_buf, in_len);
+    s_rx_len = in_len;
+    s_rx_num++;
+    //the command handlers are not under test
+    return 1;
+}
+
+/*********************************************************
+ * timer and main process, run by the test
+ */
+static tuya_ble_timer_handler_t s_timer_handler = NULL;
+static bool     s_timer_running = false;
+static uint32_t s_timer_creates = 0;
+static tuya_ble_custom_evt_t s_event[EVENT_QUEUE_SIZE];
+static uint32_t s_event_num = 0;
+
+tuya_ble_status_t tuya_ble_timer_create(void** p_timer_id,uint32_t timeout_value_ms, tuya_ble_timer_mode mode,tuya_ble_timer_handler_t timeout_handler)
+{
+    TEST_CHECK_EQ(mode, TUYA_BLE_TIMER_SINGLE_SHOT);
+    s_timer_creates++;
+    s_timer_handler = timeout_handler;
+    *p_timer_id = &s_timer_handler;
+    return TUYA_BLE_SUCCESS;
+}
+
+tuya_ble_status_t tuya_ble_timer_restart(void* timer_id,uint32_t timeout_value_ms)
+{
+    s_timer_running = true;
+    return TUYA_BLE_SUCCESS;
+}
+
+tuya_ble_status_t tuya_ble_timer_stop(void* timer_id)
+{
+    s_timer_running = false;
+    return TUYA_BLE_SUCCESS;
+}
+
+uint8_t tuya_ble_custom_event_send(tuya_ble_custom_evt_t evt)
+{
+    TEST_CHECK(s_event_num < EVENT_QUEUE_SIZE);
+    s_event[s_event_num++] = evt;
+    return 0;
+}
+
+static void timer_fire(void)
+{
+    TEST_CHECK(s_timer_running);
+    s_timer_running = false;
+    s_timer_handler(&s_timer_handler);
+}
+
+static void events_run(void)
+{
+    for(uint32_t idx=0; idx<s_event_num; idx++) {
+        s_event[idx].custom_event_handler(s_event[idx].evt_id, s_event[idx].data);
+    }
+    s_event_num = 0;
+}
+
+/*********************************************************
+ * the send side and the callbacks, frames are sent in plain
+ */
+static uint32_t s_tx_sn = 0;
+static tuya_ble_cb_evt_param_t s_cb_evt;
+static uint32_t s_cb_num = 0;
+
+uint8_t tuya_ble_encryption(uint8_t encryption_mode,uint8_t *iv,uint8_t *in_buf,uint32_t in_len,uint32_t *out_len,uint8_t *out_buf,tuya_ble_parameters_settings_t *current_para_data,uint8_t *dev_rand)
+{
+    *out_len = (in_len + 15) / 16 * 16;
+    memset(out_buf, 0, *out_len);
+    memcpy(out_buf, in_buf, in_len);
+    return 0;
+}
+
+tuya_ble_status_t tuya_ble_gatt_send_frame_enqueue(uint8_t *p_frame, uint16_t frame_len)
+{
+    //| encryption mode | iv(16) | sn(4) | ...
+    uint8_t* sn = &p_frame[(p_frame[0] == ENCRYPTION_MODE_NONE) ? 1 : 17];
+    s_tx_sn = (sn[0]<<24) | (sn[1]<<16) | (sn[2]<<8) | sn[3];
+    tuya_ble_free(p_frame);
+    return TUYA_BLE_SUCCESS;
+}
+
+uint8_t tuya_ble_cb_event_send(tuya_ble_cb_evt_param_t *evt)
+{
+    s_cb_evt = *evt;
+    s_cb_num++;
+    return 0;
+}
+
+/*********************************************************
+ * the rest of the sdk
+ */
+void tuya_ble_adv_change(void) {}
+void tuya_ble_app_production_test_process(uint8_t channel,uint8_t *p_in_data,uint16_t in_len) {}
+uint8_t tuya_ble_check_sum(uint8_t *pbuf,uint16_t len) { return 0; }
+void tuya_ble_connect_monitor_timer_stop(void) {}
+tuya_ble_connect_status_t tuya_ble_connect_status_get(void) { return UNBONDING_CONN; }
+void tuya_ble_connect_status_set(tuya_ble_connect_status_t status) {}
+uint16_t tuya_ble_crc16_compute(uint8_t * p_data, uint16_t size, uint16_t * p_crc) { return 0; }
+void tuya_ble_device_enter_critical(void) {}
+void tuya_ble_device_exit_critical(void) {}
+uint8_t tuya_ble_event_send(tuya_ble_evt_param_t *evt) { return 1; }
+tuya_ble_status_t tuya_ble_gap_disconnect(void) { return TUYA_BLE_SUCCESS; }
+uint8_t tuya_ble_get_adv_connect_request_bit_status(void) { return 0; }
+uint32_t tuya_ble_mytime_2_utc_sec(tuya_ble_time_struct_data_t *currTime, bool daylightSaving) { return 0; }
+tuya_ble_status_t tuya_ble_rand_generator(uint8_t* p_buf, uint8_t len) { return TUYA_BLE_SUCCESS; }
+bool tuya_ble_register_key_generate(uint8_t *output,tuya_ble_parameters_settings_t *current_para) { return false; }
+tuya_ble_status_t tuya_ble_rtc_set_timestamp(uint32_t timestamp,int32_t timezone) { return TUYA_BLE_SUCCESS; }
+uint32_t tuya_ble_storage_save_sys_settings(void) { return 0; }
+void tuya_ble_uart_common_mcu_ota_data_from_ble_handler(uint16_t cmd,uint8_t*recv_data,uint32_t recv_len) {}
+
+/*********************************************************
+ * the app side, a frame split into sub packages
+ */
+typedef struct {
+    uint8_t  data[TUYA_BLE_AIR_FRAME_MAX + 64];
+    uint32_t len;
+    uint8_t  pkg[PKG_MAX][SNGL_PKG_TRSFR_LMT];
+    uint8_t  pkg_len[PKG_MAX];
+    uint32_t pkg_num;
+} frame_t;
+
+static frame_t s_frame;
+
+//| encryption mode | iv(16) | data(n*16) |
+static void frame_build(frame_t* frame, uint8_t version, uint8_t mode, uint32_t len)
+{
+    frm_trsmitr_proc_s trsmitr;
+    mtp_ret ret;
+
+    frame->len = len;
+    frame->data[0] = mode;
+    for(uint32_t idx=1; idx<len; idx++) {
+        frame->data[idx] = test_rand();
+    }
+
+    trsmitr_init(&trsmitr);
+    frame->pkg_num = 0;
+    do {
+        ret = trsmitr_send_pkg_encode(&trsmitr, version, frame->data, len);
+        TEST_CHECK((ret == MTP_OK) || (ret == MTP_TRSMITR_CONTINUE));
+        TEST_CHECK(frame->pkg_num < PKG_MAX);
+        memcpy(frame->pkg[frame->pkg_num], get_trsmitr_subpkg(&trsmitr), get_trsmitr_subpkg_len(&trsmitr));
+        frame->pkg_len[frame->pkg_num] = get_trsmitr_subpkg_len(&trsmitr);
+        frame->pkg_num++;
+    } while((ret == MTP_TRSMITR_CONTINUE) && (frame->pkg_num < PKG_MAX));
+}
+
+static void pkg_send(frame_t* frame, uint32_t pkg)
+{
+    tuya_ble_commonData_rx_proc(frame->pkg[pkg], frame->pkg_len[pkg]);
+}
+
+static void frame_send(frame_t* frame)
+{
+    for(uint32_t pkg=0; pkg<frame->pkg_num; pkg++) {
+        pkg_send(frame, pkg);
+    }
+}
+
+static bool frame_received(frame_t* frame)
+{
+    return (s_rx_len == frame->len) && (memcmp(s_rx_frame, frame->data, frame->len) == 0);
+}
+
+static void reset(void)
+{
+    tuya_ble_air_recv_packet_free();
+    events_run();
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+    memset(&tuya_ble_current_para, 0, sizeof(tuya_ble_current_para));
+    s_rx_len = 0;
+    s_rx_num = 0;
+    s_heap_allocs = 0;
+}
+
+/*********************************************************
+ * cases
+ */
+static void test_in_order(void)
+{
+    static const uint32_t lens[] = {1, 2, 16, 17+16, 17+16*20, 17+16*62};
+
+    reset();
+    for(uint32_t idx=0; idx<sizeof(lens)/sizeof(lens[0]); idx++) {
+        frame_build(&s_frame, FRAME_VERSION, (lens[idx] < 17) ? ENCRYPTION_MODE_NONE : ENCRYPTION_MODE_SESSION_KEY, lens[idx]);
+        frame_send(&s_frame);
+        TEST_CHECK_EQ(s_rx_num, idx + 1);
+        TEST_CHECK(frame_received(&s_frame));
+        //the frame buffer is given back once the frame is whole
+        TEST_CHECK_EQ(s_heap_blocks, 0);
+    }
+}
+
+static void test_duplicate(void)
+{
+    reset();
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_KEY_1, 17+16*10);
+    TEST_CHECK(s_frame.pkg_num > 4);
+
+    //every sub package twice, a repeat adds nothing
+    for(uint32_t pkg=0; pkg<s_frame.pkg_num; pkg++) {
+        pkg_send(&s_frame, pkg);
+        if(pkg + 1 < s_frame.pkg_num) {
+            pkg_send(&s_frame, pkg);
+        }
+    }
+    TEST_CHECK_EQ(s_rx_num, 1);
+    TEST_CHECK(frame_received(&s_frame));
+
+    //a repeat of the last one comes after the frame is done
+    pkg_send(&s_frame, s_frame.pkg_num - 1);
+    TEST_CHECK_EQ(s_rx_num, 1);
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+}
+
+static void test_out_of_order(void)
+{
+    reset();
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_KEY_1, 17+16*10);
+
+    //2 before 1, the frame is dropped at once
+    pkg_send(&s_frame, 0);
+    TEST_CHECK_EQ(s_heap_blocks, 1);
+    pkg_send(&s_frame, 2);
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+    //and the rest of it is refused
+    for(uint32_t pkg=1; pkg<s_frame.pkg_num; pkg++) {
+        pkg_send(&s_frame, pkg);
+    }
+    TEST_CHECK_EQ(s_rx_num, 0);
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+
+    //an older one
+    pkg_send(&s_frame, 0);
+    pkg_send(&s_frame, 1);
+    pkg_send(&s_frame, 2);
+    pkg_send(&s_frame, 1);
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+
+    //a lost one
+    pkg_send(&s_frame, 0);
+    pkg_send(&s_frame, 1);
+    pkg_send(&s_frame, 3);
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+    TEST_CHECK_EQ(s_rx_num, 0);
+
+    //the app sends the frame again
+    frame_send(&s_frame);
+    TEST_CHECK_EQ(s_rx_num, 1);
+    TEST_CHECK(frame_received(&s_frame));
+}
+
+static void test_stray(void)
+{
+    frame_t* other = malloc(sizeof(frame_t));
+
+    reset();
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_KEY_1, 17+16*10);
+    frame_build(other, FRAME_VERSION, ENCRYPTION_MODE_KEY_2, 17+16*8);
+
+    //no frame in progress, nothing is taken from the heap for them
+    for(uint32_t pkg=1; pkg<s_frame.pkg_num; pkg++) {
+        pkg_send(&s_frame, pkg);
+    }
+    TEST_CHECK_EQ(s_heap_allocs, 0);
+    TEST_CHECK_EQ(s_rx_num, 0);
+
+    //a new first sub package gives up the frame in progress
+    pkg_send(&s_frame, 0);
+    pkg_send(&s_frame, 1);
+    frame_send(other);
+    TEST_CHECK_EQ(s_rx_num, 1);
+    TEST_CHECK(frame_received(other));
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+
+    //the tail of the given up frame is stray now
+    for(uint32_t pkg=2; pkg<s_frame.pkg_num; pkg++) {
+        pkg_send(&s_frame, pkg);
+    }
+    TEST_CHECK_EQ(s_rx_num, 1);
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+
+    //sub packages that are cut or make no sense
+    static const uint8_t bad[][4] = {
+        {0x80},                     //cut sub package number
+        {0x00, 0x80},               //cut frame length
+        {0x00, 0x00, 0x30},         //frame length 0
+        {0x00, 0x05},               //no version
+        {0xFF, 0xFF, 0xFF, 0xFF},   //sub package number without end
+    };
+    static const uint8_t bad_len[] = {1, 2, 3, 2, 4};
+    for(uint32_t idx=0; idx<sizeof(bad_len); idx++) {
+        pkg_send(&s_frame, 0);
+        tuya_ble_commonData_rx_proc((uint8_t*)bad[idx], bad_len[idx]);
+        for(uint32_t pkg=1; pkg<s_frame.pkg_num; pkg++) {
+            pkg_send(&s_frame, pkg);
+        }
+        TEST_CHECK_EQ(s_heap_blocks, 0);
+        tuya_ble_commonData_rx_proc((uint8_t*)bad[idx], bad_len[idx]);
+    }
+    TEST_CHECK_EQ(s_rx_num, 1);
+    free(other);
+}
+
+//everything the first sub package tells is checked before the heap is used
+static void test_head_check(void)
+{
+    reset();
+
+    frame_build(&s_frame, 1, ENCRYPTION_MODE_KEY_1, 17+16*2);
+    frame_send(&s_frame);
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_MAX, 17+16*2);
+    frame_send(&s_frame);
+    //not mode, iv and whole blocks
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_KEY_1, 17+16*2+1);
+    frame_send(&s_frame);
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_KEY_1, 17);
+    frame_send(&s_frame);
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_KEY_1, 17+16*64);
+    TEST_CHECK(s_frame.len > TUYA_BLE_AIR_FRAME_MAX);
+    frame_send(&s_frame);
+    //a bound device takes no plain frame
+    tuya_ble_current_para.sys_settings.bound_flag = 1;
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_NONE, 30);
+    frame_send(&s_frame);
+    TEST_CHECK_EQ(s_rx_num, 0);
+    TEST_CHECK_EQ(s_heap_allocs, 0);
+
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_KEY_4, 17+16*2);
+    frame_send(&s_frame);
+    TEST_CHECK_EQ(s_rx_num, 1);
+    TEST_CHECK(frame_received(&s_frame));
+}
+
+//random repeats, swaps and losses, checked against the rules of the decoder
+static void test_random(void)
+{
+    reset();
+
+    for(uint32_t round=0; round<3000; round++) {
+        uint32_t order[PKG_MAX*2];
+        uint32_t order_num = 0;
+        uint32_t expect = 0;
+        int32_t  cur = -1;
+        uint32_t rx_num = s_rx_num;
+
+        frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_SESSION_KEY, 17 + 16*(1 + test_rand()%30));
+        for(uint32_t pkg=0; pkg<s_frame.pkg_num; pkg++) {
+            switch(test_rand() % 16) {
+                case 0: {
+                    //lost
+                } break;
+                case 1: {
+                    order[order_num++] = pkg;
+                    order[order_num++] = pkg;
+                } break;
+                case 2: {
+                    if(pkg + 1 < s_frame.pkg_num) {
+                        order[order_num++] = pkg + 1;
+                        order[order_num++] = pkg;
+                        pkg++;
+                        break;
+                    }
+                    order[order_num++] = pkg;
+                } break;
+                case 3: {
+                    //an old one again
+                    order[order_num++] = pkg;
+                    order[order_num++] = test_rand() % (pkg + 1);
+                } break;
+                default: {
+                    order[order_num++] = pkg;
+                } break;
+            }
+        }
+
+        for(uint32_t idx=0; idx<order_num; idx++) {
+            int32_t pkg = order[idx];
+
+            pkg_send(&s_frame, pkg);
+            if(pkg == 0) {
+                cur = 0;
+            }
+            else if((cur < 0) || (pkg == cur)) {
+                //stray or repeated
+            }
+            else if(pkg == cur + 1) {
+                cur = pkg;
+            }
+            else {
+                cur = -1;
+            }
+            if((cur >= 0) && (cur + 1 == (int32_t)s_frame.pkg_num)) {
+                expect++;
+                cur = -1;
+                TEST_CHECK(frame_received(&s_frame));
+            }
+            //only the frame in progress holds a buffer
+            TEST_CHECK_EQ(s_heap_blocks, (cur >= 0) ? 1 : 0);
+        }
+        TEST_CHECK_EQ(s_rx_num - rx_num, expect);
+        //the link goes down with a frame in progress
+        tuya_ble_air_recv_packet_free();
+        TEST_CHECK_EQ(s_heap_blocks, 0);
+    }
+    reset();
+}
+
+//| mode | sn(4) | ack_sn(4) | cmd(2) | len(2) | status |
+static uint32_t report_response(uint32_t ack_sn)
+{
+    uint8_t buf[14] = {ENCRYPTION_MODE_SESSION_KEY};
+
+    buf[5] = ack_sn >> 24;
+    buf[6] = ack_sn >> 16;
+    buf[7] = ack_sn >> 8;
+    buf[8] = ack_sn;
+    buf[9] = FRM_STAT_REPORT_RESP >> 8;
+    buf[10] = FRM_STAT_REPORT_RESP & 0xFF;
+    buf[12] = 1;
+    s_cb_num = 0;
+    tuya_ble_evt_process(FRM_STAT_REPORT_RESP, buf, sizeof(buf));
+    TEST_CHECK_EQ(s_cb_num, 1);
+    TEST_CHECK_EQ(s_cb_evt.evt, TUYA_BLE_CB_EVT_DP_DATA_REPORT_RESPONSE);
+    return s_cb_evt.dp_response_data.seq;
+}
+
+//the response to a dp report is matched to the report by the sn of its frame
+static void test_report_response(void)
+{
+    uint8_t dp[] = {0x01, 0x01, 0x01, 0x01};
+    uint32_t sn[12];
+
+    reset();
+    tuya_ble_reset_ble_sn();
+    TEST_CHECK_EQ(tuya_ble_dp_data_report_send(5, dp, sizeof(dp), ENCRYPTION_MODE_SESSION_KEY), 0);
+    sn[5] = s_tx_sn;
+    TEST_CHECK_EQ(tuya_ble_dp_data_report_send(6, dp, sizeof(dp), ENCRYPTION_MODE_SESSION_KEY), 0);
+    sn[6] = s_tx_sn;
+    //a frame that is not a dp report between them
+    TEST_CHECK_EQ(tuya_ble_commData_send(FRM_DATA_PASSTHROUGH_REQ, 0, dp, sizeof(dp), ENCRYPTION_MODE_SESSION_KEY), 0);
+    sn[0] = s_tx_sn;
+    TEST_CHECK_EQ(tuya_ble_dp_data_report_send(7, dp, sizeof(dp), ENCRYPTION_MODE_SESSION_KEY), 0);
+    sn[7] = s_tx_sn;
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+
+    //in any order, a lost response shifts nothing
+    TEST_CHECK_EQ(report_response(sn[6]), 6);
+    TEST_CHECK_EQ(report_response(sn[7]), 7);
+    TEST_CHECK_EQ(report_response(sn[0]), 0);
+    TEST_CHECK_EQ(report_response(sn[5]), 5);
+    TEST_CHECK_EQ(report_response(sn[7] + 1), 0);
+
+    //only the last reports are kept
+    for(uint32_t seq=8; seq<12; seq++) {
+        TEST_CHECK_EQ(tuya_ble_dp_data_report_send(seq, dp, sizeof(dp), ENCRYPTION_MODE_SESSION_KEY), 0);
+        sn[seq] = s_tx_sn;
+    }
+    for(uint32_t seq=12; seq<16; seq++) {
+        TEST_CHECK_EQ(tuya_ble_dp_data_report_send(seq, dp, sizeof(dp), ENCRYPTION_MODE_SESSION_KEY), 0);
+    }
+    TEST_CHECK_EQ(report_response(sn[5]), 0);
+    TEST_CHECK_EQ(report_response(sn[8]), 8);
+    TEST_CHECK_EQ(report_response(sn[11]), 11);
+
+    //a new link sends the same sn again
+    tuya_ble_reset_ble_sn();
+    TEST_CHECK_EQ(report_response(sn[8]), 0);
+    TEST_CHECK_EQ(tuya_ble_dp_data_report_send(20, dp, sizeof(dp), ENCRYPTION_MODE_SESSION_KEY), 0);
+    TEST_CHECK_EQ(s_tx_sn, 1);
+    TEST_CHECK_EQ(report_response(1), 20);
+}
+
+#if (TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS > 0)
+static void test_timeout(void)
+{
+    reset();
+    frame_build(&s_frame, FRAME_VERSION, ENCRYPTION_MODE_KEY_1, 17+16*10);
+
+    //the app stops sending, the frame is freed in the main process
+    for(uint32_t pkg=0; pkg<3; pkg++) {
+        pkg_send(&s_frame, pkg);
+    }
+    TEST_CHECK_EQ(s_heap_blocks, 1);
+    timer_fire();
+    TEST_CHECK_EQ(s_heap_blocks, 1);
+    events_run();
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+    //what comes late is stray
+    for(uint32_t pkg=3; pkg<s_frame.pkg_num; pkg++) {
+        pkg_send(&s_frame, pkg);
+    }
+    TEST_CHECK_EQ(s_rx_num, 0);
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+
+    //a sub package between the timeout and the main process keeps the frame
+    for(uint32_t pkg=0; pkg<3; pkg++) {
+        pkg_send(&s_frame, pkg);
+    }
+    timer_fire();
+    pkg_send(&s_frame, 3);
+    events_run();
+    TEST_CHECK_EQ(s_heap_blocks, 1);
+    TEST_CHECK(s_timer_running);
+    for(uint32_t pkg=4; pkg<s_frame.pkg_num; pkg++) {
+        pkg_send(&s_frame, pkg);
+    }
+    TEST_CHECK_EQ(s_rx_num, 1);
+    TEST_CHECK(frame_received(&s_frame));
+    //a whole frame stops the timer
+    TEST_CHECK(!s_timer_running);
+
+    //a dropped frame stops it as well
+    pkg_send(&s_frame, 0);
+    pkg_send(&s_frame, 1);
+    TEST_CHECK(s_timer_running);
+    pkg_send(&s_frame, 3);
+    TEST_CHECK(!s_timer_running);
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+    TEST_CHECK_EQ(s_timer_creates, 1);
+}
+#endif
+
+int main(void)
+{
+    test_in_order();
+    test_duplicate();
+    test_out_of_order();
+    test_stray();
+    test_head_check();
+    test_random();
+    test_report_response();
+#if (TUYA_BLE_AIR_FRAME_RECV_TIMEOUT_MS > 0)
+    test_timeout();
+#else
+    TEST_CHECK_EQ(s_timer_creates, 0);
+#endif
+    return TEST_RESULT();
+}
@@ -0,0 +1,310 @@
+#include "test_common.h"
+#include "app_dp_batch.h"
+
+#define DP_HEAD_LEN             3
+#define FRAME_MAX_NUM           8
+//DT_RAW, the batch does not look at the type
+#define DP_TYPE_RAW             0x00
+
+/*********************************************************
+ * the rest of the firmware, the reports are kept as sent frames
+ */
+typedef struct {
+    uint8_t  buf[APP_DP_BATCH_MAX_LEN];
+    uint32_t len;
+} frame_t;
+
+static frame_t s_frame[FRAME_MAX_NUM];
+static uint32_t s_frame_num = 0;
+static tuya_ble_connect_status_t s_conn_status = BONDING_CONN;
+static suble_timer_t* s_timer = NULL;
+static uint32_t s_timer_ms = 0;
+
+tuya_ble_connect_status_t app_port_get_connect_status(void)
+{
+    return s_conn_status;
+}
+
+uint32_t app_port_dp_report_send(uint8_t *buf, uint32_t size)
+{
+    TEST_CHECK(size <= APP_DP_BATCH_MAX_LEN);
+    TEST_CHECK(s_frame_num < FRAME_MAX_NUM);
+    if(s_frame_num < FRAME_MAX_NUM) {
+        memcpy(s_frame[s_frame_num].buf, buf, size);
+        s_frame[s_frame_num].len = size;
+        s_frame_num++;
+    }
+    return APP_PORT_SUCCESS;
+}
+
+void suble_timer_start_0(suble_timer_t* timer, uint32_t ms, uint32_t count)
+{
+    TEST_CHECK_EQ(count, 1);
+    s_timer = timer;
+    s_timer_ms = ms;
+}
+
+void suble_timer_stop_0(suble_timer_t* timer)
+{
+    if(s_timer == timer) {
+        s_timer = NULL;
+    }
+}
+
+bool suble_timer_is_running(suble_timer_t* timer)
+{
+    return (s_timer != NULL) && (s_timer == timer);
+}
+
+//the end of the batch window
+static void timer_fire(void)
+{
+    suble_timer_t* timer = s_timer;
+    TEST_CHECK(timer != NULL);
+    if(timer != NULL) {
+        s_timer = NULL;
+        timer->handler(timer);
+    }
+}
+
+/*********************************************************
+ * dps
+ */
+static uint32_t dp_put(uint8_t* buf, uint8_t id, uint8_t type, uint8_t len, uint8_t fill)
+{
+    buf[0] = id;
+    buf[1] = type;
+    buf[2] = len;
+    memset(&buf[DP_HEAD_LEN], fill, len);
+    return DP_HEAD_LEN + len;
+}
+
+static uint32_t report(uint8_t id, uint8_t len, uint8_t fill)
+{
+    uint8_t buf[APP_DP_BATCH_MAX_LEN];
+    uint32_t size = dp_put(buf, id, DP_TYPE_RAW, len, fill);
+    return app_dp_batch_add(buf, size);
+}
+
+//offset of the dp in the frame, the frame is checked to be whole dps
+static int32_t frame_find(frame_t* frame, uint8_t id)
+{
+    int32_t found = -1;
+    uint32_t offset = 0;
+
+    while(offset < frame->len) {
+        TEST_CHECK(offset + DP_HEAD_LEN <= frame->len);
+        if(frame->buf[offset] == id) {
+            //a dp is in a frame once
+            TEST_CHECK(found < 0);
+            found = offset;
+        }
+        offset += DP_HEAD_LEN + frame->buf[offset+2];
+    }
+    TEST_CHECK_EQ(offset, frame->len);
+    return found;
+}
+
+static void frame_check_dp(frame_t* frame, uint8_t id, uint8_t len, uint8_t fill)
+{
+    int32_t offset = frame_find(frame, id);
+
+    TEST_CHECK(offset >= 0);
+    if(offset < 0) {
+        return;
+    }
+    TEST_CHECK_EQ(frame->buf[offset+1], DP_TYPE_RAW);
+    TEST_CHECK_EQ(frame->buf[offset+2], len);
+    for(uint32_t idx=0; idx<len; idx++) {
+        TEST_CHECK_EQ(frame->buf[offset+DP_HEAD_LEN+idx], fill);
+    }
+}
+
+static void reset(void)
+{
+    app_dp_batch_flush();
+    memset(s_frame, 0, sizeof(s_frame));
+    s_frame_num = 0;
+    s_conn_status = BONDING_CONN;
+    TEST_CHECK(s_timer == NULL);
+}
+
+/*********************************************************
+ * cases
+ */
+static void test_window(void)
+{
+    reset();
+
+    //held until the end of the window, then one frame
+    TEST_CHECK_EQ(report(1, 1, 0x01), APP_PORT_SUCCESS);
+    TEST_CHECK(s_timer != NULL);
+    TEST_CHECK_EQ(s_timer_ms, APP_DP_BATCH_WINDOW_MS);
+    TEST_CHECK_EQ(report(2, 4, 0x22), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(report(3, 0, 0), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 0);
+    timer_fire();
+    TEST_CHECK_EQ(s_frame_num, 1);
+    TEST_CHECK_EQ(s_frame[0].len, 3*DP_HEAD_LEN + 1 + 4);
+    frame_check_dp(&s_frame[0], 1, 1, 0x01);
+    frame_check_dp(&s_frame[0], 2, 4, 0x22);
+    frame_check_dp(&s_frame[0], 3, 0, 0);
+
+    //the next report opens a new window
+    TEST_CHECK(s_timer == NULL);
+    TEST_CHECK_EQ(report(1, 1, 0x00), APP_PORT_SUCCESS);
+    TEST_CHECK(s_timer != NULL);
+    timer_fire();
+    TEST_CHECK_EQ(s_frame_num, 2);
+    TEST_CHECK_EQ(s_frame[1].len, DP_HEAD_LEN + 1);
+}
+
+static void test_last_value_wins(void)
+{
+    uint8_t buf[64];
+    uint32_t size = 0;
+
+    reset();
+
+    TEST_CHECK_EQ(report(1, 1, 0x00), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(report(2, 4, 0x22), APP_PORT_SUCCESS);
+    //another length for the same dp
+    TEST_CHECK_EQ(report(1, 8, 0x11), APP_PORT_SUCCESS);
+    //and twice in one report
+    size += dp_put(&buf[size], 2, DP_TYPE_RAW, 2, 0x33);
+    size += dp_put(&buf[size], 4, DP_TYPE_RAW, 1, 0x44);
+    size += dp_put(&buf[size], 2, DP_TYPE_RAW, 3, 0x55);
+    TEST_CHECK_EQ(app_dp_batch_add(buf, size), APP_PORT_SUCCESS);
+    timer_fire();
+
+    TEST_CHECK_EQ(s_frame_num, 1);
+    TEST_CHECK_EQ(s_frame[0].len, 3*DP_HEAD_LEN + 8 + 1 + 3);
+    frame_check_dp(&s_frame[0], 1, 8, 0x11);
+    frame_check_dp(&s_frame[0], 2, 3, 0x55);
+    frame_check_dp(&s_frame[0], 4, 1, 0x44);
+}
+
+static void test_flush(void)
+{
+    reset();
+
+    //another report flushes the batch first
+    TEST_CHECK_EQ(report(1, 1, 0x01), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(app_dp_batch_flush(), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 1);
+    TEST_CHECK(s_timer == NULL);
+    frame_check_dp(&s_frame[0], 1, 1, 0x01);
+
+    //nothing left to send
+    TEST_CHECK_EQ(app_dp_batch_flush(), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 1);
+}
+
+static void test_full(void)
+{
+    uint32_t dp_len = DP_HEAD_LEN + 100;
+
+    reset();
+
+    //a dp that does not fit sends the batch right away and starts the next one
+    TEST_CHECK_EQ(report(1, 100, 0x01), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(report(2, 100, 0x02), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 0);
+    TEST_CHECK(2*dp_len + dp_len > APP_DP_BATCH_MAX_LEN);
+    TEST_CHECK_EQ(report(3, 100, 0x03), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 1);
+    TEST_CHECK_EQ(s_frame[0].len, 2*dp_len);
+    frame_check_dp(&s_frame[0], 1, 100, 0x01);
+    frame_check_dp(&s_frame[0], 2, 100, 0x02);
+    TEST_CHECK(s_timer != NULL);
+    timer_fire();
+    TEST_CHECK_EQ(s_frame_num, 2);
+    TEST_CHECK_EQ(s_frame[1].len, dp_len);
+    frame_check_dp(&s_frame[1], 3, 100, 0x03);
+
+    //a new value of a batched dp replaces it before the room is checked
+    TEST_CHECK_EQ(report(1, 100, 0x01), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(report(2, 100, 0x02), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(report(2, 150, 0x12), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 2);
+    timer_fire();
+    TEST_CHECK_EQ(s_frame_num, 3);
+    frame_check_dp(&s_frame[2], 1, 100, 0x01);
+    frame_check_dp(&s_frame[2], 2, 150, 0x12);
+
+    //the largest dp fills a frame by itself
+    TEST_CHECK_EQ(report(1, 1, 0x01), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(report(5, 255, 0x05), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 4);
+    TEST_CHECK_EQ(s_frame[3].len, DP_HEAD_LEN + 1);
+    timer_fire();
+    TEST_CHECK_EQ(s_frame_num, 5);
+    TEST_CHECK_EQ(s_frame[4].len, APP_DP_BATCH_MAX_LEN);
+    frame_check_dp(&s_frame[4], 5, 255, 0x05);
+}
+
+static void test_malformed(void)
+{
+    uint8_t buf[64];
+    uint32_t size = 0;
+
+    reset();
+
+    TEST_CHECK_EQ(app_dp_batch_add(NULL, 4), APP_PORT_ERROR_COMMON);
+    TEST_CHECK_EQ(app_dp_batch_add(buf, 0), APP_PORT_ERROR_COMMON);
+
+    //a cut head
+    dp_put(buf, 1, DP_TYPE_RAW, 4, 0x01);
+    TEST_CHECK_EQ(app_dp_batch_add(buf, 2), APP_PORT_ERROR_COMMON);
+    //a length past the end
+    TEST_CHECK_EQ(app_dp_batch_add(buf, DP_HEAD_LEN + 3), APP_PORT_ERROR_COMMON);
+    //a byte behind the last dp
+    TEST_CHECK_EQ(app_dp_batch_add(buf, DP_HEAD_LEN + 4 + 1), APP_PORT_ERROR_COMMON);
+
+    //a report with a cut dp at its end adds none of its dps
+    size += dp_put(&buf[size], 1, DP_TYPE_RAW, 1, 0x01);
+    size += dp_put(&buf[size], 2, DP_TYPE_RAW, 8, 0x02);
+    TEST_CHECK_EQ(app_dp_batch_add(buf, size - 1), APP_PORT_ERROR_COMMON);
+    TEST_CHECK(s_timer == NULL);
+    TEST_CHECK_EQ(app_dp_batch_flush(), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 0);
+
+    //and the batch is left as it was
+    TEST_CHECK_EQ(report(3, 2, 0x03), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(app_dp_batch_add(buf, size - 1), APP_PORT_ERROR_COMMON);
+    timer_fire();
+    TEST_CHECK_EQ(s_frame_num, 1);
+    TEST_CHECK_EQ(s_frame[0].len, DP_HEAD_LEN + 2);
+    frame_check_dp(&s_frame[0], 3, 2, 0x03);
+}
+
+static void test_disconnected(void)
+{
+    reset();
+
+    //the link is gone at the end of the window, the batch is dropped
+    TEST_CHECK_EQ(report(1, 1, 0x01), APP_PORT_SUCCESS);
+    s_conn_status = UNBONDING_UNCONN;
+    TEST_CHECK_EQ(app_dp_batch_flush(), APP_PORT_ERROR_COMMON);
+    TEST_CHECK_EQ(s_frame_num, 0);
+
+    s_conn_status = BONDING_CONN;
+    TEST_CHECK_EQ(app_dp_batch_flush(), APP_PORT_SUCCESS);
+    TEST_CHECK_EQ(s_frame_num, 0);
+    TEST_CHECK_EQ(report(2, 1, 0x02), APP_PORT_SUCCESS);
+    timer_fire();
+    TEST_CHECK_EQ(s_frame_num, 1);
+    TEST_CHECK_EQ(frame_find(&s_frame[0], 1), -1);
+    frame_check_dp(&s_frame[0], 2, 1, 0x02);
+}
+
+int main(void)
+{
+    test_window();
+    test_last_value_wins();
+    test_flush();
+    test_full();
+    test_malformed();
+    test_disconnected();
+    return TEST_RESULT();
+}
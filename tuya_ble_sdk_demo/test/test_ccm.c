@@ -0,0 +1,113 @@
+#include "test_common.h"
+#include "ccm.h"
+
+//SP800-38C appendix C, examples 1 to 3
+typedef struct {
+    size_t iv_len;
+    size_t add_len;
+    size_t len;
+    size_t tag_len;
+    const char* out; //ciphertext and tag
+} ccm_vector_t;
+
+static const ccm_vector_t s_vectors[] = {
+    { 7,  8,  4, 4, "7162015b4dac255d" },
+    { 8, 16, 16, 6, "d2a1f0e051ea5f62081a7792073d593d1fc64fbfaccd" },
+    {12, 20, 24, 8, "e3b201a9f5b71a7a9b1ceaeccd97e70b6176aad9a4428aa5484392fbc1b09951" },
+};
+
+static const unsigned char s_key[16] = {
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+};
+
+static void hex_to_bin(const char* hex, unsigned char* out)
+{
+    for(size_t i=0; hex[2*i]; i++) {
+        unsigned int byte;
+        sscanf(&hex[2*i], "%2x", &byte);
+        out[i] = (unsigned char)byte;
+    }
+}
+
+//iv, add and plaintext of the examples count up from 0x10, 0x00 and 0x20
+static void fill(unsigned char* buf, size_t len, unsigned char first)
+{
+    for(size_t i=0; i<len; i++) {
+        buf[i] = first + i;
+    }
+}
+
+static void test_one_shot(const ccm_vector_t* v)
+{
+    unsigned char iv[13], add[20], in[24], out[24], tag[16], expect[40];
+
+    fill(iv, v->iv_len, 0x10);
+    fill(add, v->add_len, 0x00);
+    fill(in, v->len, 0x20);
+    hex_to_bin(v->out, expect);
+
+    TEST_CHECK_EQ(aes_ccm_encrypt_and_tag(s_key, iv, v->iv_len, add, v->add_len, in, v->len, out, tag, v->tag_len), 0);
+    TEST_CHECK(memcmp(out, expect, v->len) == 0);
+    TEST_CHECK(memcmp(tag, expect + v->len, v->tag_len) == 0);
+
+    //in place
+    TEST_CHECK_EQ(aes_ccm_auth_decrypt(s_key, iv, v->iv_len, add, v->add_len, out, v->len, out, tag, v->tag_len), 0);
+    TEST_CHECK(memcmp(out, in, v->len) == 0);
+
+    tag[0] ^= 0x01;
+    TEST_CHECK_EQ(aes_ccm_auth_decrypt(s_key, iv, v->iv_len, add, v->add_len, expect, v->len, out, tag, v->tag_len),
+                  MBEDTLS_ERR_CCM_AUTH_FAILED);
+}
+
+//the key is set once, the message is passed in place in chunks of every size
+static void test_streamed(aes_ccm_context* ctx, const ccm_vector_t* v)
+{
+    unsigned char iv[13], add[20], in[24], buf[24], tag[16], expect[40];
+
+    fill(iv, v->iv_len, 0x10);
+    fill(add, v->add_len, 0x00);
+    fill(in, v->len, 0x20);
+    hex_to_bin(v->out, expect);
+
+    for(size_t chunk=1; chunk<=v->len; chunk++) {
+        memcpy(buf, in, v->len);
+        TEST_CHECK_EQ(aes_ccm_starts(ctx, AES_CCM_ENCRYPT, iv, v->iv_len, add, v->add_len, v->len, v->tag_len), 0);
+        for(size_t pos=0; pos<v->len; pos+=chunk) {
+            size_t n = (v->len - pos < chunk) ? (v->len - pos) : chunk;
+            TEST_CHECK_EQ(aes_ccm_update(ctx, buf + pos, n, buf + pos), 0);
+        }
+        TEST_CHECK_EQ(aes_ccm_finish(ctx, tag), 0);
+        TEST_CHECK(memcmp(buf, expect, v->len) == 0);
+        TEST_CHECK(memcmp(tag, expect + v->len, v->tag_len) == 0);
+
+        TEST_CHECK_EQ(aes_ccm_starts(ctx, AES_CCM_DECRYPT, iv, v->iv_len, add, v->add_len, v->len, v->tag_len), 0);
+        for(size_t pos=0; pos<v->len; pos+=chunk) {
+            size_t n = (v->len - pos < chunk) ? (v->len - pos) : chunk;
+            TEST_CHECK_EQ(aes_ccm_update(ctx, buf + pos, n, buf + pos), 0);
+        }
+        TEST_CHECK_EQ(aes_ccm_check_tag(ctx, tag), 0);
+        TEST_CHECK(memcmp(buf, in, v->len) == 0);
+    }
+
+    //more or less data than announced
+    TEST_CHECK_EQ(aes_ccm_starts(ctx, AES_CCM_ENCRYPT, iv, v->iv_len, add, v->add_len, v->len, v->tag_len), 0);
+    TEST_CHECK_EQ(aes_ccm_update(ctx, in, v->len + 1, buf), MBEDTLS_ERR_CCM_BAD_INPUT);
+    TEST_CHECK_EQ(aes_ccm_starts(ctx, AES_CCM_ENCRYPT, iv, v->iv_len, add, v->add_len, v->len, v->tag_len), 0);
+    TEST_CHECK_EQ(aes_ccm_update(ctx, in, v->len - 1, buf), 0);
+    TEST_CHECK_EQ(aes_ccm_finish(ctx, tag), MBEDTLS_ERR_CCM_BAD_INPUT);
+}
+
+int main(void)
+{
+    aes_ccm_context ctx;
+
+    aes_ccm_init(&ctx);
+    TEST_CHECK_EQ(aes_ccm_setkey(&ctx, s_key), 0);
+    for(size_t i=0; i<sizeof(s_vectors)/sizeof(s_vectors[0]); i++) {
+        test_one_shot(&s_vectors[i]);
+        test_streamed(&ctx, &s_vectors[i]);
+    }
+    aes_ccm_free(&ctx);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,39 @@
+#ifndef __TEST_COMMON_H__
+#define __TEST_COMMON_H__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+static int test_failed = 0;
+
+//a failed check is printed and counted, the test goes on
+#define TEST_CHECK(cond) do { \
+    if(!(cond)) { \
+        printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        test_failed++; \
+    } \
+} while(0)
+
+#define TEST_CHECK_EQ(a, b) do { \
+    long long a_ = (long long)(a), b_ = (long long)(b); \
+    if(a_ != b_) { \
+        printf("%s:%d: check failed: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #a, #b, a_, b_); \
+        test_failed++; \
+    } \
+} while(0)
+
+//return value of main
+#define TEST_RESULT() (test_failed ? (printf("%d check(s) failed\n", test_failed), 1) : (printf("ok\n"), 0))
+
+//reproducible pseudo random numbers for the random walks of the tests
+static uint32_t test_rand_state = 1;
+static uint32_t test_rand(void)
+{
+    test_rand_state = test_rand_state * 1103515245u + 12345u;
+    return test_rand_state >> 8;
+}
+
+#endif //__TEST_COMMON_H__
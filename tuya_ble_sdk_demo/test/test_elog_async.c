@@ -0,0 +1,306 @@
+//easylogger async ring of elog_async.c, drained by elog_port_output_poll() of elog_port.c
+#include "test_common.h"
+#include <elog.h>
+#include "uart.h"
+#include "suble_common.h"
+
+#define UART_TX_QUEUE_SIZE      (UART0_TX_FIFO_MAX_COUNT - 1)
+#define RING_SIZE               ELOG_ASYNC_OUTPUT_BUF_SIZE
+#define CHUNK_SIZE              ELOG_ASYNC_POLL_GET_LOG_BUF_SIZE
+#define WIRE_SIZE               (1024 * 1024)
+
+/*********************************************************
+ * the log lock, and the uart2 tx queue drained onto the wire by its interrupt
+ */
+static uint32_t s_critical = 0;
+static bool     s_in_poll = false;
+
+void suble_enter_critical(void)
+{
+    s_critical++;
+}
+
+void suble_exit_critical(void)
+{
+    TEST_CHECK(s_critical > 0);
+    s_critical--;
+}
+
+uint32_t suble_get_timestamp_with_ms(uint16_t* ms)
+{
+    *ms = 0;
+    return 0;
+}
+
+static uint8_t  s_queue[UART_TX_QUEUE_SIZE];
+static uint32_t s_queue_len = 0;
+static char     s_wire[WIRE_SIZE];
+static uint32_t s_wire_len = 0;
+static uint32_t s_blocking = 0;
+static uint32_t s_chunk_bad = 0;
+
+static void wire_put(const void* buf, uint32_t len)
+{
+    TEST_CHECK(s_wire_len + len <= WIRE_SIZE);
+    memcpy(&s_wire[s_wire_len], buf, len);
+    s_wire_len += len;
+}
+
+static void uart_tx_isr(uint32_t bytes)
+{
+    if(bytes > s_queue_len) {
+        bytes = s_queue_len;
+    }
+    wire_put(s_queue, bytes);
+    memmove(s_queue, &s_queue[bytes], s_queue_len - bytes);
+    s_queue_len -= bytes;
+}
+
+uint16_t uart2_send_async(unsigned char *buff, uint16_t len)
+{
+    //the poll waits on the uart with interrupts enabled, one line or one chunk at a time
+    if(s_in_poll) {
+        TEST_CHECK_EQ(s_critical, 0);
+        if((len > CHUNK_SIZE) || ((len < CHUNK_SIZE) && (buff[len - 1] != '\n'))) {
+            s_chunk_bad++;
+        }
+    }
+    if(s_queue_len + len > UART_TX_QUEUE_SIZE) {
+        return 0;
+    }
+    memcpy(&s_queue[s_queue_len], buff, len);
+    s_queue_len += len;
+    return len;
+}
+
+//polls the uart until the queue is drained, then sends
+void uart2_send(unsigned char *buff, int len)
+{
+    s_blocking++;
+    uart_tx_isr(s_queue_len);
+    wire_put(buff, len);
+}
+
+uint16_t uart2_tx_free_get(void)
+{
+    return UART_TX_QUEUE_SIZE - s_queue_len;
+}
+
+/*********************************************************
+ * the lines written, what should reach the wire
+ */
+static char     s_expect[WIRE_SIZE];
+static uint32_t s_expect_len = 0;
+static uint32_t s_line_id = 0;
+
+static void expect_put(const char* buf, uint32_t len)
+{
+    TEST_CHECK(s_expect_len + len <= WIRE_SIZE);
+    memcpy(&s_expect[s_expect_len], buf, len);
+    s_expect_len += len;
+}
+
+//a line of len bytes with the newline, numbered so a lost or repeated one shows
+static uint32_t line_write(uint8_t level, uint32_t len)
+{
+    char text[ELOG_LINE_BUF_SIZE];
+    uint32_t pos;
+
+    pos = snprintf(text, sizeof(text), "%05u:", (unsigned)(s_line_id++ % 100000));
+    while(pos < len - 1) {
+        text[pos++] = 'a' + test_rand() % 26;
+    }
+    text[len - 1] = '\0';
+    elog_output(level, "test", "", "", 0, "%s", text);
+    TEST_CHECK_EQ(s_critical, 0);
+    expect_put(text, len - 1);
+    expect_put("\n", 1);
+    return len;
+}
+
+static uint32_t line_write_random(void)
+{
+    uint32_t len = 8 + test_rand() % 150;
+    line_write(ELOG_LVL_ERROR + test_rand() % 5, len);
+    return len;
+}
+
+static void poll(void)
+{
+    s_in_poll = true;
+    elog_port_output_poll();
+    s_in_poll = false;
+    TEST_CHECK_EQ(s_critical, 0);
+}
+
+static void drain(void)
+{
+    for(uint32_t idx=0; idx<1000; idx++) {
+        poll();
+        uart_tx_isr(UART_TX_QUEUE_SIZE);
+    }
+    TEST_CHECK(!elog_async_is_pending());
+    TEST_CHECK(!elog_port_output_pending());
+    TEST_CHECK_EQ(s_queue_len, 0);
+}
+
+static void wire_check(void)
+{
+    TEST_CHECK_EQ(s_wire_len, s_expect_len);
+    TEST_CHECK(memcmp(s_wire, s_expect, s_expect_len) == 0);
+}
+
+static void reset(void)
+{
+    drain();
+    s_wire_len = 0;
+    s_expect_len = 0;
+    s_blocking = 0;
+    s_chunk_bad = 0;
+}
+
+/*********************************************************
+ * cases
+ */
+//the ring wraps many times, the lines leave it whole, in order, a line or a chunk per poll
+static void test_wrap(void)
+{
+    uint32_t written = 0;
+
+    reset();
+    while(written < 100 * RING_SIZE) {
+        if(test_rand() % 10 < 3) {
+            written += line_write_random();
+        }
+        poll();
+        uart_tx_isr(test_rand() % 64);
+    }
+    drain();
+    wire_check();
+    TEST_CHECK_EQ(s_blocking, 0);
+    TEST_CHECK_EQ(s_chunk_bad, 0);
+    TEST_CHECK_EQ(elog_async_get_drop_size(), 0);
+}
+
+//more than the ring holds, the rest is dropped and reported once the ring is out
+static void test_overflow(void)
+{
+    char notice[64];
+    uint32_t total = 0;
+
+    reset();
+    while(total < 3 * RING_SIZE) {
+        total += line_write_random();
+    }
+    TEST_CHECK(elog_port_output_pending());
+
+    //the ring keeps the first RING_SIZE bytes, the last line it took is cut
+    s_expect_len = RING_SIZE;
+    snprintf(notice, sizeof(notice), "[elog] %u bytes dropped\n", (unsigned)(total - RING_SIZE));
+    expect_put(notice, strlen(notice));
+    drain();
+    wire_check();
+
+    //and goes on
+    s_wire_len = 0;
+    s_expect_len = 0;
+    for(uint32_t idx=0; idx<20; idx++) {
+        line_write_random();
+        poll();
+        uart_tx_isr(UART_TX_QUEUE_SIZE);
+    }
+    drain();
+    wire_check();
+}
+
+//a ring filled to the byte, then one more
+static void test_full(void)
+{
+    char notice[64];
+
+    reset();
+    line_write(ELOG_LVL_WARN, RING_SIZE / 2);
+    line_write(ELOG_LVL_WARN, RING_SIZE / 2);
+    TEST_CHECK_EQ(elog_async_get_drop_size(), 0);
+    line_write(ELOG_LVL_WARN, 10);
+    s_expect_len -= 10;
+    snprintf(notice, sizeof(notice), "[elog] 10 bytes dropped\n");
+    expect_put(notice, strlen(notice));
+    drain();
+    wire_check();
+}
+
+//asserts and raw output skip the ring, they pass the lines still in it
+static void test_sync(void)
+{
+    reset();
+    line_write(ELOG_LVL_ERROR, 40);
+    line_write(ELOG_LVL_INFO, 40);
+    elog_output(ELOG_LVL_ASSERT, "test", "", "", 0, "assert");
+    elog_raw("raw\n");
+    TEST_CHECK_EQ(s_critical, 0);
+    uart_tx_isr(UART_TX_QUEUE_SIZE);
+    TEST_CHECK_EQ(s_wire_len, 11);
+    TEST_CHECK(memcmp(s_wire, "assert\nraw\n", 11) == 0);
+
+    s_wire_len = 0;
+    drain();
+    wire_check();
+}
+
+//a busy uart leaves the log in the ring and lets the main loop sleep
+static void test_busy_uart(void)
+{
+    uint8_t fill[UART_TX_QUEUE_SIZE];
+
+    reset();
+    memset(fill, '-', sizeof(fill));
+    uart2_send_async(fill, UART_TX_QUEUE_SIZE - CHUNK_SIZE + 1);
+    expect_put((char*)fill, UART_TX_QUEUE_SIZE - CHUNK_SIZE + 1);
+    line_write(ELOG_LVL_DEBUG, 20);
+    TEST_CHECK(elog_async_is_pending());
+    TEST_CHECK(!elog_port_output_pending());
+    poll();
+    TEST_CHECK_EQ(s_queue_len, UART_TX_QUEUE_SIZE - CHUNK_SIZE + 1);
+
+    uart_tx_isr(1);
+    TEST_CHECK(elog_port_output_pending());
+    drain();
+    wire_check();
+    TEST_CHECK_EQ(s_blocking, 0);
+}
+
+//the reset path sends everything at once
+static void test_flush(void)
+{
+    reset();
+    uart2_send_async((unsigned char*)"queued\n", 7);
+    expect_put("queued\n", 7);
+    for(uint32_t idx=0; idx<8; idx++) {
+        line_write_random();
+    }
+
+    elog_port_output_flush();
+    TEST_CHECK(!elog_async_is_pending());
+    TEST_CHECK_EQ(s_queue_len, 0);
+    TEST_CHECK(s_blocking > 0);
+    wire_check();
+}
+
+int main(void)
+{
+    elog_init();
+    for(uint8_t level=ELOG_LVL_ASSERT; level<=ELOG_LVL_VERBOSE; level++) {
+        elog_set_fmt(level, 0);
+    }
+    elog_start();
+    drain();
+
+    test_wrap();
+    test_overflow();
+    test_full();
+    test_sync();
+    test_busy_uart();
+    test_flush();
+    return TEST_RESULT();
+}
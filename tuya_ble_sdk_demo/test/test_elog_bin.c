@@ -0,0 +1,143 @@
+//elog_bin.c frames, decoded by test_elog_bin.py with tools/elog_bin_decode
+//usage: test_elog_bin <capture.bin> <fmts.txt> <expected.txt>
+#include "test_common.h"
+#include <stdarg.h>
+#include "elog.h"
+
+static FILE* capture;
+static FILE* fmts;
+static FILE* expected;
+
+/*********************************************************************
+ * easylogger port
+ */
+bool elog_get_output_enabled(void)
+{
+    return true;
+}
+
+void elog_output_lock(void)
+{
+}
+
+void elog_output_unlock(void)
+{
+}
+
+void elog_port_output(const char *log, size_t size)
+{
+    const uint8_t* frame = (const uint8_t*)log;
+    uint8_t sum = 0;
+
+    //| 0xA5 | type | len | payload[len] | sum |
+    TEST_CHECK(size >= 4 && size <= 254);
+    TEST_CHECK_EQ(frame[0], 0xA5);
+    TEST_CHECK_EQ(frame[2] + 4, size);
+    for(size_t idx=1; idx<size-1; idx++) {
+        sum += frame[idx];
+    }
+    TEST_CHECK_EQ(frame[size-1], sum);
+    fwrite(log, 1, size, capture);
+}
+
+/*********************************************************************
+ * cases
+ */
+static void fmt_record(const char* fmt)
+{
+    fprintf(fmts, "%08x %s\n", (uint32_t)(uintptr_t)fmt, fmt);
+}
+
+//the reference text is the host printf of the same call
+static void expect_printf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(expected, fmt, args);
+    va_end(args);
+    fprintf(expected, "\n");
+}
+
+#define CASE(fmt, ...) do { \
+    fmt_record(fmt); \
+    elog_bin_printf(ELOG_LVL_DEBUG, fmt, __VA_ARGS__); \
+    expect_printf(fmt, __VA_ARGS__); \
+} while(0)
+
+#define CASE_EXPECT(text, fmt, ...) do { \
+    fmt_record(fmt); \
+    elog_bin_printf(ELOG_LVL_DEBUG, fmt, __VA_ARGS__); \
+    fprintf(expected, "%s\n", text); \
+} while(0)
+
+static void expect_hexdump(const char* name, uint8_t* buf, uint32_t size)
+{
+    //one frame carries 245 bytes, the decoder prints every frame on its own
+    for(uint32_t start=0; start<size; start+=245) {
+        uint32_t len = (size-start > 245) ? 245 : size-start;
+        fprintf(expected, "D/HEX %s: len=%u\n", name, len);
+        for(uint32_t idx=0; idx<len; idx+=8) {
+            uint32_t end = (idx+8 > len) ? len : idx+8;
+            fprintf(expected, "D/HEX %s: %04X-%04X:", name, idx, end-1);
+            for(uint32_t pos=idx; pos<end; pos++) {
+                fprintf(expected, " %02X", buf[start+pos]);
+            }
+            fprintf(expected, "\n");
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    static const char long_str[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    uint8_t buf[300];
+
+    if(argc < 4) {
+        printf("usage: %s <capture.bin> <fmts.txt> <expected.txt>\n", argv[0]);
+        return 1;
+    }
+    capture = fopen(argv[1], "wb");
+    fmts = fopen(argv[2], "w");
+    expected = fopen(argv[3], "w");
+    if(!capture || !fmts || !expected) {
+        return 1;
+    }
+
+    //one word arguments
+    CASE("plain %d %i %u", -5, 7, 3000000000u);
+    CASE("hex %x %X %08x %#x", 0xbeefu, 0xabu, 0x12u, 0x1fu);
+    CASE("char %c, width %5d|%-5d|, star %*d %.*d", 'z', 42, 42, 6, 9, 3, 7);
+    CASE("percent 100%% %o", 8);
+
+    //%ll takes two words
+    CASE("ll %lld %llu %llx", -1234567890123LL, 18446744073709551615ULL, 0x123456789abcdefULL);
+    CASE("mixed %d %lld %d", 1, 0x100000000LL, 2);
+
+    //double
+    CASE("double %f %.3e %g", 1.5, -12345.678, 0.25);
+
+    //strings
+    CASE("str [%s] [%-6s] [%s]", "abc", "de", "");
+    CASE_EXPECT("cut [0123456789abcdefghijklmnopqrstuv...] 5", "cut [%s] %d", long_str, 5);
+
+    //a full frame cuts the last string and drops the rest
+    CASE_EXPECT("full 0123456789abcdefghijklmnopqrstuv... 0123456789abcdefghijklmnopqrstuv... "
+                "0123456789abcdefghijklmnopqrstuv... 0123456789abcdefghijklmnopqrstuv... "
+                "0123456789abcdefghijklmnopqrstuv... 0123456789abcdefghijklmnopqrstuv... "
+                "0123456789abcdefghijklmnopqrstuv... 0123456789abc... <cut>",
+                "full %s %s %s %s %s %s %s %s %d",
+                long_str, long_str, long_str, long_str, long_str, long_str, long_str, long_str, 9);
+
+    //hexdump, split over two frames
+    for(uint32_t idx=0; idx<sizeof(buf); idx++) {
+        buf[idx] = (uint8_t)(idx * 7);
+    }
+    fmt_record("dump");
+    elog_bin_hexdump("dump", 8, buf, sizeof(buf));
+    expect_hexdump("dump", buf, sizeof(buf));
+
+    fclose(capture);
+    fclose(fmts);
+    fclose(expected);
+    return TEST_RESULT();
+}
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+"""
+round trip of elog_bin.c frames through tools/elog_bin_decode
+
+usage: test_elog_bin.py <test_elog_bin> <work dir>
+"""
+
+import os
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "tools", "elog_bin_decode"))
+import elog_bin_decode
+
+
+class FakeImage(object):
+    """format strings by address, as written by test_elog_bin"""
+
+    def __init__(self, path):
+        self.fmts = {}
+        for line in open(path, encoding="latin-1"):
+            addr, fmt = line.rstrip("\n").split(" ", 1)
+            self.fmts[int(addr, 16)] = fmt
+
+    def string(self, addr):
+        return self.fmts.get(addr, "<fmt@0x%08X>" % addr)
+
+
+def main(argv):
+    capture, fmts, expected = [os.path.join(argv[2], "elog_bin." + ext) for ext in ("bin", "fmt", "txt")]
+    if subprocess.call([argv[1], capture, fmts, expected]) != 0:
+        return 1
+
+    stream = open(capture, "rb").read()
+    lines = "\n".join(elog_bin_decode.decode(FakeImage(fmts), stream)).split("\n")
+    want = open(expected, encoding="latin-1").read().rstrip("\n").split("\n")
+
+    failed = 0
+    for idx in range(max(len(lines), len(want))):
+        got = lines[idx] if idx < len(lines) else "<missing>"
+        exp = want[idx] if idx < len(want) else "<missing>"
+        if got != exp:
+            print("line %d:\n  got:      %s\n  expected: %s" % (idx + 1, got, exp))
+            failed += 1
+    print("%d line(s) differ" % failed if failed else "ok")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,424 @@
+//flash log page ring of elog_flash_port.c, on a nor flash model with power cuts
+#include "test_common.h"
+#include "elog_flash.h"
+#include "suble_common.h"
+#include "ea.h"
+
+#define FLASH_SIZE              (SUBLE_FLASH_LOG_END_ADDR - SUBLE_FLASH_LOG_START_ADDR)
+#define SECTOR_SIZE             0x1000
+#define SECTOR_NUM              (FLASH_SIZE / SECTOR_SIZE)
+#define PAGE_SIZE               256
+#define PAGE_PER_SECTOR         (SECTOR_SIZE / PAGE_SIZE)
+#define PAGE_NUM                (SECTOR_NUM * PAGE_PER_SECTOR)
+#define HEAD_SIZE               8
+#define ERASE_SLOTS             80
+//pages a ring always keeps, the sector ahead is erased and the current one is partly written
+#define PAGE_KEPT_MIN           ((SECTOR_NUM - 2) * PAGE_PER_SECTOR + 1)
+#define SEQ_TABLE_SIZE          1024
+
+/*********************************************************
+ * the log area, a write only clears bits, an erase sets a sector back to 0xFF
+ * after a power cut nothing reaches the flash until the reboot
+ */
+static uint8_t  s_flash[FLASH_SIZE];
+static uint32_t s_erase_cnt[SECTOR_NUM];
+static int32_t  s_cut_budget = -1;  //bytes programmed before the power goes, -1 for never
+static bool     s_power_off = false;
+static bool     s_in_sync = false;
+static uint32_t s_idle_slots = 1000;
+
+//what the port programmed, by seq
+static struct {
+    uint32_t seq;
+    uint8_t  len;
+    uint8_t  log[ELOG_FLASH_BUF_SIZE];
+} s_page[SEQ_TABLE_SIZE];
+static uint32_t s_head_seq;
+static uint8_t  s_head_len;
+static uint32_t s_last_seq;
+static bool     s_have_last = false;
+
+void suble_flash_read(uint32_t addr, uint8_t *buf, uint32_t size)
+{
+    TEST_CHECK((addr >= SUBLE_FLASH_LOG_START_ADDR) && (addr + size <= SUBLE_FLASH_LOG_END_ADDR));
+    memcpy(buf, &s_flash[addr - SUBLE_FLASH_LOG_START_ADDR], size);
+}
+
+void suble_flash_write(uint32_t addr, uint8_t *buf, uint32_t size)
+{
+    uint32_t pos = addr - SUBLE_FLASH_LOG_START_ADDR;
+    bool whole = true;
+
+    TEST_CHECK((addr >= SUBLE_FLASH_LOG_START_ADDR) && (addr + size <= SUBLE_FLASH_LOG_END_ADDR));
+    //one page at a time, the head first
+    TEST_CHECK((pos % PAGE_SIZE) + size <= PAGE_SIZE);
+    for(uint32_t idx=0; idx<size; idx++) {
+        if(s_power_off) {
+            whole = false;
+            break;
+        }
+        if(s_cut_budget == 0) {
+            s_power_off = true;
+            whole = false;
+            break;
+        }
+        if(s_cut_budget > 0) {
+            s_cut_budget--;
+        }
+        s_flash[pos + idx] &= buf[idx];
+    }
+
+    if(pos % PAGE_SIZE == 0) {
+        TEST_CHECK_EQ(size, HEAD_SIZE);
+        memcpy(&s_head_seq, &buf[4], 4);
+        s_head_len = buf[2];
+    } else if(whole) {
+        TEST_CHECK_EQ(pos % PAGE_SIZE, HEAD_SIZE);
+        TEST_CHECK_EQ(size, s_head_len);
+        s_page[s_head_seq % SEQ_TABLE_SIZE].seq = s_head_seq;
+        s_page[s_head_seq % SEQ_TABLE_SIZE].len = size;
+        memcpy(s_page[s_head_seq % SEQ_TABLE_SIZE].log, buf, size);
+        s_last_seq = s_head_seq;
+        s_have_last = true;
+    }
+}
+
+void suble_flash_erase(uint32_t addr, uint32_t num)
+{
+    uint32_t pos = addr - SUBLE_FLASH_LOG_START_ADDR;
+
+    TEST_CHECK((pos % SECTOR_SIZE == 0) && (pos + num * SECTOR_SIZE <= FLASH_SIZE));
+    //the cpu stops for the erase, only in a radio gap or on the reset path
+    TEST_CHECK(s_in_sync || (s_idle_slots >= ERASE_SLOTS));
+    if(s_power_off) {
+        return;
+    }
+    memset(&s_flash[pos], 0xFF, num * SECTOR_SIZE);
+    for(uint32_t idx=0; idx<num; idx++) {
+        s_erase_cnt[pos / SECTOR_SIZE + idx]++;
+    }
+}
+
+bool ea_sleep_check(uint32_t *sleep_duration, uint32_t wakeup_delay)
+{
+    if(*sleep_duration > s_idle_slots) {
+        *sleep_duration = s_idle_slots;
+    }
+    return (s_idle_slots != 0);
+}
+
+/*********************************************************
+ * the rest of easylogger, not used here
+ */
+static void assert_hook(const char* expr, const char* func, size_t line)
+{
+    TEST_CHECK(0);
+}
+
+void (*elog_assert_hook)(const char* expr, const char* func, size_t line) = assert_hook;
+
+void elog_output(uint8_t level, const char *tag, const char *file, const char *func, const long line, const char *format, ...) {}
+void elog_port_output(const char *log, size_t size) {}
+
+/*********************************************************
+ * helpers
+ */
+static uint8_t  s_log[ELOG_FLASH_BUF_SIZE + 16];
+
+static ElogErrCode log_write(uint32_t len)
+{
+    for(uint32_t idx=0; idx<len; idx++) {
+        s_log[idx] = test_rand();
+    }
+    return elog_flash_port_write((const char*)s_log, len);
+}
+
+static uint32_t log_write_random(void)
+{
+    uint32_t len = 1 + test_rand() % ELOG_FLASH_BUF_SIZE;
+    TEST_CHECK_EQ(log_write(len), ELOG_NO_ERR);
+    return len;
+}
+
+//the main loop, a few polls to erase ahead and program
+static void poll(void)
+{
+    for(uint32_t idx=0; idx<3; idx++) {
+        elog_flash_port_poll();
+    }
+}
+
+static void reboot(void)
+{
+    s_power_off = false;
+    s_cut_budget = -1;
+    TEST_CHECK_EQ(elog_flash_port_init(), ELOG_NO_ERR);
+    elog_flash_port_get_drop_size();
+}
+
+//the valid pages oldest first, each as programmed, a seq run ending on the last one
+static uint32_t ring_check(void)
+{
+    static uint8_t stream[PAGE_NUM * ELOG_FLASH_BUF_SIZE];
+    static uint8_t read[PAGE_NUM * ELOG_FLASH_BUF_SIZE];
+    uint8_t buf[ELOG_FLASH_BUF_SIZE];
+    uint32_t stream_len = 0;
+    uint32_t pages = 0;
+    uint32_t prev_seq = 0;
+
+    TEST_CHECK_EQ(elog_flash_port_get_page_num(), PAGE_NUM);
+    for(uint32_t order=0; order<PAGE_NUM; order++) {
+        uint32_t seq;
+        uint32_t len = elog_flash_port_read_page(order, &seq, buf);
+        if(len == 0) {
+            continue;
+        }
+        TEST_CHECK_EQ(s_page[seq % SEQ_TABLE_SIZE].seq, seq);
+        TEST_CHECK_EQ(s_page[seq % SEQ_TABLE_SIZE].len, len);
+        TEST_CHECK(memcmp(s_page[seq % SEQ_TABLE_SIZE].log, buf, len) == 0);
+        if(pages != 0) {
+            TEST_CHECK_EQ(seq, prev_seq + 1);
+        }
+        prev_seq = seq;
+        pages++;
+        memcpy(&stream[stream_len], buf, len);
+        stream_len += len;
+    }
+    TEST_CHECK_EQ(elog_flash_port_read_page(PAGE_NUM, &prev_seq, buf), 0);
+    if(s_have_last) {
+        TEST_CHECK(pages > 0);
+        TEST_CHECK_EQ(prev_seq, s_last_seq);
+    } else {
+        TEST_CHECK_EQ(pages, 0);
+    }
+
+    //the same log as one stream, whole and in random pieces
+    TEST_CHECK_EQ(elog_flash_port_get_used_size(), stream_len);
+    memset(read, 0, stream_len);
+    elog_flash_port_read(0, read, stream_len);
+    TEST_CHECK(memcmp(read, stream, stream_len) == 0);
+    for(uint32_t idx=0; (idx<20) && stream_len; idx++) {
+        uint32_t index = test_rand() % stream_len;
+        uint32_t size = 1 + test_rand() % (stream_len - index);
+        memset(read, 0, size);
+        elog_flash_port_read(index, read, size);
+        TEST_CHECK(memcmp(read, &stream[index], size) == 0);
+    }
+    return pages;
+}
+
+static void flash_blank(void)
+{
+    memset(s_flash, 0xFF, sizeof(s_flash));
+    memset(s_erase_cnt, 0, sizeof(s_erase_cnt));
+    s_have_last = false;
+    s_idle_slots = 1000;
+    reboot();
+}
+
+/*********************************************************
+ * cases
+ */
+//many turns of the ring, each sector erased in turn, the newest pages kept
+static void test_wrap(void)
+{
+    uint32_t max_cnt = 0, min_cnt = 0xFFFFFFFF;
+
+    flash_blank();
+    TEST_CHECK_EQ(ring_check(), 0);
+    for(uint32_t idx=0; idx<20*PAGE_NUM; idx++) {
+        log_write_random();
+        poll();
+        TEST_CHECK(!elog_flash_port_is_pending());
+        if(idx % 7 == 0) {
+            uint32_t pages = ring_check();
+            TEST_CHECK(pages >= ((idx + 1 < PAGE_KEPT_MIN) ? idx + 1 : PAGE_KEPT_MIN));
+            TEST_CHECK(pages <= PAGE_KEPT_MIN + PAGE_PER_SECTOR);
+        }
+    }
+    TEST_CHECK_EQ(s_last_seq, 20*PAGE_NUM - 1);
+
+    //wear levelled, the sectors take turns
+    for(uint32_t sector=0; sector<SECTOR_NUM; sector++) {
+        if(s_erase_cnt[sector] > max_cnt) {
+            max_cnt = s_erase_cnt[sector];
+        }
+        if(s_erase_cnt[sector] < min_cnt) {
+            min_cnt = s_erase_cnt[sector];
+        }
+    }
+    TEST_CHECK(max_cnt - min_cnt <= 1);
+    TEST_CHECK(min_cnt >= 19);
+
+    //the boot finds the last page and goes on behind it
+    reboot();
+    ring_check();
+    log_write_random();
+    poll();
+    TEST_CHECK_EQ(s_last_seq, 20*PAGE_NUM);
+    ring_check();
+}
+
+//a buffer that finds the page still taken is dropped and counted, a long one is cut
+static void test_overflow(void)
+{
+    uint32_t last_seq;
+    uint32_t len;
+
+    flash_blank();
+    TEST_CHECK_EQ(elog_flash_port_get_drop_size(), 0);
+    len = log_write_random();
+    TEST_CHECK_EQ(log_write(100), ELOG_FLASH_FULL_ERR);
+    TEST_CHECK_EQ(log_write(7), ELOG_FLASH_FULL_ERR);
+    TEST_CHECK(elog_flash_port_is_pending());
+    TEST_CHECK_EQ(elog_flash_port_get_drop_size(), 107);
+    TEST_CHECK_EQ(elog_flash_port_get_drop_size(), 0);
+    poll();
+    TEST_CHECK_EQ(s_page[s_last_seq % SEQ_TABLE_SIZE].len, len);
+    last_seq = s_last_seq;
+
+    TEST_CHECK_EQ(log_write(ELOG_FLASH_BUF_SIZE + 10), ELOG_NO_ERR);
+    TEST_CHECK_EQ(elog_flash_port_get_drop_size(), 10);
+    poll();
+    TEST_CHECK_EQ(s_last_seq, last_seq + 1);
+    TEST_CHECK_EQ(s_page[s_last_seq % SEQ_TABLE_SIZE].len, ELOG_FLASH_BUF_SIZE);
+
+    TEST_CHECK_EQ(log_write(0), ELOG_NO_ERR);
+    poll();
+    TEST_CHECK_EQ(s_last_seq, last_seq + 1);
+    TEST_CHECK(!elog_flash_port_is_pending());
+    ring_check();
+}
+
+//a busy radio holds the erase, and the page that needs it, the reset path does not wait
+static void test_radio_busy(void)
+{
+    flash_blank();
+    for(uint32_t idx=0; idx<3*PAGE_PER_SECTOR; idx++) {
+        log_write_random();
+        poll();
+    }
+    TEST_CHECK_EQ(s_erase_cnt[SECTOR_NUM - 1], 1);
+
+    //the last sector was erased ahead, it is entered and filled, the erase of the first waits
+    s_idle_slots = ERASE_SLOTS - 1;
+    for(uint32_t idx=0; idx<PAGE_PER_SECTOR; idx++) {
+        log_write_random();
+        poll();
+    }
+    TEST_CHECK_EQ(s_last_seq, 4*PAGE_PER_SECTOR - 1);
+    TEST_CHECK_EQ(s_erase_cnt[0], 0);
+
+    //the page that wraps onto it waits too
+    log_write_random();
+    poll();
+    TEST_CHECK_EQ(s_last_seq, 4*PAGE_PER_SECTOR - 1);
+    TEST_CHECK(!elog_flash_port_is_pending());
+    s_idle_slots = 0;
+    poll();
+    TEST_CHECK(!elog_flash_port_is_pending());
+    TEST_CHECK_EQ(s_last_seq, 4*PAGE_PER_SECTOR - 1);
+
+    //the gap opens
+    s_idle_slots = ERASE_SLOTS;
+    TEST_CHECK(elog_flash_port_is_pending());
+    elog_flash_port_poll();
+    TEST_CHECK_EQ(s_last_seq, 4*PAGE_PER_SECTOR);
+    TEST_CHECK_EQ(s_erase_cnt[0], 1);
+    ring_check();
+
+    //the same spot on the reset path
+    s_idle_slots = 0;
+    for(uint32_t idx=0; idx<PAGE_PER_SECTOR; idx++) {
+        log_write_random();
+        poll();
+    }
+    TEST_CHECK_EQ(s_last_seq, 5*PAGE_PER_SECTOR - 1);
+    TEST_CHECK(!elog_flash_port_is_pending());
+    s_in_sync = true;
+    elog_flash_port_sync();
+    elog_flash_port_sync();
+    s_in_sync = false;
+    TEST_CHECK_EQ(s_last_seq, 5*PAGE_PER_SECTOR);
+    TEST_CHECK_EQ(s_erase_cnt[1], 2);
+    ring_check();
+}
+
+//the power goes anywhere in a page, the boot skips what it cut and the ring goes on
+static void test_power_cut(void)
+{
+    uint32_t cuts = 0;
+
+    flash_blank();
+    for(uint32_t idx=0; idx<10*PAGE_NUM; idx++) {
+        uint32_t len = log_write_random();
+        if(test_rand() % 5 == 0) {
+            s_cut_budget = test_rand() % (HEAD_SIZE + len + 1);
+        }
+        poll();
+        if(s_power_off || (s_cut_budget >= 0)) {
+            cuts += s_power_off;
+            reboot();
+            TEST_CHECK(ring_check() > 0);
+        }
+    }
+    TEST_CHECK(cuts > PAGE_NUM);
+    ring_check();
+}
+
+//the seq runs over 32 bits, the newest page is still the one after the wrap
+static void test_seq_wrap(void)
+{
+    uint8_t head[HEAD_SIZE] = {0x4C, 0x47, 1, 0};
+
+    flash_blank();
+    //a page of seq 0xFFFFFFF0 as an older firmware would have left it
+    memcpy(&head[4], "\xF0\xFF\xFF\xFF", 4);
+    head[3] = (uint8_t)(1 + 0xF0 + 0xFF * 3 + 'x');
+    memcpy(&s_flash[0], head, HEAD_SIZE);
+    s_flash[HEAD_SIZE] = 'x';
+    s_page[0xFFFFFFF0 % SEQ_TABLE_SIZE].seq = 0xFFFFFFF0;
+    s_page[0xFFFFFFF0 % SEQ_TABLE_SIZE].len = 1;
+    s_page[0xFFFFFFF0 % SEQ_TABLE_SIZE].log[0] = 'x';
+    s_last_seq = 0xFFFFFFF0;
+    s_have_last = true;
+    reboot();
+    ring_check();
+
+    for(uint32_t idx=0; idx<PAGE_NUM+20; idx++) {
+        log_write_random();
+        poll();
+        if(idx % 5 == 0) {
+            reboot();
+            ring_check();
+        }
+    }
+    TEST_CHECK_EQ(s_last_seq, 0xFFFFFFF0 + PAGE_NUM + 20);
+}
+
+//a clean leaves nothing and writes from the start
+static void test_clean(void)
+{
+    s_in_sync = true;
+    TEST_CHECK_EQ(elog_flash_port_clean(), ELOG_NO_ERR);
+    s_in_sync = false;
+    s_have_last = false;
+    TEST_CHECK_EQ(ring_check(), 0);
+    log_write_random();
+    poll();
+    TEST_CHECK(s_have_last);
+    TEST_CHECK_EQ(ring_check(), 1);
+    reboot();
+    TEST_CHECK_EQ(ring_check(), 1);
+}
+
+int main(void)
+{
+    test_wrap();
+    test_overflow();
+    test_radio_busy();
+    test_power_cut();
+    test_seq_wrap();
+    test_clean();
+    return TEST_RESULT();
+}
@@ -0,0 +1,284 @@
+#include "test_common.h"
+#include "tuya_ble_port.h"
+#include "tuya_ble_mem.h"
+#include "tuya_ble_main.h"
+#include "tuya_ble_gatt_send_queue.h"
+#include "tuya_ble_mutli_tsf_protocol.h"
+
+#define FRAME_NUM           300
+#define FRAME_MAX           200
+#define EVENT_QUEUE_SIZE    4
+
+/*********************************************************
+ * heap, every block is counted so the peak can be checked
+ */
+static uint32_t s_heap_used = 0;
+static uint32_t s_heap_peak = 0;
+static uint32_t s_frame_bytes = 0; //bytes of the frames handed to the queue and not freed
+static bool     s_test_alloc = false;
+
+typedef struct {
+    uint32_t size;
+} heap_head_t;
+
+void *tuya_ble_malloc(uint16_t size)
+{
+    heap_head_t* head = malloc(sizeof(heap_head_t) + size);
+    //the queue keeps the frames of the caller, it never allocates by itself
+    TEST_CHECK(s_test_alloc);
+    head->size = size;
+    s_heap_used += size;
+    if(s_heap_used > s_heap_peak) {
+        s_heap_peak = s_heap_used;
+    }
+    return head + 1;
+}
+
+tuya_ble_status_t tuya_ble_free(uint8_t *ptr)
+{
+    heap_head_t* head = (heap_head_t*)ptr - 1;
+    s_heap_used -= head->size;
+    s_frame_bytes -= head->size;
+    free(head);
+    return TUYA_BLE_SUCCESS;
+}
+
+/*********************************************************
+ * link, the receiver rebuilds the frames from the sub packages
+ */
+static tuya_ble_connect_status_t s_connect_status = BONDING_CONN;
+static uint32_t s_link_busy_percent = 0;
+static uint32_t s_link_in_flight = 0;
+static uint32_t s_link_refused = 0;
+
+static frm_trsmitr_proc_s s_rx_trsmitr;
+static uint8_t  s_rx_frame[FRAME_MAX];
+static uint32_t s_rx_frame_num = 0;
+static uint32_t s_rx_error = 0;
+
+tuya_ble_connect_status_t tuya_ble_connect_status_get(void)
+{
+    return s_connect_status;
+}
+
+static void rx_frame_check(uint32_t idx, uint8_t* frame, uint32_t len)
+{
+    //frame idx is idx%FRAME_MAX+1 bytes of idx+offset
+    TEST_CHECK_EQ(len, idx%FRAME_MAX + 1);
+    for(uint32_t pos=0; pos<len; pos++) {
+        if(frame[pos] != (uint8_t)(idx + pos)) {
+            s_rx_error++;
+            break;
+        }
+    }
+}
+
+tuya_ble_status_t tuya_ble_gatt_send_data(const uint8_t *p_data, uint16_t len)
+{
+    mtp_ret ret;
+
+    //with TUYA_BLE_GATT_SEND_ON_TX_COMPLETE the port is busy only while a notify is in flight
+    if((s_link_in_flight > 0) || (!TUYA_BLE_GATT_SEND_ON_TX_COMPLETE && (test_rand()%100 < s_link_busy_percent))) {
+        s_link_refused++;
+        return TUYA_BLE_ERR_BUSY;
+    }
+    s_link_in_flight++;
+
+    TEST_CHECK(len <= TUYA_BLE_DATA_MTU_MAX);
+    ret = trsmitr_recv_pkg_decode(&s_rx_trsmitr, (uint8_t*)p_data, len);
+    if((ret != MTP_OK) && (ret != MTP_TRSMITR_CONTINUE)) {
+        s_rx_error++;
+        return TUYA_BLE_SUCCESS;
+    }
+    if(FRM_PKG_FIRST == s_rx_trsmitr.pkg_desc) {
+        memset(s_rx_frame, 0, sizeof(s_rx_frame));
+    }
+    memcpy(&s_rx_frame[s_rx_trsmitr.pkg_trsmitr_cnt - get_trsmitr_subpkg_len(&s_rx_trsmitr)],
+           get_trsmitr_subpkg(&s_rx_trsmitr), get_trsmitr_subpkg_len(&s_rx_trsmitr));
+    if(ret == MTP_OK) {
+        rx_frame_check(s_rx_frame_num, s_rx_frame, get_trsmitr_frame_total_len(&s_rx_trsmitr));
+        s_rx_frame_num++;
+        trsmitr_init(&s_rx_trsmitr);
+    }
+    return TUYA_BLE_SUCCESS;
+}
+
+/*********************************************************
+ * event queue with a small fixed size, and one single shot timer
+ */
+static tuya_ble_evt_param_t s_events[EVENT_QUEUE_SIZE];
+static uint32_t s_event_num = 0;
+static uint32_t s_event_full_percent = 0;
+static uint32_t s_event_refused = 0;
+
+uint8_t tuya_ble_event_send(tuya_ble_evt_param_t *evt)
+{
+    if((s_event_num >= EVENT_QUEUE_SIZE) || (test_rand()%100 < s_event_full_percent)) {
+        s_event_refused++;
+        return 1;
+    }
+    s_events[s_event_num++] = *evt;
+    return 0;
+}
+
+static tuya_ble_timer_handler_t s_timer_handler = NULL;
+static bool s_timer_running = false;
+static uint32_t s_timer_fired = 0;
+static uint32_t s_tx_complete = 0;
+static uint32_t s_idle_gap = 0;     //tx completes that left the link idle with frames waiting
+
+tuya_ble_status_t tuya_ble_timer_create(void** p_timer_id, uint32_t timeout_value_ms, tuya_ble_timer_mode mode, tuya_ble_timer_handler_t timeout_handler)
+{
+    TEST_CHECK(s_timer_handler == NULL);
+    TEST_CHECK_EQ(mode, TUYA_BLE_TIMER_SINGLE_SHOT);
+    s_timer_handler = timeout_handler;
+    *p_timer_id = &s_timer_handler;
+    return TUYA_BLE_SUCCESS;
+}
+
+tuya_ble_status_t tuya_ble_timer_restart(void* timer_id, uint32_t timeout_value_ms)
+{
+    s_timer_running = true;
+    return TUYA_BLE_SUCCESS;
+}
+
+tuya_ble_status_t tuya_ble_timer_stop(void* timer_id)
+{
+    s_timer_running = false;
+    return TUYA_BLE_SUCCESS;
+}
+
+/*********************************************************
+ * main loop, one step runs what the chip would do next
+ */
+static void run_step(void)
+{
+    uint32_t what = test_rand()%3;
+
+    if((what == 0) && (s_event_num > 0)) {
+        tuya_ble_evt_param_t evt = s_events[0];
+        memmove(&s_events[0], &s_events[1], (--s_event_num)*sizeof(tuya_ble_evt_param_t));
+        evt.hdr.event_handler(&evt);
+    } else if((what == 1) && (s_link_in_flight > 0)) {
+        uint32_t refused = s_link_refused;
+        s_link_in_flight--;
+        tuya_ble_gatt_send_tx_complete();
+        s_tx_complete++;
+        //the link took the notify and is free, the next sub package should be on it already
+        if((tuya_ble_gatt_send_queue_used() > 0) && (s_link_in_flight == 0) && (s_link_refused == refused)) {
+            s_idle_gap++;
+        }
+    } else if((what == 2) && s_timer_running) {
+        s_timer_running = false;
+        s_timer_fired++;
+        s_timer_handler(&s_timer_handler);
+    }
+}
+
+static bool link_is_idle(void)
+{
+    return (s_event_num == 0) && (s_link_in_flight == 0) && !s_timer_running;
+}
+
+static tuya_ble_status_t frame_send(uint32_t idx)
+{
+    uint32_t len = idx%FRAME_MAX + 1;
+    uint8_t* frame;
+
+    s_test_alloc = true;
+    frame = tuya_ble_malloc(len);
+    s_test_alloc = false;
+    for(uint32_t pos=0; pos<len; pos++) {
+        frame[pos] = (uint8_t)(idx + pos);
+    }
+    s_frame_bytes += len;
+    return tuya_ble_gatt_send_frame_enqueue(frame, len);
+}
+
+/*********************************************************
+ * tests
+ */
+//frames come out whole and in order, whatever the link and the event queue do
+static void test_order(uint32_t busy_percent, uint32_t full_percent)
+{
+    uint32_t sent = 0;
+
+    tuya_ble_gatt_send_queue_init();
+    trsmitr_init(&s_rx_trsmitr);
+    s_rx_frame_num = 0;
+    s_heap_peak = 0;
+    s_link_busy_percent = busy_percent;
+    s_event_full_percent = full_percent;
+
+    while(sent < FRAME_NUM) {
+        if((test_rand()%4 == 0) && (frame_send(sent) == TUYA_BLE_SUCCESS)) {
+            sent++;
+        } else if(tuya_ble_gatt_send_queue_used() >= TUYA_BLE_GATT_SEND_DATA_QUEUE_SIZE) {
+            //a full queue refuses the frame and frees it
+            TEST_CHECK(s_heap_used == s_frame_bytes);
+        }
+        run_step();
+        //the frames are the only memory, a sub package is never copied
+        TEST_CHECK_EQ(s_heap_used, s_frame_bytes);
+    }
+    s_event_full_percent = 0;
+    for(uint32_t step=0; (step < 100000) && (s_rx_frame_num < FRAME_NUM); step++) {
+        run_step();
+    }
+
+    TEST_CHECK_EQ(s_rx_frame_num, FRAME_NUM);
+    TEST_CHECK_EQ(s_rx_error, 0);
+    TEST_CHECK_EQ(tuya_ble_gatt_send_queue_used(), 0);
+    TEST_CHECK_EQ(s_heap_used, 0);
+    //the queued frames and the one the full queue refuses
+    TEST_CHECK(s_heap_peak <= (TUYA_BLE_GATT_SEND_DATA_QUEUE_SIZE+1)*FRAME_MAX);
+    while(!link_is_idle()) {
+        run_step();
+    }
+}
+
+//a disconnect drops the waiting frames and frees them
+static void test_disconnect(void)
+{
+    tuya_ble_gatt_send_queue_init();
+    s_link_busy_percent = 100;
+    s_link_in_flight = 1;
+    for(uint32_t idx=0; idx<5; idx++) {
+        frame_send(idx);
+    }
+    TEST_CHECK(s_heap_used > 0);
+
+    //no tx complete comes for the notify lost with the link, the sdk calls it on disconnect
+    s_connect_status = BONDING_UNCONN;
+    s_link_in_flight = 0;
+    tuya_ble_gatt_send_tx_complete();
+    while(!link_is_idle()) {
+        run_step();
+    }
+    TEST_CHECK_EQ(tuya_ble_gatt_send_queue_used(), 0);
+    TEST_CHECK_EQ(s_heap_used, 0);
+    s_connect_status = BONDING_CONN;
+    s_link_busy_percent = 0;
+}
+
+int main(void)
+{
+    test_order(0, 0);
+    test_order(50, 0);
+    test_order(50, 50);
+    test_order(90, 90);
+    test_disconnect();
+    printf("idle gaps after tx complete: %u of %u\n", s_idle_gap, s_tx_complete);
+    TEST_CHECK(s_tx_complete > FRAME_NUM);
+#if TUYA_BLE_GATT_SEND_ON_TX_COMPLETE
+    //the next sub package goes out from the tx complete itself
+    TEST_CHECK_EQ(s_idle_gap, 0);
+#else
+    //it waits for the event queue
+    TEST_CHECK(s_idle_gap > 0);
+    //the full event queue was met and the timer resumed sending
+    TEST_CHECK(s_event_refused > 0);
+    TEST_CHECK(s_timer_fired > 0);
+#endif
+    return TEST_RESULT();
+}
@@ -0,0 +1,160 @@
+//memberid/slaveid index of app_flash.c against a full scan of the nv
+#include "test_common.h"
+#include "app_flash.h"
+
+/*********************************************************************
+ * fake nv, one record per area and id
+ */
+#define NV_AREA_NUM 5
+#define NV_ID_NUM   HARDID_MAX_TOTAL+EVTID_MAX
+
+static struct {
+    bool    valid;
+    uint8_t data[64];
+} nv[NV_AREA_NUM][NV_ID_NUM];
+
+uint32_t app_port_nv_set(uint32_t area_id, uint16_t id, void *buf, uint8_t size)
+{
+    nv[area_id][id].valid = true;
+    memcpy(nv[area_id][id].data, buf, size);
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_nv_get(uint32_t area_id, uint16_t id, void *buf, uint8_t size)
+{
+    if(!nv[area_id][id].valid) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    memcpy(buf, nv[area_id][id].data, size);
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_nv_del(uint32_t area_id, uint16_t id)
+{
+    nv[area_id][id].valid = false;
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_nv_set_default(void)
+{
+    memset(nv, 0, sizeof(nv));
+    return APP_PORT_SUCCESS;
+}
+
+tuya_ble_connect_status_t app_port_get_connect_status(void)
+{
+    return BONDING_CONN;
+}
+
+tuya_ble_status_t tuya_ble_master_info_init(slave_info_t* info, uint8_t slave_max_num)
+{
+    return 0;
+}
+
+lock_dp_t g_cmd;
+
+static uint32_t hard_delete_num;
+uint32_t lock_hard_doorcard_delete(uint8_t hardid) { hard_delete_num++; return 0; }
+uint32_t lock_hard_finger_delete(uint8_t hardid)   { hard_delete_num++; return 0; }
+uint32_t lock_hard_face_delete(uint8_t hardid)     { hard_delete_num++; return 0; }
+
+/*********************************************************************
+ * reference, the full scan the index replaced
+ */
+static void scan(bool by_member, uint16_t id, uint8_t* type, uint8_t* hardid, uint8_t* num)
+{
+    *num = 0;
+    for(uint32_t idx=0; idx<HARDID_MAX_TOTAL; idx++) {
+        lock_hard_t hard;
+        if(app_port_nv_get(SF_AREA_1, idx, &hard, sizeof(hard)) != APP_PORT_SUCCESS) {
+            continue;
+        }
+        if((by_member && hard.member_id == id) || (!by_member && hard.slaveid == id)) {
+            hardid[*num] = idx;
+            type[*num] = hard.hard_type;
+            *num += 1;
+        }
+    }
+}
+
+static void check_id(uint16_t id)
+{
+    uint8_t type[HARDID_MAX_TOTAL], hardid[HARDID_MAX_TOTAL], num;
+    uint8_t ref_type[HARDID_MAX_TOTAL], ref_hardid[HARDID_MAX_TOTAL], ref_num;
+
+    if(id <= 0xFF) {
+        lock_hardid_load_by_memberid(id, type, hardid, &num);
+        scan(true, id, ref_type, ref_hardid, &ref_num);
+        TEST_CHECK_EQ(num, ref_num);
+        TEST_CHECK(memcmp(hardid, ref_hardid, num) == 0);
+        TEST_CHECK(memcmp(type, ref_type, num) == 0);
+    }
+
+    lock_hardid_load_by_slaveid(id, type, hardid, &num);
+    scan(false, id, ref_type, ref_hardid, &ref_num);
+    TEST_CHECK_EQ(num, ref_num);
+    TEST_CHECK(memcmp(hardid, ref_hardid, num) == 0);
+    TEST_CHECK(memcmp(type, ref_type, num) == 0);
+}
+
+static void check_all(void)
+{
+    //every id in use and the ones next to them, slaveid is 16 bit
+    for(uint16_t id=0; id<=20; id++) {
+        check_id(id);
+    }
+    check_id(0xFF);
+    check_id(0x100);
+    for(uint32_t id=0xFFEF; id<=0xFFFF; id++) {
+        check_id(id);
+    }
+}
+
+static void random_hard(lock_hard_t* hard)
+{
+    memset(hard, 0, sizeof(*hard));
+    hard->hard_type = 1 + test_rand()%OPEN_METH_TEMP_PW;
+    hard->hard_id = hardid_start[hard->hard_type] + test_rand()%hardid_max[hard->hard_type];
+    hard->member_id = test_rand()%20;
+    hard->slaveid = ((test_rand()%4 == 0) ? 0xFFEC : 0) + test_rand()%20;
+}
+
+int main(void)
+{
+    lock_hard_t hard;
+
+    //empty
+    lock_flash_init();
+    check_all();
+
+    //random save (new or modify) and delete
+    for(uint32_t step=0; step<5000; step++) {
+        uint32_t op = test_rand()%10;
+        if(op < 6) {
+            random_hard(&hard);
+            TEST_CHECK_EQ(lock_hard_save(&hard), APP_PORT_SUCCESS);
+        } else if(op < 9) {
+            lock_hard_delete(test_rand()%HARDID_MAX_TOTAL);
+        } else {
+            lock_hard_delete_all_by_memberid(test_rand()%20);
+        }
+        check_all();
+    }
+
+    //rebuilt from the nv after a reset
+    lock_flash_init();
+    check_all();
+
+    //delete by slaveid removes exactly the scanned hards
+    for(uint32_t idx=0; idx<40; idx++) {
+        uint8_t type[HARDID_MAX_TOTAL], hardid[HARDID_MAX_TOTAL], num;
+        uint16_t id = (idx < 20) ? idx : (0xFFEC + idx - 20);
+        lock_hard_delete_all_by_slaveid(id);
+        scan(false, id, type, hardid, &num);
+        TEST_CHECK_EQ(num, 0);
+        check_all();
+    }
+    TEST_CHECK_EQ(lock_get_vaild_hardid_num(OPEN_METH_PASSWORD), 0);
+
+    return TEST_RESULT();
+}
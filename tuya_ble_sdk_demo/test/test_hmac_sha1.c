@@ -0,0 +1,272 @@
+//hmac-sha1.c against rfc 2202, and the dynamic password check against the pow/snprintf/HMAC_SHA1 path it replaced
+#include <math.h>
+#include <time.h>
+#include "test_common.h"
+#include "sha1.h"
+#include "hmac-sha1.h"
+#include "lock_dynamic_pwd.h"
+
+#define VECTOR_NUM              20000
+
+/*********************************************************
+ * what lock_dynamic_pwd_verify reads
+ */
+tuya_ble_parameters_settings_t tuya_ble_current_para;
+static uint32_t s_timestamp = 0;
+
+uint32_t app_port_get_timestamp(void)
+{
+    return s_timestamp;
+}
+
+/*********************************************************
+ * the old path, HMAC_SHA1 rebuilt the pads on every call
+ */
+static void ref_hmac_sha1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned int msg_len, uint8_t *digest)
+{
+    uint8_t ipad[HMAC_BLOCK_SIZE];
+    uint8_t opad[HMAC_BLOCK_SIZE];
+    uint8_t tk[SHA1HashSize];
+    SHA1Context sha;
+
+    if(key_len > HMAC_BLOCK_SIZE) {
+        SHA1(key, key_len, tk);
+        key = tk;
+        key_len = SHA1HashSize;
+    }
+    memset(ipad, 0, HMAC_BLOCK_SIZE);
+    memset(opad, 0, HMAC_BLOCK_SIZE);
+    memcpy(ipad, key, key_len);
+    memcpy(opad, key, key_len);
+    for(int i=0; i<HMAC_BLOCK_SIZE; i++) {
+        ipad[i] ^= 0x36;
+        opad[i] ^= 0x5c;
+    }
+    SHA1Reset(&sha);
+    SHA1Input(&sha, ipad, HMAC_BLOCK_SIZE);
+    SHA1Input(&sha, message, msg_len);
+    SHA1Result(&sha, digest);
+    SHA1Reset(&sha);
+    SHA1Input(&sha, opad, HMAC_BLOCK_SIZE);
+    SHA1Input(&sha, digest, SHA1HashSize);
+    SHA1Result(&sha, digest);
+}
+
+static uint32_t ref_totp(uint8_t *key, uint32_t timeseq)
+{
+    char timeseq_str[DYNAMIC_PWD_TOKEN_SIZE+1] = {0};
+    uint8_t digest[20];
+    uint32_t offset, dt;
+
+    snprintf(timeseq_str, sizeof(timeseq_str), "%X", timeseq);
+    if(strlen(timeseq_str) < DYNAMIC_PWD_TOKEN_SIZE) {
+        snprintf(timeseq_str, sizeof(timeseq_str), "%08X", timeseq);
+    }
+    ref_hmac_sha1(key, LOGIN_KEY_LEN, (uint8_t*)timeseq_str, strlen(timeseq_str), digest);
+    offset = digest[20 - 3] & 0x0F;
+    dt = ((digest[offset] & 0x7F) << 24) | (digest[offset + 1] << 16) | (digest[offset + 2] << 8) | digest[offset + 3];
+    return dt % (int)pow(10.0, DYNAMIC_PWD_TOKEN_SIZE);
+}
+
+//the old verify_dynamic_pwd_token
+static int ref_verify(uint8_t *key, uint32_t input_pwd, uint32_t ts)
+{
+    for(int verify_cnt=0; verify_cnt<3; verify_cnt++) {
+        uint32_t timeseq;
+        if(verify_cnt == 0) {
+            timeseq = ts / DYNAMIC_PWD_TIME_STEP;
+        } else if(verify_cnt == 1) {
+            timeseq = (ts + DYNAMIC_PWD_TIME_WINDOW) / DYNAMIC_PWD_TIME_STEP;
+        } else {
+            timeseq = (ts - DYNAMIC_PWD_TIME_WINDOW) / DYNAMIC_PWD_TIME_STEP;
+        }
+        if(timeseq == 0) {
+            return DYNAMIC_PWD_ERR_PARAS;
+        }
+        if(ref_totp(key, timeseq) == input_pwd) {
+            return DYNAMIC_PWD_VERIFY_SUCCESS;
+        }
+    }
+    return DYNAMIC_PWD_ERR_TIMESEQ;
+}
+
+static int verify(uint32_t input_pwd, uint32_t ts)
+{
+    uint8_t pwd[DYNAMIC_PWD_TOKEN_SIZE];
+
+    for(int idx=DYNAMIC_PWD_TOKEN_SIZE-1; idx>=0; idx--) {
+        pwd[idx] = input_pwd % 10;
+        input_pwd /= 10;
+    }
+    s_timestamp = ts;
+    return lock_dynamic_pwd_verify(pwd, DYNAMIC_PWD_TOKEN_SIZE);
+}
+
+static void hex_to_bin(const char* hex, uint8_t* bin)
+{
+    for(uint32_t idx=0; hex[2*idx]; idx++) {
+        unsigned int byte;
+        sscanf(&hex[2*idx], "%2x", &byte);
+        bin[idx] = byte;
+    }
+}
+
+/*********************************************************
+ * cases
+ */
+//rfc 2202 section 3, one shot and through a kept context
+static void test_rfc2202(void)
+{
+    static const struct {
+        uint8_t key_byte;   //0 for the key of case 2 and 4
+        uint8_t key_len;
+        const char* data;
+        uint8_t data_byte;  //repeated data_len times when data is NULL
+        uint8_t data_len;
+        const char* digest;
+    } vector[] = {
+        {0x0B, 20, "Hi There",                     0, 0,  "b617318655057264e28bc0b6fb378c8ef146be00"},
+        {0,    4,  "what do ya want for nothing?", 0, 0,  "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79"},
+        {0xAA, 20, NULL,                           0xDD, 50, "125d7342b9ac11cd91a39af48aa17b4f63f175d3"},
+        {0,    25, NULL,                           0xCD, 50, "4c9007f4026250c6bc8414f9bf50c86c2d7235da"},
+        {0x0C, 20, "Test With Truncation",         0, 0,  "4c1a03424b55e07fe7f27be1d58bb9324a9a5a04"},
+        {0xAA, 80, "Test Using Larger Than Block-Size Key - Hash Key First", 0, 0, "aa4ae5e15272d00e95705637ce8a3b55ed402112"},
+        {0xAA, 80, "Test Using Larger Than Block-Size Key and Larger Than One Block-Size Data", 0, 0, "e8e99d0f45237d786d6bbaa7965c7808bbff1a91"},
+    };
+
+    for(uint32_t idx=0; idx<sizeof(vector)/sizeof(vector[0]); idx++) {
+        uint8_t key[80];
+        uint8_t data[80];
+        uint32_t data_len;
+        uint8_t expect[SHA1HashSize];
+        uint8_t digest[SHA1HashSize];
+        HMAC_SHA1Context ctx;
+
+        if(idx == 1) {
+            memcpy(key, "Jefe", 4);
+        } else if(idx == 3) {
+            for(uint32_t pos=0; pos<25; pos++) {
+                key[pos] = pos + 1;
+            }
+        } else {
+            memset(key, vector[idx].key_byte, vector[idx].key_len);
+        }
+        if(vector[idx].data) {
+            data_len = strlen(vector[idx].data);
+            memcpy(data, vector[idx].data, data_len);
+        } else {
+            data_len = vector[idx].data_len;
+            memset(data, vector[idx].data_byte, data_len);
+        }
+        hex_to_bin(vector[idx].digest, expect);
+
+        HMAC_SHA1(key, vector[idx].key_len, data, data_len, digest);
+        TEST_CHECK(memcmp(digest, expect, SHA1HashSize) == 0);
+
+        HMAC_SHA1_Init(&ctx, key, vector[idx].key_len);
+        memset(key, 0, sizeof(key));
+        for(uint32_t round=0; round<2; round++) {
+            memset(digest, 0, SHA1HashSize);
+            HMAC_SHA1_Compute(&ctx, data, data_len, digest);
+            TEST_CHECK(memcmp(digest, expect, SHA1HashSize) == 0);
+        }
+    }
+}
+
+//one context, messages across the block borders, keys across the block size
+static void test_kept_context(void)
+{
+    uint8_t key[130];
+    uint8_t msg[200];
+    uint8_t expect[SHA1HashSize];
+    uint8_t digest[SHA1HashSize];
+    HMAC_SHA1Context ctx;
+
+    for(uint32_t key_len=0; key_len<=sizeof(key); key_len++) {
+        for(uint32_t idx=0; idx<key_len; idx++) {
+            key[idx] = test_rand();
+        }
+        HMAC_SHA1_Init(&ctx, key, key_len);
+        for(uint32_t msg_len=0; msg_len<=sizeof(msg); msg_len+=1+test_rand()%9) {
+            for(uint32_t idx=0; idx<msg_len; idx++) {
+                msg[idx] = test_rand();
+            }
+            ref_hmac_sha1(key, key_len, msg, msg_len, expect);
+            HMAC_SHA1_Compute(&ctx, msg, msg_len, digest);
+            TEST_CHECK(memcmp(digest, expect, SHA1HashSize) == 0);
+        }
+    }
+}
+
+//random login keys and time counters, the kept pads follow a key change
+static void test_dynamic_pwd(void)
+{
+    uint8_t* key = tuya_ble_current_para.sys_settings.login_key;
+    uint8_t last_key[LOGIN_KEY_LEN];
+    uint32_t pass = 0;
+
+    for(uint32_t idx=0; idx<VECTOR_NUM; idx++) {
+        uint32_t ts = (test_rand() << 8) ^ test_rand();
+        uint32_t input_pwd;
+        int expect;
+
+        //the same key for a few checks, sometimes the one before
+        if(idx % 4 == 0) {
+            memcpy(last_key, key, LOGIN_KEY_LEN);
+            for(uint32_t pos=0; pos<LOGIN_KEY_LEN; pos++) {
+                key[pos] = '0' + test_rand() % 75;
+            }
+        } else if(idx % 13 == 0) {
+            memcpy(key, last_key, LOGIN_KEY_LEN);
+        } else if(idx % 17 == 0) {
+            key[test_rand() % LOGIN_KEY_LEN] ^= 1;
+        }
+        if(idx % 100 == 0) {
+            ts = test_rand() % (3*DYNAMIC_PWD_TIME_STEP);
+        }
+
+        switch(test_rand() % 4) {
+            case 0: input_pwd = ref_totp(key, ts / DYNAMIC_PWD_TIME_STEP); break;
+            case 1: input_pwd = ref_totp(key, (ts + DYNAMIC_PWD_TIME_WINDOW) / DYNAMIC_PWD_TIME_STEP); break;
+            case 2: input_pwd = ref_totp(key, (ts - DYNAMIC_PWD_TIME_WINDOW) / DYNAMIC_PWD_TIME_STEP); break;
+            default: input_pwd = test_rand() % 100000000; break;
+        }
+
+        expect = ref_verify(key, input_pwd, ts);
+        TEST_CHECK_EQ(verify(input_pwd, ts), expect);
+        pass += (expect == DYNAMIC_PWD_VERIFY_SUCCESS);
+    }
+    TEST_CHECK(pass > VECTOR_NUM/2);
+}
+
+//checks of one key, as the lock sees them
+static void test_speed(void)
+{
+    uint8_t* key = tuya_ble_current_para.sys_settings.login_key;
+    uint32_t ts = 1700000000;
+    uint32_t sink = 0;
+    clock_t start;
+    double old_s, new_s;
+
+    memcpy(key, "abcdef", LOGIN_KEY_LEN);
+    start = clock();
+    for(uint32_t idx=0; idx<VECTOR_NUM; idx++) {
+        sink += ref_verify(key, idx, ts + idx);
+    }
+    old_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for(uint32_t idx=0; idx<VECTOR_NUM; idx++) {
+        sink += verify(idx, ts + idx);
+    }
+    new_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("dynamic pwd check: old %.2f us, new %.2f us (%u)\n", old_s*1e6/VECTOR_NUM, new_s*1e6/VECTOR_NUM, sink & 1);
+}
+
+int main(void)
+{
+    test_rfc2202();
+    test_kept_context();
+    test_dynamic_pwd();
+    test_speed();
+    return TEST_RESULT();
+}
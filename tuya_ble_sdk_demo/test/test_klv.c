@@ -0,0 +1,321 @@
+#include "test_common.h"
+#include "tuya_ble_mem.h"
+#include "tuya_ble_mutli_tsf_protocol.h"
+
+#define KLV_LEN_1               0   //len in 1 byte
+#define KLV_LEN_2               1   //len in 2 bytes
+#define BUF_MAX                 1024
+#define GUARD                   0xEE
+
+/*********************************************************
+ * heap, the list api must give back every block
+ */
+static int32_t s_heap_blocks = 0;
+
+void *tuya_ble_malloc(uint16_t size)
+{
+    s_heap_blocks++;
+    return malloc(size);
+}
+
+tuya_ble_status_t tuya_ble_free(uint8_t *ptr)
+{
+    s_heap_blocks--;
+    free(ptr);
+    return TUYA_BLE_SUCCESS;
+}
+
+/*********************************************************
+ * dps written by hand, the reference of the wire format
+ */
+static uint32_t ref_put(uint8_t* buf, uint8_t id, uint8_t type, uint16_t len, uint8_t fill, uint8_t len_type)
+{
+    uint32_t pos = 0;
+
+    buf[pos++] = id;
+    buf[pos++] = type;
+    if(len_type == KLV_LEN_2) {
+        buf[pos++] = len >> 8;
+    }
+    buf[pos++] = len & 0xFF;
+    memset(&buf[pos], fill, len);
+    return pos + len;
+}
+
+/*********************************************************
+ * cases
+ */
+static void test_view_next(void)
+{
+    uint8_t buf[BUF_MAX];
+    uint32_t size = 0;
+    uint32_t offset = 0;
+    klv_view_s view;
+
+    size += ref_put(&buf[size], 1, DT_BOOL, 1, 0x01, KLV_LEN_1);
+    size += ref_put(&buf[size], 2, DT_RAW, 0, 0, KLV_LEN_1);
+    size += ref_put(&buf[size], 3, DT_RAW, 255, 0x33, KLV_LEN_1);
+
+    //every dp is read in place
+    TEST_CHECK_EQ(klv_view_next(buf, size, &offset, &view, KLV_LEN_1), MTP_OK);
+    TEST_CHECK_EQ(view.id, 1);
+    TEST_CHECK_EQ(view.type, DT_BOOL);
+    TEST_CHECK_EQ(view.len, 1);
+    TEST_CHECK(view.data == &buf[3]);
+    TEST_CHECK_EQ(offset, 4);
+    TEST_CHECK_EQ(klv_view_next(buf, size, &offset, &view, KLV_LEN_1), MTP_OK);
+    TEST_CHECK_EQ(view.id, 2);
+    TEST_CHECK_EQ(view.len, 0);
+    TEST_CHECK_EQ(offset, 7);
+    TEST_CHECK_EQ(klv_view_next(buf, size, &offset, &view, KLV_LEN_1), MTP_OK);
+    TEST_CHECK_EQ(view.id, 3);
+    TEST_CHECK_EQ(view.len, 255);
+    TEST_CHECK(view.data == &buf[10]);
+    TEST_CHECK_EQ(offset, size);
+
+    //nothing left, or an offset behind the end
+    TEST_CHECK_EQ(klv_view_next(buf, size, &offset, &view, KLV_LEN_1), MTP_COM_ERROR);
+    offset = size + 1;
+    TEST_CHECK_EQ(klv_view_next(buf, size, &offset, &view, KLV_LEN_1), MTP_COM_ERROR);
+    TEST_CHECK_EQ(offset, size + 1);
+
+    //a cut head and cut data leave the offset alone
+    for(uint32_t len=0; len<=4; len++) {
+        offset = 0;
+        TEST_CHECK_EQ(klv_view_next(buf, len, &offset, &view, KLV_LEN_1), (len < 4) ? MTP_COM_ERROR : MTP_OK);
+        TEST_CHECK_EQ(offset, (len < 4) ? 0 : 4);
+    }
+    offset = 7;
+    TEST_CHECK_EQ(klv_view_next(buf, size - 1, &offset, &view, KLV_LEN_1), MTP_COM_ERROR);
+    TEST_CHECK_EQ(offset, 7);
+
+    //a 2 byte length is big-end
+    size = ref_put(buf, 9, DT_STRING, 0x0102, 0x99, KLV_LEN_2);
+    offset = 0;
+    TEST_CHECK_EQ(klv_view_next(buf, size, &offset, &view, KLV_LEN_2), MTP_OK);
+    TEST_CHECK_EQ(view.len, 0x0102);
+    TEST_CHECK(view.data == &buf[4]);
+    TEST_CHECK_EQ(offset, size);
+    offset = 0;
+    TEST_CHECK_EQ(klv_view_next(buf, 3, &offset, &view, KLV_LEN_2), MTP_COM_ERROR);
+    offset = 0;
+    TEST_CHECK_EQ(klv_view_next(buf, size - 1, &offset, &view, KLV_LEN_2), MTP_COM_ERROR);
+
+    TEST_CHECK_EQ(klv_view_next(NULL, size, &offset, &view, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_view_next(buf, size, NULL, &view, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_view_next(buf, size, &offset, NULL, KLV_LEN_1), MTP_INVALID_PARAM);
+}
+
+static void test_data_check(void)
+{
+    uint8_t buf[BUF_MAX];
+    uint32_t size = 0;
+    uint32_t ends[3];
+
+    size += ref_put(&buf[size], 1, DT_VALUE, 4, 0x01, KLV_LEN_1);
+    ends[0] = size;
+    size += ref_put(&buf[size], 2, DT_RAW, 0, 0, KLV_LEN_1);
+    ends[1] = size;
+    size += ref_put(&buf[size], 3, DT_RAW, 200, 0x03, KLV_LEN_1);
+    ends[2] = size;
+
+    //only whole dps pass, every cut is found
+    for(uint32_t len=0; len<=size; len++) {
+        bool whole = (len == ends[0]) || (len == ends[1]) || (len == ends[2]);
+        TEST_CHECK_EQ(klv_data_check(buf, len, KLV_LEN_1), whole ? MTP_OK : MTP_COM_ERROR);
+    }
+    //a length past the end
+    buf[ends[1] + 2] = 201;
+    TEST_CHECK_EQ(klv_data_check(buf, size, KLV_LEN_1), MTP_COM_ERROR);
+    //or short of it, the rest is a cut dp
+    buf[ends[1] + 2] = 199;
+    TEST_CHECK_EQ(klv_data_check(buf, size, KLV_LEN_1), MTP_COM_ERROR);
+    buf[ends[1] + 2] = 200;
+    TEST_CHECK_EQ(klv_data_check(buf, size, KLV_LEN_1), MTP_OK);
+
+    //2 byte lengths longer than 255
+    size = 0;
+    size += ref_put(&buf[size], 1, DT_RAW, 300, 0x01, KLV_LEN_2);
+    size += ref_put(&buf[size], 2, DT_RAW, 256, 0x02, KLV_LEN_2);
+    TEST_CHECK_EQ(klv_data_check(buf, size, KLV_LEN_2), MTP_OK);
+    TEST_CHECK_EQ(klv_data_check(buf, size - 1, KLV_LEN_2), MTP_COM_ERROR);
+    TEST_CHECK_EQ(klv_data_check(buf, size, KLV_LEN_1), MTP_COM_ERROR);
+    //a length the buffer can't hold
+    buf[2] = 0xFF;
+    buf[3] = 0xFF;
+    TEST_CHECK_EQ(klv_data_check(buf, size, KLV_LEN_2), MTP_COM_ERROR);
+
+    TEST_CHECK_EQ(klv_data_check(NULL, size, KLV_LEN_1), MTP_INVALID_PARAM);
+}
+
+static void test_data_put(void)
+{
+    uint8_t buf[BUF_MAX];
+    uint8_t raw[300];
+    uint32_t offset = 0;
+    uint32_t value = 0x11223344;
+    uint32_t bitmap = 0x0000A55A;
+    uint8_t byte = 0x01;
+
+    memset(raw, 0x77, sizeof(raw));
+    memset(buf, GUARD, sizeof(buf));
+
+    //value and bitmap are taken from a uint32_t and sent big-end
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_VALUE, &value, DT_VALUE_LEN, KLV_LEN_1), MTP_OK);
+    TEST_CHECK_EQ(offset, 3 + 4);
+    TEST_CHECK(memcmp(buf, "\x01\x02\x04\x11\x22\x33\x44", 7) == 0);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 2, DT_BITMAP, &bitmap, 2, KLV_LEN_1), MTP_OK);
+    TEST_CHECK(memcmp(&buf[7], "\x02\x05\x02\xA5\x5A", 5) == 0);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 3, DT_BITMAP, &bitmap, 1, KLV_LEN_1), MTP_OK);
+    TEST_CHECK(memcmp(&buf[12], "\x03\x05\x01\x5A", 4) == 0);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 4, DT_ENUM, &byte, DT_ENUM_LEN, KLV_LEN_1), MTP_OK);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 5, DT_BOOL, &byte, DT_BOOL_LEN, KLV_LEN_1), MTP_OK);
+    TEST_CHECK(memcmp(&buf[16], "\x04\x04\x01\x01\x05\x01\x01\x01", 8) == 0);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 6, DT_RAW, NULL, 0, KLV_LEN_1), MTP_OK);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 7, DT_RAW, raw, 255, KLV_LEN_1), MTP_OK);
+    TEST_CHECK_EQ(offset, 24 + 3 + 3 + 255);
+    TEST_CHECK_EQ(buf[offset], GUARD);
+    TEST_CHECK_EQ(klv_data_check(buf, offset, KLV_LEN_1), MTP_OK);
+
+    //fixed length types must carry their length
+    offset = 0;
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_VALUE, &value, 2, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_BOOL, &byte, 2, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_ENUM, &byte, 0, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_BITMAP, &bitmap, 0, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_BITMAP, &bitmap, 5, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_LMT + 1, raw, 1, KLV_LEN_1), MTP_INVALID_PARAM);
+    //an oversized length does not fit in 1 byte
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_RAW, raw, 256, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 1, DT_RAW, NULL, 1, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_data_put(NULL, sizeof(buf), &offset, 1, DT_RAW, raw, 1, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), NULL, 1, DT_RAW, raw, 1, KLV_LEN_1), MTP_INVALID_PARAM);
+    TEST_CHECK_EQ(offset, 0);
+
+    //but in 2
+    TEST_CHECK_EQ(klv_data_put(buf, sizeof(buf), &offset, 8, DT_RAW, raw, 300, KLV_LEN_2), MTP_OK);
+    TEST_CHECK_EQ(offset, 4 + 300);
+    TEST_CHECK(memcmp(buf, "\x08\x00\x01\x2C", 4) == 0);
+    TEST_CHECK_EQ(klv_data_check(buf, offset, KLV_LEN_2), MTP_OK);
+}
+
+static void test_data_put_room(void)
+{
+    uint8_t buf[64];
+    uint8_t raw[32];
+    uint32_t offset;
+
+    memset(raw, 0x77, sizeof(raw));
+
+    //the room is checked once, a dp that does not fit changes nothing
+    for(uint32_t size=0; size<=16; size++) {
+        memset(buf, GUARD, sizeof(buf));
+        offset = 4;
+        mtp_ret ret = klv_data_put(buf, size, &offset, 1, DT_RAW, raw, 10, KLV_LEN_1);
+        if(size >= 4 + 3 + 10) {
+            TEST_CHECK_EQ(ret, MTP_OK);
+            TEST_CHECK_EQ(offset, 4 + 3 + 10);
+        }
+        else {
+            TEST_CHECK_EQ(ret, MTP_COM_ERROR);
+            TEST_CHECK_EQ(offset, 4);
+            for(uint32_t idx=0; idx<sizeof(buf); idx++) {
+                TEST_CHECK_EQ(buf[idx], GUARD);
+            }
+        }
+    }
+    offset = 4 + 3 + 10;
+    memset(buf, GUARD, sizeof(buf));
+    TEST_CHECK_EQ(klv_data_put(buf, 4 + 3 + 10 + 4, &offset, 2, DT_RAW, raw, 0, KLV_LEN_2), MTP_OK);
+    TEST_CHECK_EQ(klv_data_put(buf, 4 + 3 + 10 + 4, &offset, 3, DT_RAW, raw, 0, KLV_LEN_2), MTP_COM_ERROR);
+    //an offset behind the end
+    offset = 20;
+    TEST_CHECK_EQ(klv_data_put(buf, 16, &offset, 1, DT_RAW, NULL, 0, KLV_LEN_1), MTP_COM_ERROR);
+    TEST_CHECK_EQ(offset, 20);
+}
+
+//random buffers, klv_data_check and the list api agree and every walk stays in the buffer
+static void test_random(void)
+{
+    uint8_t buf[BUF_MAX];
+
+    for(uint32_t round=0; round<20000; round++) {
+        uint8_t len_type = test_rand() % 2;
+        uint32_t size = 0;
+        uint32_t dp_num = 1 + test_rand() % 6;
+
+        //valid dps, sometimes cut or changed after
+        for(uint32_t idx=0; idx<dp_num; idx++) {
+            uint16_t len = test_rand() % (len_type ? 400 : 256);
+            if(size + 4 + len > BUF_MAX) {
+                break;
+            }
+            size += ref_put(&buf[size], idx, DT_RAW, len, idx, len_type);
+        }
+        bool whole = true;
+        switch(test_rand() % 4) {
+            case 0: {
+                if(size > 0) {
+                    size -= 1 + test_rand() % size;
+                    whole = false;
+                }
+            } break;
+            case 1: {
+                if(size > 0) {
+                    buf[test_rand() % size] = test_rand();
+                    whole = false;
+                }
+            } break;
+            default: {
+            } break;
+        }
+
+        mtp_ret ret = klv_data_check(buf, size, len_type);
+        if(whole) {
+            TEST_CHECK_EQ(ret, (size > 0) ? MTP_OK : MTP_COM_ERROR);
+        }
+
+        klv_node_s* list = NULL;
+        TEST_CHECK_EQ(data_2_klvlist(buf, size, &list, len_type), ret);
+        if(ret == MTP_OK) {
+            //the list comes back as the same bytes, in reverse dp order
+            uint8_t* data = NULL;
+            uint32_t data_len = 0;
+            uint32_t offset = 0;
+            klv_view_s view;
+            uint32_t num = 0;
+            klv_node_s* node;
+
+            TEST_CHECK_EQ(klvlist_2_data(list, &data, &data_len, len_type), MTP_OK);
+            TEST_CHECK_EQ(data_len, size);
+            for(node=list; node!=NULL; node=node->next) {
+                num++;
+            }
+            while(offset < size) {
+                TEST_CHECK_EQ(klv_view_next(buf, size, &offset, &view, len_type), MTP_OK);
+                node = list;
+                for(uint32_t idx=1; idx<num; idx++) {
+                    node = node->next;
+                }
+                TEST_CHECK_EQ(node->id, view.id);
+                TEST_CHECK_EQ(node->len, view.len);
+                TEST_CHECK(memcmp(node->data, view.data, view.len) == 0);
+                num--;
+            }
+            TEST_CHECK_EQ(num, 0);
+            tuya_ble_free(data);
+            free_klv_list(list);
+        }
+        TEST_CHECK_EQ(s_heap_blocks, 0);
+    }
+}
+
+int main(void)
+{
+    test_view_next();
+    test_data_check();
+    test_data_put();
+    test_data_put_room();
+    test_random();
+    return TEST_RESULT();
+}
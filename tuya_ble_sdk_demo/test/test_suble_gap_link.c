@@ -0,0 +1,332 @@
+#include "test_common.h"
+#include "suble_common.h"
+#include "tuya_ble_gatt_send_queue.h"
+
+#define CONIDX                  0
+//the link policy asks for these, in 1.25ms units
+#define BULK_INTV_MAX           ((30*4)/5)
+#define IDLE_INTV_MIN           ((SUBLE_CONN_INTERVAL_MIN*4)/5)
+#define IDLE_INTV_MAX           ((SUBLE_CONN_INTERVAL_MAX*4)/5)
+#define IDLE_WINDOWS            5
+#define RETRY_WINDOWS           30
+
+/*********************************************************
+ * the simulated central, answers a request when the test says so
+ */
+typedef struct {
+    bool     link_busy;         //appc_update_param can't send
+    uint32_t requests;
+    bool     pending;
+    uint16_t intv_min;
+    uint16_t intv_max;
+    uint16_t latency;
+} central_t;
+
+static central_t s_central;
+
+uint8_t appc_update_param(uint8_t conidx, uint16_t intv_min, uint16_t intv_max, uint16_t latency, uint16_t time_out)
+{
+    TEST_CHECK_EQ(conidx, CONIDX);
+    if(s_central.link_busy) {
+        return GAP_ERR_COMMAND_DISALLOWED;
+    }
+    //one request at a time
+    TEST_CHECK(!s_central.pending);
+    s_central.requests++;
+    s_central.pending = true;
+    s_central.intv_min = intv_min;
+    s_central.intv_max = intv_max;
+    s_central.latency = latency;
+    return GAP_ERR_NO_ERROR;
+}
+
+//the stack reports the new parameters first, then the end of the procedure
+static void central_answer(bool accept)
+{
+    TEST_CHECK(s_central.pending);
+    s_central.pending = false;
+    if(accept) {
+        suble_gap_link_param_updated(CONIDX, s_central.intv_max, s_central.latency);
+    }
+    suble_gap_link_param_result(CONIDX, accept);
+}
+
+//the central changes the parameters by itself
+static void central_update(uint16_t interval, uint16_t latency)
+{
+    suble_gap_link_param_updated(CONIDX, interval, latency);
+}
+
+/*********************************************************
+ * the rest of the firmware
+ */
+struct bd_addr co_default_bdaddr;
+static uint8_t s_queue_used = 0;
+static suble_timer_t* s_window_timer = NULL;
+static uint32_t s_cbc_cache_clears = 0;
+
+uint8_t tuya_ble_gatt_send_queue_used(void)
+{
+    return s_queue_used;
+}
+
+void suble_timer_start_0(suble_timer_t* timer, uint32_t ms, uint32_t count)
+{
+    TEST_CHECK_EQ(ms, 1000);
+    s_window_timer = timer;
+}
+
+void suble_timer_stop_0(suble_timer_t* timer)
+{
+    if(s_window_timer == timer) {
+        s_window_timer = NULL;
+    }
+}
+
+uint8_t appm_start_connencting(struct gap_bdaddr bdaddr) { return 0; }
+void appm_disconnect(uint8_t conidx) {}
+void tuya_ble_app_evt_send(int evtid) {}
+void tuya_ble_aes128_cbc_cache_clear(void)
+{
+    s_cbc_cache_clears++;
+}
+void suble_svc_notify_reset(void) {}
+void suble_flash_read(uint32_t addr, uint8_t *buf, uint32_t size) { memset(buf, 0xFF, size); }
+void suble_flash_write(uint32_t addr, uint8_t *buf, uint32_t size) {}
+void suble_flash_erase(uint32_t addr, uint32_t num) {}
+void suble_util_reverse_byte(void* buf, uint32_t size) {}
+uint32_t suble_util_str_hexstr2hexarray(uint8_t* hexstr, uint32_t size, uint8_t* hexarray) { return 0; }
+
+static void windows(uint32_t num, uint32_t pkg_per_window)
+{
+    for(uint32_t idx=0; idx<num; idx++) {
+        for(uint32_t pkg=0; pkg<pkg_per_window; pkg++) {
+            suble_gap_link_traffic();
+        }
+        if(s_window_timer != NULL) {
+            s_window_timer->handler(s_window_timer);
+        }
+    }
+}
+
+static void connect(void)
+{
+    memset(&s_central, 0, sizeof(s_central));
+    g_conn_info[0].condix = CONIDX;
+    suble_gap_conn_handler();
+    TEST_CHECK(s_window_timer != NULL);
+}
+
+/*********************************************************
+ * cases
+ */
+static void test_bulk_then_idle(void)
+{
+    connect();
+
+    //bulk is asked for in the window the traffic starts
+    windows(1, 8);
+    TEST_CHECK_EQ(s_central.requests, 1);
+    TEST_CHECK_EQ(s_central.intv_max, BULK_INTV_MAX);
+    TEST_CHECK_EQ(s_central.latency, 0);
+    central_answer(true);
+
+    //no new request while the traffic goes on
+    windows(20, 10);
+    TEST_CHECK_EQ(s_central.requests, 1);
+
+    //idle after the quiet windows
+    windows(IDLE_WINDOWS - 1, 0);
+    TEST_CHECK_EQ(s_central.requests, 1);
+    windows(1, 0);
+    TEST_CHECK_EQ(s_central.requests, 2);
+    TEST_CHECK_EQ(s_central.intv_min, IDLE_INTV_MIN);
+    TEST_CHECK_EQ(s_central.intv_max, IDLE_INTV_MAX);
+    central_answer(true);
+    windows(50, 0);
+    TEST_CHECK_EQ(s_central.requests, 2);
+
+    //a full send queue is bulk as well
+    s_queue_used = 2;
+    windows(1, 0);
+    s_queue_used = 0;
+    TEST_CHECK_EQ(s_central.requests, 3);
+    central_answer(true);
+
+    suble_gap_disconn_handler();
+    TEST_CHECK(s_window_timer == NULL);
+}
+
+static void test_request_not_sent(void)
+{
+    connect();
+
+    //the request can't go out, nothing waits for an answer that never comes
+    s_central.link_busy = true;
+    suble_gap_link_op_begin(SUBLE_LINK_OP_OTA);
+    windows(3, 0);
+    TEST_CHECK_EQ(s_central.requests, 0);
+
+    s_central.link_busy = false;
+    windows(1, 0);
+    TEST_CHECK_EQ(s_central.requests, 1);
+    TEST_CHECK_EQ(s_central.intv_max, BULK_INTV_MAX);
+    central_answer(true);
+
+    suble_gap_link_op_end(SUBLE_LINK_OP_OTA);
+    windows(IDLE_WINDOWS, 0);
+    TEST_CHECK_EQ(s_central.requests, 2);
+    central_answer(true);
+
+    suble_gap_disconn_handler();
+}
+
+static void test_refused(void)
+{
+    connect();
+
+    windows(1, 8);
+    TEST_CHECK_EQ(s_central.requests, 1);
+    central_answer(false);
+
+    //not asked again before the retry windows are over
+    windows(RETRY_WINDOWS - 1, 10);
+    TEST_CHECK_EQ(s_central.requests, 1);
+    windows(1, 10);
+    TEST_CHECK_EQ(s_central.requests, 2);
+    central_answer(true);
+
+    suble_gap_disconn_handler();
+}
+
+static void test_central_initiated(void)
+{
+    connect();
+
+    //the central moves the link to 50ms, it is neither mode, and it is left there for a while
+    central_update((50*4)/5, 0);
+    windows(RETRY_WINDOWS - 1, 0);
+    TEST_CHECK_EQ(s_central.requests, 0);
+    windows(1, 0);
+    TEST_CHECK_EQ(s_central.requests, 1);
+    TEST_CHECK_EQ(s_central.intv_max, IDLE_INTV_MAX);
+    central_answer(true);
+
+    //the central goes fast by itself, bulk traffic needs no request then
+    central_update(BULK_INTV_MAX, 0);
+    windows(10, 10);
+    TEST_CHECK_EQ(s_central.requests, 1);
+
+    //a result for a request that is not the link policy's is ignored
+    suble_gap_link_param_result(CONIDX, false);
+    windows(RETRY_WINDOWS + IDLE_WINDOWS, 0);
+    TEST_CHECK_EQ(s_central.requests, 2);
+    central_answer(true);
+
+    suble_gap_disconn_handler();
+}
+
+//the app asks for idle after bonding through the policy, not behind its back
+static void test_relax(void)
+{
+    connect();
+
+    //idle at once, the quiet windows are not waited for
+    suble_gap_link_relax();
+    TEST_CHECK_EQ(s_central.requests, 1);
+    TEST_CHECK_EQ(s_central.intv_max, IDLE_INTV_MAX);
+    suble_gap_link_relax();
+    TEST_CHECK_EQ(s_central.requests, 1);
+    central_answer(true);
+
+    //the answer was to our request, bulk is asked for at once, not held back as the central's choice
+    windows(1, 8);
+    TEST_CHECK_EQ(s_central.requests, 2);
+    TEST_CHECK_EQ(s_central.intv_max, BULK_INTV_MAX);
+    central_answer(true);
+
+    //bulk needs win over it
+    suble_gap_link_op_begin(SUBLE_LINK_OP_OTA);
+    suble_gap_link_relax();
+    windows(IDLE_WINDOWS, 0);
+    TEST_CHECK_EQ(s_central.requests, 2);
+    suble_gap_link_op_end(SUBLE_LINK_OP_OTA);
+    suble_gap_link_relax();
+    TEST_CHECK_EQ(s_central.requests, 3);
+    TEST_CHECK_EQ(s_central.intv_max, IDLE_INTV_MAX);
+
+    //an update the policy did not start, while its request is out, is not taken for the answer
+    central_update(BULK_INTV_MAX, 0);
+    windows(1, 0);
+    TEST_CHECK_EQ(s_central.requests, 3);
+    central_answer(true);
+    windows(RETRY_WINDOWS, 0);
+    TEST_CHECK_EQ(s_central.requests, 3);
+
+    //and the central's choice with nothing out holds the policy back
+    central_update((50*4)/5, 0);
+    suble_gap_link_relax();
+    TEST_CHECK_EQ(s_central.requests, 3);
+
+    suble_gap_disconn_handler();
+    suble_gap_link_relax();
+    TEST_CHECK_EQ(s_central.requests, 3);
+}
+
+static void test_disconnect(void)
+{
+    uint32_t clears;
+
+    connect();
+
+    windows(1, 8);
+    TEST_CHECK_EQ(s_central.requests, 1);
+    //the session keys of the link go with it
+    clears = s_cbc_cache_clears;
+    suble_gap_disconn_handler();
+    TEST_CHECK_EQ(s_cbc_cache_clears - clears, 1);
+
+    //a late answer of the old link is dropped
+    central_answer(true);
+    suble_gap_link_traffic();
+    central_update(BULK_INTV_MAX, 0);
+
+    //a new link starts from the central's parameters
+    connect();
+    windows(IDLE_WINDOWS - 1, 0);
+    TEST_CHECK_EQ(s_central.requests, 0);
+    windows(1, 0);
+    TEST_CHECK_EQ(s_central.requests, 1);
+    TEST_CHECK_EQ(s_central.intv_max, IDLE_INTV_MAX);
+    central_answer(true);
+
+    suble_gap_disconn_handler();
+}
+
+//the master link to a slave lock drops the cached keys too
+static void master_result(uint32_t evt, uint8_t* buf, uint32_t size)
+{
+    TEST_CHECK_EQ(evt, SUBLE_GAP_EVT_DISCONNECTED);
+}
+
+static void test_master_disconnect(void)
+{
+    struct gap_bdaddr bdaddr = {0};
+    uint32_t clears = s_cbc_cache_clears;
+
+    suble_gap_connect(bdaddr, master_result);
+    suble_gap_master_disconn_handler();
+    TEST_CHECK_EQ(s_cbc_cache_clears - clears, 1);
+}
+
+int main(void)
+{
+    test_bulk_then_idle();
+    test_request_not_sent();
+    test_refused();
+    test_central_initiated();
+    test_relax();
+    test_disconnect();
+    test_master_disconnect();
+    return TEST_RESULT();
+}
@@ -0,0 +1,349 @@
+#include "test_common.h"
+#include "suble_common.h"
+#include "tuya_ble_master_port.h"
+
+#define SLOT_CLOCK_MASK         0x07FFFFFF
+#define TIMER_NUM_MAX           4
+#define MS                      1000ull
+
+/*********************************************************
+ * the button pin, the edge interrupt waits to leave the level seen at the last rearm
+ */
+static uint8_t  s_level = SUBLE_LEVEL_HIGH;
+static uint8_t  s_armed_level = SUBLE_LEVEL_HIGH;
+static bool     s_irq_pending = false;
+static bool     s_in_isr = false;
+static uint32_t s_edges_lost = 0;
+
+uint8_t suble_gpio_get_input(uint8_t pin)
+{
+    TEST_CHECK_EQ(pin, ANTILOCK_BUTTON_PIN);
+    return s_level;
+}
+
+void suble_gpio_irq_rearm(uint8_t pin)
+{
+    TEST_CHECK_EQ(pin, ANTILOCK_BUTTON_PIN);
+    s_armed_level = s_level;
+    s_irq_pending = false;
+}
+
+//a lost edge came while the isr switched the edge type, it leaves no status
+static void pin_set(uint8_t level, bool lost)
+{
+    if(level == s_level) {
+        return;
+    }
+    s_level = level;
+    if(lost) {
+        s_edges_lost++;
+        return;
+    }
+    if(level != s_armed_level) {
+        s_irq_pending = true;
+    }
+}
+
+//suble_gpio_irq_handler
+static void irq_run(void)
+{
+    if(!s_irq_pending) {
+        return;
+    }
+    s_in_isr = true;
+    suble_key_edge_handler();
+    s_in_isr = false;
+    suble_gpio_irq_rearm(ANTILOCK_BUTTON_PIN);
+}
+
+/*********************************************************
+ * the slot clock and the suble timers run on virtual time in us
+ */
+static uint64_t s_now = 0;
+static uint32_t s_slot_base = 0;
+static suble_timer_t* s_timer[TIMER_NUM_MAX];
+static uint64_t s_timer_due[TIMER_NUM_MAX];
+static suble_timer_t* s_debounce_timer = NULL;
+static uint32_t s_debounce_wakeups = 0;
+
+uint32_t lld_evt_time_get(void)
+{
+    return (uint32_t)(s_slot_base + s_now/625) & SLOT_CLOCK_MASK;
+}
+
+//the slot clock wraps within the next 10s, only while the key is idle
+static void slot_clock_wrap_soon(void)
+{
+    uint32_t slots = SLOT_CLOCK_MASK - test_rand() % 16000;
+    s_slot_base = (s_slot_base + slots - lld_evt_time_get()) & SLOT_CLOCK_MASK;
+}
+
+void suble_timer_stop_0(suble_timer_t* timer)
+{
+    for(uint32_t idx=0; idx<TIMER_NUM_MAX; idx++) {
+        if(s_timer[idx] == timer) {
+            s_timer[idx] = NULL;
+        }
+    }
+}
+
+void suble_timer_start_0(suble_timer_t* timer, uint32_t ms, uint32_t count)
+{
+    TEST_CHECK_EQ(count, 1);
+    TEST_CHECK((ms > 0) && (ms <= 10000));
+    //the edge handler owns the debounce timer
+    if(s_in_isr) {
+        TEST_CHECK((s_debounce_timer == NULL) || (s_debounce_timer == timer));
+        s_debounce_timer = timer;
+    }
+    suble_timer_stop_0(timer);
+    for(uint32_t idx=0; idx<TIMER_NUM_MAX; idx++) {
+        if(s_timer[idx] == NULL) {
+            s_timer[idx] = timer;
+            s_timer_due[idx] = s_now + ms*MS;
+            return;
+        }
+    }
+    TEST_CHECK(false);
+}
+
+static void run_until(uint64_t end)
+{
+    while(1) {
+        int next = -1;
+        for(uint32_t idx=0; idx<TIMER_NUM_MAX; idx++) {
+            if((s_timer[idx] != NULL) && (s_timer_due[idx] <= end)
+                && ((next < 0) || (s_timer_due[idx] < s_timer_due[next]))) {
+                next = idx;
+            }
+        }
+        if(next < 0) {
+            break;
+        }
+        suble_timer_t* timer = s_timer[next];
+        s_now = s_timer_due[next];
+        s_timer[next] = NULL;
+        if(timer == s_debounce_timer) {
+            s_debounce_wakeups++;
+        }
+        timer->handler(timer);
+    }
+    s_now = end;
+}
+
+/*********************************************************
+ * what the key does, the master scan bonds and disconnects right away
+ */
+static uint32_t s_factory = 0;
+static uint64_t s_factory_time = 0;
+static uint32_t s_open = 0;
+static uint32_t s_close = 0;
+
+conn_info_t g_conn_info[2];
+volatile uint32_t g_open_fail_count = 0;
+
+void lock_factory_handler(void)
+{
+    s_factory++;
+    s_factory_time = s_now;
+}
+
+tuya_ble_status_t tuya_ble_master_open_with_master(uint8_t operation, uint8_t open_meth, void* open_meth_info, uint8_t open_meth_info_size)
+{
+    TEST_CHECK_EQ(open_meth, OR_LOG_OPEN_WITH_KEY);
+    if(operation == TUYA_BLE_MASTER_OPERATION_OPEN) {
+        s_open++;
+    } else {
+        s_close++;
+    }
+    return 0;
+}
+
+tuya_ble_status_t tuya_ble_master_scan_start(int32_t slaveid, tuya_ble_master_evt_handler_t handler)
+{
+    TEST_CHECK_EQ(slaveid, -1);
+    handler(TUYA_BLE_MASTER_EVT_BONDING, NULL, 0);
+    handler(TUYA_BLE_MASTER_EVT_DISCONNECT, NULL, 0);
+    return 0;
+}
+
+uint32_t lock_open_record_report(uint32_t timestamp, uint8_t dp_id, uint32_t hardid, uint16_t slaveid) { return 0; }
+void suble_gap_disconnect(uint16_t condix, uint8_t hci_status_code) {}
+
+/*********************************************************
+ * presses, the stable time is counted from the last press edge to the first release edge
+ */
+typedef enum {
+    PRESS_SHORT = 0,
+    PRESS_CLICK,
+    PRESS_QUICK,        //a click that leaves time for a second one
+    PRESS_LONG,
+    PRESS_TIMEOUT,
+    PRESS_TYPE_MAX,
+} press_t;
+
+static const struct {
+    uint32_t min_ms;
+    uint32_t max_ms;
+    uint32_t wakeups;   //debounce timer expiries per press
+} s_press[PRESS_TYPE_MAX] = {
+    {25,    30,    2}, //press and release debounce, the 40ms threshold is pushed back
+    {100,   2900,  3}, //+40ms
+    {100,   250,   3},
+    {3100,  9900,  4}, //+3s
+    {10100, 12000, 5}, //+10s, the release still debounces
+};
+
+//up to 6 more edges within 7.2ms, the first edge always interrupts
+static void pin_bounce(uint8_t level, uint32_t lost_pct)
+{
+    uint32_t toggles = 2 * (test_rand() % 4);
+
+    pin_set(level, false);
+    irq_run();
+    for(uint32_t idx=0; idx<toggles; idx++) {
+        run_until(s_now + 100 + test_rand() % 1100);
+        pin_set((idx % 2) ? level : !level, (test_rand() % 100) < lost_pct);
+        irq_run();
+    }
+}
+
+static void press(press_t type, uint32_t lost_pct, uint32_t gap_ms)
+{
+    uint32_t stable = s_press[type].min_ms + test_rand() % (s_press[type].max_ms - s_press[type].min_ms + 1);
+    uint32_t wakeups = s_debounce_wakeups;
+    uint32_t factory = s_factory;
+    uint64_t pressed;
+
+    pin_bounce(SUBLE_LEVEL_LOW, lost_pct);
+    pressed = s_now;
+    run_until(s_now + stable*MS);
+    pin_bounce(SUBLE_LEVEL_HIGH, lost_pct);
+    run_until(s_now + gap_ms*MS);
+
+    TEST_CHECK_EQ(s_debounce_wakeups - wakeups, s_press[type].wakeups);
+    if(type == PRESS_TIMEOUT) {
+        TEST_CHECK_EQ(s_factory - factory, 1);
+        //from the last press edge the isr saw, in slots
+        TEST_CHECK((s_factory_time + 10*MS >= pressed + 10000*MS) && (s_factory_time <= pressed + 10000*MS + 2*MS));
+    } else {
+        TEST_CHECK_EQ(s_factory, factory);
+    }
+}
+
+//a single click opens after the 500ms click window
+static void press_check(press_t type, uint32_t lost_pct)
+{
+    uint32_t open = s_open;
+    uint32_t close = s_close;
+
+    press(type, lost_pct, 700);
+    TEST_CHECK_EQ(s_open - open, ((type == PRESS_CLICK) || (type == PRESS_QUICK)) ? 1 : 0);
+    TEST_CHECK_EQ(s_close, close);
+}
+
+static void double_click_check(uint32_t lost_pct)
+{
+    uint32_t open = s_open;
+    uint32_t close = s_close;
+
+    press(PRESS_QUICK, lost_pct, 100 + test_rand() % 100);
+    press(PRESS_QUICK, lost_pct, 700);
+    TEST_CHECK_EQ(s_open, open);
+    TEST_CHECK_EQ(s_close - close, 1);
+}
+
+/*********************************************************
+ * cases
+ */
+static void test_clean(void)
+{
+    for(uint32_t type=0; type<PRESS_TYPE_MAX; type++) {
+        press_check(type, 0);
+    }
+    double_click_check(0);
+}
+
+//bouncing edges, some of them lost, classification and wakeups stay the same
+static void test_bounce(void)
+{
+    for(uint32_t idx=0; idx<3000; idx++) {
+        uint32_t pick = test_rand() % 20;
+        if(idx % 2) {
+            slot_clock_wrap_soon();
+        }
+        if(pick < 6) {
+            press_check(PRESS_SHORT, 30);
+        } else if(pick < 14) {
+            press_check(PRESS_CLICK, 30);
+        } else if(pick < 17) {
+            double_click_check(30);
+        } else if(pick < 19) {
+            press_check(PRESS_LONG, 30);
+        } else {
+            press_check(PRESS_TIMEOUT, 30);
+        }
+    }
+    TEST_CHECK(s_edges_lost > 0);
+}
+
+//a threshold crossed while the release bounces is never reported, nor released
+static void test_skipped_threshold(void)
+{
+    static const uint32_t cross[] = {40, 3000};
+
+    for(uint32_t idx=0; idx<2; idx++) {
+        uint32_t wakeups = s_debounce_wakeups;
+        uint32_t open = s_open;
+
+        pin_set(SUBLE_LEVEL_LOW, false);
+        irq_run();
+        //edges every 2ms from 4ms before the threshold to 4ms after it
+        run_until(s_now + (cross[idx] - 4)*MS);
+        for(uint32_t edge=0; edge<5; edge++) {
+            pin_set((edge % 2) ? SUBLE_LEVEL_LOW : SUBLE_LEVEL_HIGH, false);
+            irq_run();
+            run_until(s_now + 2*MS);
+        }
+        run_until(s_now + 700*MS);
+
+        TEST_CHECK_EQ(s_level, SUBLE_LEVEL_HIGH);
+        TEST_CHECK_EQ(s_debounce_wakeups - wakeups, idx + 2);
+        TEST_CHECK_EQ(s_open, open);
+    }
+    //the key is ready for the next press
+    press_check(PRESS_CLICK, 0);
+}
+
+//a glitch while the button is still held after the timeout is a new press, not a second reset
+static void test_timeout_glitch(void)
+{
+    uint32_t factory = s_factory;
+    uint32_t open = s_open;
+
+    pin_set(SUBLE_LEVEL_LOW, false);
+    irq_run();
+    run_until(s_now + 10500*MS);
+    TEST_CHECK_EQ(s_factory - factory, 1);
+    pin_set(SUBLE_LEVEL_HIGH, false);
+    irq_run();
+    run_until(s_now + 2*MS);
+    pin_set(SUBLE_LEVEL_LOW, false);
+    irq_run();
+    run_until(s_now + 5000*MS);
+    pin_set(SUBLE_LEVEL_HIGH, false);
+    irq_run();
+    run_until(s_now + 700*MS);
+
+    TEST_CHECK_EQ(s_factory - factory, 1);
+    TEST_CHECK_EQ(s_open, open);
+}
+
+int main(void)
+{
+    test_clean();
+    test_skipped_threshold();
+    test_timeout_glitch();
+    test_bounce();
+    return TEST_RESULT();
+}
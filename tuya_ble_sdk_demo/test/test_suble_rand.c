@@ -0,0 +1,172 @@
+#include "test_common.h"
+#include "suble_common.h"
+#include "aes.h"
+
+/*********************************************************
+ * chip stubs
+ */
+void suble_gap_get_bt_mac(uint8_t *pMac, uint32_t size)
+{
+    static const uint8_t mac[SUBLE_BT_MAC_LEN] = {0xDC, 0x23, 0x4D, 0x01, 0x02, 0x03};
+    memcpy(pMac, mac, SUBLE_BT_MAC_LEN);
+}
+
+uint16_t adc_get_value(void)
+{
+    return test_rand() & 0x3FF;
+}
+
+void lld_evt_time_get_us(uint32_t *slot, uint32_t *slot1)
+{
+    *slot = test_rand();
+    *slot1 = test_rand() % 625;
+}
+
+/*********************************************************
+ * SP800-90A CTR_DRBG, AES-128, no derivation function, written out step by step
+ */
+typedef struct {
+    uint8_t key[16];
+    uint8_t v[16];
+} ref_drbg_t;
+
+static void ref_block(ref_drbg_t* drbg, uint8_t* out)
+{
+    mbedtls_aes_context aes;
+
+    for(int idx=15; idx>=0; idx--) {
+        if(++drbg->v[idx] != 0) {
+            break;
+        }
+    }
+    mbedtls_aes_init(&aes);
+    mbedtls_aes_setkey_enc(&aes, drbg->key, 128);
+    mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, drbg->v, out);
+    mbedtls_aes_free(&aes);
+}
+
+static void ref_update(ref_drbg_t* drbg, const uint8_t* provided)
+{
+    uint8_t temp[32];
+
+    ref_block(drbg, &temp[0]);
+    ref_block(drbg, &temp[16]);
+    for(int idx=0; idx<32; idx++) {
+        temp[idx] ^= provided[idx];
+    }
+    memcpy(drbg->key, &temp[0], 16);
+    memcpy(drbg->v, &temp[16], 16);
+}
+
+static void ref_instantiate(ref_drbg_t* drbg, const uint8_t* seed)
+{
+    memset(drbg, 0, sizeof(ref_drbg_t));
+    ref_update(drbg, seed);
+}
+
+static void ref_generate(ref_drbg_t* drbg, uint8_t* out, uint32_t size)
+{
+    static const uint8_t zero[32] = {0};
+    uint8_t block[16];
+
+    while(size > 0) {
+        uint32_t n = (size > 16) ? 16 : size;
+        ref_block(drbg, block);
+        memcpy(out, block, n);
+        out += n;
+        size -= n;
+    }
+    ref_update(drbg, zero);
+}
+
+/*********************************************************
+ * tests
+ */
+static void fill_seed(uint8_t* seed, uint32_t len)
+{
+    for(uint32_t idx=0; idx<len; idx++) {
+        seed[idx] = test_rand();
+    }
+}
+
+//instantiate, generate and reseed follow the reference for every read size
+static void test_reference(void)
+{
+    ref_drbg_t ref;
+    uint8_t seed[32], expect[80], out[80];
+
+    fill_seed(seed, sizeof(seed));
+    suble_rand_instantiate(seed, sizeof(seed));
+    ref_instantiate(&ref, seed);
+
+    for(uint32_t size=1; size<=sizeof(out); size++) {
+        suble_rand_bytes(out, size);
+        ref_generate(&ref, expect, size);
+        TEST_CHECK(memcmp(out, expect, size) == 0);
+
+        if(size % 16 == 0) {
+            fill_seed(seed, sizeof(seed));
+            suble_rand_seed(seed, sizeof(seed));
+            ref_update(&ref, seed);
+        }
+    }
+}
+
+//the output depends on the seed only, not on what ran before
+static void test_instantiate_resets(void)
+{
+    uint8_t seed[32], noise[32], first[48], again[48];
+
+    fill_seed(seed, sizeof(seed));
+    suble_rand_instantiate(seed, sizeof(seed));
+    suble_rand_bytes(first, sizeof(first));
+
+    fill_seed(noise, sizeof(noise));
+    suble_rand_seed(noise, sizeof(noise));
+    suble_rand_bytes(again, sizeof(again));
+    TEST_CHECK(memcmp(first, again, sizeof(first)) != 0);
+
+    suble_rand_instantiate(seed, sizeof(seed));
+    suble_rand_bytes(again, sizeof(again));
+    TEST_CHECK(memcmp(first, again, sizeof(first)) == 0);
+
+    //suble_rand_init() restarts from the chip noise, not from the state above
+    suble_rand_init();
+    suble_rand_bytes(again, sizeof(again));
+    TEST_CHECK(memcmp(first, again, sizeof(first)) != 0);
+}
+
+//a short seed is zero padded, a long one is taken 32 bytes at a time
+static void test_seed_length(void)
+{
+    ref_drbg_t ref;
+    uint8_t seed[70], part[32], out[16], expect[16];
+
+    fill_seed(seed, sizeof(seed));
+
+    suble_rand_instantiate(seed, 5);
+    memset(part, 0, sizeof(part));
+    memcpy(part, seed, 5);
+    ref_instantiate(&ref, part);
+    suble_rand_bytes(out, sizeof(out));
+    ref_generate(&ref, expect, sizeof(expect));
+    TEST_CHECK(memcmp(out, expect, sizeof(out)) == 0);
+
+    suble_rand_instantiate(seed, sizeof(seed));
+    ref_instantiate(&ref, &seed[0]);
+    ref_update(&ref, &seed[32]);
+    memset(part, 0, sizeof(part));
+    memcpy(part, &seed[64], sizeof(seed) - 64);
+    ref_update(&ref, part);
+    suble_rand_bytes(out, sizeof(out));
+    ref_generate(&ref, expect, sizeof(expect));
+    TEST_CHECK(memcmp(out, expect, sizeof(out)) == 0);
+}
+
+int main(void)
+{
+    test_reference();
+    test_instantiate_resets();
+    test_seed_length();
+    return TEST_RESULT();
+}
@@ -0,0 +1,358 @@
+//scan report filter and dedup of suble_adv_scan.c, with the bound slaves of app_flash.c
+#include "test_common.h"
+#include "suble_common.h"
+#include "ea.h"
+#include "app_flash.h"
+
+#define WINDOW_SLOTS            320 //200ms
+
+/*********************************************************
+ * the stack, the slot clock is set by the test
+ */
+static uint32_t s_slot = 0;
+
+uint32_t ea_time_get_slot_rounded(void)
+{
+    return s_slot & MAX_SLOT_CLOCK;
+}
+
+uint8_t ke_state_get(uint16_t task) { return 0; }
+void appm_scan_adv_con_schedule(void) {}
+void appm_update_adv_data(uint8_t* adv_buff, uint8_t adv_len, uint8_t* scan_buff, uint8_t scan_len) {}
+
+/*********************************************************
+ * app_flash.c, the slave list is filled by the test
+ */
+static slave_info_t* s_slave_info = NULL;
+
+uint32_t app_port_nv_set(uint32_t area_id, uint16_t id, void *buf, uint8_t size) { return APP_PORT_SUCCESS; }
+uint32_t app_port_nv_get(uint32_t area_id, uint16_t id, void *buf, uint8_t size) { return APP_PORT_ERROR_COMMON; }
+uint32_t app_port_nv_del(uint32_t area_id, uint16_t id) { return APP_PORT_SUCCESS; }
+uint32_t app_port_nv_set_default(void) { return APP_PORT_SUCCESS; }
+tuya_ble_connect_status_t app_port_get_connect_status(void) { return BONDING_CONN; }
+uint32_t lock_hard_doorcard_delete(uint8_t hardid) { return 0; }
+uint32_t lock_hard_finger_delete(uint8_t hardid) { return 0; }
+uint32_t lock_hard_face_delete(uint8_t hardid) { return 0; }
+lock_dp_t g_cmd;
+
+tuya_ble_status_t tuya_ble_master_info_init(slave_info_t* info, uint8_t slave_max_num)
+{
+    s_slave_info = info;
+    return 0;
+}
+
+/*********************************************************
+ * what reaches the master logic
+ */
+static uint32_t s_forwarded = 0;
+
+static void scan_handler(uint32_t evt, uint8_t* buf, uint32_t size)
+{
+    TEST_CHECK_EQ(evt, SUBLE_SCAN_EVT_ADV_REPORT);
+    s_forwarded++;
+}
+
+//one report, true when it was forwarded
+static bool report(struct adv_report* adv)
+{
+    uint32_t forwarded = s_forwarded;
+    suble_scan_evt_handler(adv);
+    return (s_forwarded != forwarded);
+}
+
+static void report_init(struct adv_report* adv, uint8_t mac_id, const uint8_t* data, uint8_t len)
+{
+    memset(adv, 0, sizeof(*adv));
+    for(uint32_t idx=0; idx<SUBLE_BT_MAC_LEN; idx++) {
+        adv->adv_addr.addr[idx] = 0x10 * (idx + 1) + mac_id;
+    }
+    memcpy(adv->data, data, len);
+    adv->data_len = len;
+}
+
+/*********************************************************
+ * the filter, as the ad structures are defined, to check the random reports against
+ */
+static bool ref_is_tuya(const uint8_t* data, uint8_t data_len)
+{
+    uint32_t idx = 0;
+
+    while(idx + 2 <= data_len) {
+        uint32_t len = data[idx];
+        const uint8_t* value = &data[idx + 2];
+        if((len == 0) || (idx + 1 + len > data_len)) {
+            return false;
+        }
+        //the value is len - 1 bytes
+        if((data[idx + 1] == 0x02) || (data[idx + 1] == 0x03)) {
+            for(uint32_t pos=0; pos+2<=len-1; pos+=2) {
+                if((value[pos] == 0x01) && (value[pos + 1] == 0xA2)) {
+                    return true;
+                }
+            }
+        }
+        if((data[idx + 1] == 0x16) && (len - 1 >= 2) && (value[0] == 0x01) && (value[1] == 0xA2)) {
+            return true;
+        }
+        if((data[idx + 1] == 0xFF) && (len - 1 >= 2) && (value[0] == 0xD0) && (value[1] == 0x07)) {
+            return true;
+        }
+        idx += 1 + len;
+    }
+    return false;
+}
+
+/*********************************************************
+ * cases
+ */
+static const uint8_t s_flags[] = {0x02, 0x01, 0x06};
+static const uint8_t s_tuya_ad[][8] = {
+    {0x07, 0x03, 0x0F, 0x18, 0x01, 0xA2, 0x0A, 0x18}, //complete uuid list, second entry
+    {0x03, 0x02, 0x01, 0xA2},                         //incomplete uuid list
+    {0x05, 0x16, 0x01, 0xA2, 0x55, 0x66},             //service data
+    {0x04, 0xFF, 0xD0, 0x07, 0x01},                   //manufacturer data
+};
+
+//a tuya element is found whole, a cut one is not, whatever precedes it
+static void test_tuya_ad(void)
+{
+    struct adv_report adv;
+    uint8_t data[ADV_DATA_LEN];
+
+    suble_scan_start(scan_handler);
+    for(uint32_t idx=0; idx<sizeof(s_tuya_ad)/sizeof(s_tuya_ad[0]); idx++) {
+        uint8_t len = s_tuya_ad[idx][0] + 1;
+
+        memcpy(data, s_flags, sizeof(s_flags));
+        memcpy(&data[sizeof(s_flags)], s_tuya_ad[idx], len);
+        for(uint8_t cut=0; cut<=len; cut++) {
+            s_slot += 1600;
+            report_init(&adv, 1, data, sizeof(s_flags) + len - cut);
+            TEST_CHECK_EQ(report(&adv), (cut == 0));
+        }
+
+        //a zero length element ends the data
+        memcpy(data, s_flags, sizeof(s_flags));
+        data[sizeof(s_flags)] = 0x00;
+        memcpy(&data[sizeof(s_flags) + 1], s_tuya_ad[idx], len);
+        s_slot += 1600;
+        report_init(&adv, 1, data, sizeof(s_flags) + 1 + len);
+        TEST_CHECK(!report(&adv));
+
+        //an element running past the data hides the rest
+        memcpy(data, s_tuya_ad[idx], len);
+        data[len] = 0x1E;
+        data[len + 1] = 0x09;
+        s_slot += 1600;
+        report_init(&adv, 1, data, len + 2);
+        TEST_CHECK(report(&adv));
+        memcpy(&data[2], s_tuya_ad[idx], len);
+        data[0] = 0x1E;
+        data[1] = 0x09;
+        s_slot += 1600;
+        report_init(&adv, 1, data, len + 2);
+        TEST_CHECK(!report(&adv));
+    }
+
+    //the uuid in the wrong byte order, off the 2 byte grid, or a short service and company id
+    static const uint8_t other_ad[][7] = {
+        {0x03, 0x03, 0xA2, 0x01},
+        {0x04, 0x03, 0x0F, 0x01, 0xA2},
+        {0x06, 0x02, 0x0F, 0x01, 0xA2, 0x18, 0x0A},
+        {0x04, 0x03, 0x0F, 0x18, 0x01},
+        {0x02, 0x16, 0x01},
+        {0x02, 0xFF, 0xD0},
+        {0x03, 0xFF, 0x07, 0xD0},
+    };
+    for(uint32_t idx=0; idx<sizeof(other_ad)/sizeof(other_ad[0]); idx++) {
+        s_slot += 1600;
+        report_init(&adv, 1, other_ad[idx], other_ad[idx][0] + 1);
+        TEST_CHECK(!report(&adv));
+    }
+    s_slot += 1600;
+    report_init(&adv, 1, NULL, 0);
+    TEST_CHECK(!report(&adv));
+
+    //the bytes after an element are not part of it
+    static const uint8_t split_ad[][6] = {
+        {0x04, 0x03, 0x0F, 0x18, 0x01, 0xA2},
+        {0x02, 0x16, 0x01, 0xA2},
+        {0x02, 0xFF, 0xD0, 0x07},
+    };
+    for(uint32_t idx=0; idx<sizeof(split_ad)/sizeof(split_ad[0]); idx++) {
+        s_slot += 1600;
+        report_init(&adv, 1, split_ad[idx], split_ad[idx][0] + 2);
+        TEST_CHECK(!report(&adv));
+    }
+}
+
+//random reports of tuya elements, other elements and junk
+static void test_tuya_ad_random(void)
+{
+    struct adv_report adv;
+    uint8_t data[ADV_DATA_LEN];
+    uint32_t tuya = 0;
+
+    suble_scan_start(scan_handler);
+    for(uint32_t round=0; round<200000; round++) {
+        uint8_t len = 0;
+        while(len < ADV_DATA_LEN) {
+            uint32_t pick = test_rand() % 8;
+            uint8_t el_len;
+            if(pick < 2) {
+                const uint8_t* el = s_tuya_ad[test_rand() % 4];
+                el_len = el[0] + 1;
+                if(len + el_len > ADV_DATA_LEN) {
+                    el_len = ADV_DATA_LEN - len;
+                }
+                memcpy(&data[len], el, el_len);
+                //the uuid or company id bytes changed
+                if((test_rand() % 4 == 0) && (el_len > 2)) {
+                    data[len + 2 + test_rand() % (el_len - 2)] ^= 1 << (test_rand() % 8);
+                }
+            } else if(pick < 6) {
+                el_len = 1 + test_rand() % 8;
+                if(len + el_len > ADV_DATA_LEN) {
+                    el_len = ADV_DATA_LEN - len;
+                }
+                data[len] = el_len - 1;
+                for(uint8_t pos=1; pos<el_len; pos++) {
+                    data[len + pos] = (pos == 1) ? (uint8_t[]){0x01, 0x02, 0x03, 0x09, 0x16, 0xFF}[test_rand() % 6] : test_rand();
+                }
+            } else {
+                el_len = 1;
+                data[len] = test_rand() % 40;
+            }
+            len += el_len;
+        }
+        len = test_rand() % (ADV_DATA_LEN + 1);
+
+        s_slot += 1600;
+        report_init(&adv, 1, data, len);
+        bool expect = ref_is_tuya(data, len);
+        TEST_CHECK_EQ(report(&adv), expect);
+        tuya += expect;
+    }
+    TEST_CHECK((tuya > 20000) && (tuya < 180000));
+}
+
+//a foreign report passes from a bound slave, the master logic may keep the mac reversed
+static void test_bound_mac(void)
+{
+    static const uint8_t other_ad[] = {0x05, 0x09, 'L', 'o', 'c', 'k'};
+    struct adv_report adv;
+
+    lock_flash_init();
+    TEST_CHECK(s_slave_info != NULL);
+    suble_scan_start(scan_handler);
+
+    //no slave, the free slots are all zero
+    report_init(&adv, 2, other_ad, sizeof(other_ad));
+    TEST_CHECK(!report(&adv));
+    memset(adv.adv_addr.addr, 0, SUBLE_BT_MAC_LEN);
+    TEST_CHECK(!report(&adv));
+
+    //in air order
+    report_init(&adv, 2, other_ad, sizeof(other_ad));
+    memcpy(s_slave_info[3].mac, adv.adv_addr.addr, SUBLE_BT_MAC_LEN);
+    TEST_CHECK(report(&adv));
+    memset(s_slave_info[3].mac, 0, SUBLE_BT_MAC_LEN);
+    s_slot += 1600;
+    TEST_CHECK(!report(&adv));
+
+    //reversed, in the last slot
+    for(uint32_t idx=0; idx<SUBLE_BT_MAC_LEN; idx++) {
+        s_slave_info[9].mac[idx] = adv.adv_addr.addr[SUBLE_BT_MAC_LEN - 1 - idx];
+    }
+    TEST_CHECK(report(&adv));
+
+    //half of it reversed is another mac
+    s_slot += 1600;
+    s_slave_info[9].mac[0] ^= 0xFF;
+    TEST_CHECK(!report(&adv));
+    memset(s_slave_info[9].mac, 0, SUBLE_BT_MAC_LEN);
+}
+
+//the same report is forwarded once per 200ms, across the slot clock wrap too
+static void test_dedup_window(void)
+{
+    static const uint8_t tuya_ad[] = {0x05, 0x16, 0x01, 0xA2, 0x55, 0x66};
+    struct adv_report adv;
+    uint32_t start;
+
+    for(uint32_t wrap=0; wrap<2; wrap++) {
+        s_slot = wrap ? (MAX_SLOT_CLOCK - 100) : 5000;
+        start = s_slot;
+        suble_scan_start(scan_handler);
+        report_init(&adv, 3, tuya_ad, sizeof(tuya_ad));
+        TEST_CHECK(report(&adv));
+        s_slot = start + WINDOW_SLOTS - 1;
+        TEST_CHECK(!report(&adv));
+        s_slot = start + WINDOW_SLOTS;
+        TEST_CHECK(report(&adv));
+        //the window starts at the forwarded one
+        s_slot = start + 2*WINDOW_SLOTS - 1;
+        TEST_CHECK(!report(&adv));
+        s_slot = start + 2*WINDOW_SLOTS;
+        TEST_CHECK(report(&adv));
+
+        //every 10ms for 2s
+        uint32_t forwarded = s_forwarded;
+        for(uint32_t idx=1; idx<=200; idx++) {
+            s_slot = start + 2*WINDOW_SLOTS + idx*16;
+            report(&adv);
+        }
+        TEST_CHECK_EQ(s_forwarded - forwarded, 10);
+
+        //another event type, other data of the same length or another mac are not repeats
+        s_slot += 1;
+        adv.evt_type = 4;
+        TEST_CHECK(report(&adv));
+        adv.evt_type = 0;
+        adv.data[5] ^= 1;
+        TEST_CHECK(report(&adv));
+        adv.data[5] ^= 1;
+        adv.adv_addr.addr[0] ^= 1;
+        TEST_CHECK(report(&adv));
+        adv.adv_addr.addr[0] ^= 1;
+        TEST_CHECK(!report(&adv));
+
+        //a new scan forgets
+        suble_scan_start(scan_handler);
+        TEST_CHECK(report(&adv));
+    }
+}
+
+//8 reports are kept, the oldest one is replaced
+static void test_dedup_evict(void)
+{
+    static const uint8_t tuya_ad[] = {0x04, 0xFF, 0xD0, 0x07, 0x01};
+    struct adv_report adv;
+
+    s_slot = 100000;
+    suble_scan_start(scan_handler);
+    for(uint8_t mac_id=0; mac_id<8; mac_id++) {
+        report_init(&adv, mac_id, tuya_ad, sizeof(tuya_ad));
+        TEST_CHECK(report(&adv));
+    }
+    for(uint8_t mac_id=0; mac_id<8; mac_id++) {
+        report_init(&adv, mac_id, tuya_ad, sizeof(tuya_ad));
+        TEST_CHECK(!report(&adv));
+    }
+    report_init(&adv, 8, tuya_ad, sizeof(tuya_ad));
+    TEST_CHECK(report(&adv));
+    report_init(&adv, 0, tuya_ad, sizeof(tuya_ad));
+    TEST_CHECK(report(&adv));
+    report_init(&adv, 2, tuya_ad, sizeof(tuya_ad));
+    TEST_CHECK(!report(&adv));
+}
+
+int main(void)
+{
+    test_tuya_ad();
+    test_tuya_ad_random();
+    test_bound_mac();
+    test_dedup_window();
+    test_dedup_evict();
+    return TEST_RESULT();
+}
@@ -0,0 +1,365 @@
+#include "test_common.h"
+#include "suble_common.h"
+#include "tuya_ble_gatt_send_queue.h"
+
+#define CONIDX                  0
+#define CACHE_MAX_NUM           10
+#define SLAVE_NUM               14
+
+/*********************************************************
+ * simulated slaves, each one a gatt server with its own handles
+ */
+typedef struct {
+    uint8_t  mac[SUBLE_BT_MAC_LEN];
+    uint8_t  addr_type;
+    uint16_t shdl;
+    uint16_t ehdl;
+    uint16_t write_hdl;
+    uint16_t notif_hdl;
+} slave_t;
+
+static slave_t s_slave[SLAVE_NUM];
+
+static void slave_init(void)
+{
+    for(uint32_t idx=0; idx<SLAVE_NUM; idx++) {
+        memset(&s_slave[idx], 0, sizeof(slave_t));
+        s_slave[idx].mac[0] = 0xC0;
+        s_slave[idx].mac[5] = idx + 1;
+        s_slave[idx].shdl = 0x20;
+        s_slave[idx].ehdl = 0x30;
+        s_slave[idx].write_hdl = 0x22;
+        s_slave[idx].notif_hdl = 0x25;
+    }
+}
+
+/*********************************************************
+ * simulated central, the link and what the stack did on it
+ */
+static struct appc_env_tag s_env;
+struct appc_env_tag *appc_env[APPC_IDX_MAX] = {&s_env};
+conn_info_t g_conn_info[2];
+
+static slave_t* s_peer = NULL;
+static struct sdp_svc_cache s_profile; //the profile added on the link
+static uint32_t s_discoveries = 0;
+static uint32_t s_disconnects = 0;
+static uint32_t s_completes = 0;
+static bool     s_write_pending = false;
+static uint16_t s_write_handle = 0;
+
+//a discovery finds what the slave has
+uint8_t sdp_export_svc_info(uint8_t conidx, struct sdp_svc_cache *cache)
+{
+    TEST_CHECK_EQ(conidx, CONIDX);
+    *cache = s_profile;
+    return GAP_ERR_NO_ERROR;
+}
+
+uint8_t sdp_restore_svc_info(uint8_t conidx, struct sdp_svc_cache const *cache)
+{
+    TEST_CHECK_EQ(conidx, CONIDX);
+    s_profile = *cache;
+    return GAP_ERR_NO_ERROR;
+}
+
+uint8_t appc_write_service_ntf_cfg_req(uint8_t conidx, uint16_t handle, uint16_t ntf_cfg)
+{
+    TEST_CHECK(!s_write_pending);
+    TEST_CHECK_EQ(handle, s_env.svc_notif_handle);
+    s_write_pending = true;
+    s_write_handle = handle;
+    return GAP_ERR_NO_ERROR;
+}
+
+uint8_t appc_write_service_data_req(uint8_t conidx, uint16_t handle, uint16_t data_len, uint8_t *data)
+{
+    TEST_CHECK(!s_write_pending);
+    s_write_pending = true;
+    s_write_handle = handle;
+    return GAP_ERR_NO_ERROR;
+}
+
+void appm_disconnect(uint8_t conidx)
+{
+    s_disconnects++;
+}
+
+static void result_handler(uint32_t evt, uint8_t* buf, uint32_t size)
+{
+    if(evt == SUBLE_SVC_C_EVT_DISCOVERY_COMPLETE) {
+        s_completes++;
+    }
+}
+
+//the gattc_cmp_evt of a write, as appc_task.c handles it
+static void write_complete(uint8_t status)
+{
+    TEST_CHECK(s_write_pending);
+    s_write_pending = false;
+    if(suble_svc_c_cache_check(CONIDX, status) == SUBLE_SUCCESS) {
+        suble_svc_c_discovery_complete();
+    }
+}
+
+//the server answers a write to a handle it does not have with an error
+static void server_answer(void)
+{
+    bool known = (s_write_handle == s_peer->notif_hdl) || (s_write_handle == s_peer->write_hdl);
+    write_complete(known ? ATT_ERR_NO_ERROR : ATT_ERR_INVALID_HANDLE);
+}
+
+//appc_check_device_link_timer_handler and then GATTC_REGISTER
+static void connect(slave_t* slave)
+{
+    s_peer = slave;
+    memset(&s_env, 0, sizeof(s_env));
+    s_env.role = ROLE_MASTER;
+    memcpy(s_env.con_dev_addr.addr.addr, slave->mac, SUBLE_BT_MAC_LEN);
+    s_env.con_dev_addr.addr_type = slave->addr_type;
+
+    if(suble_svc_c_cache_restore(CONIDX) != SUBLE_SUCCESS) {
+        s_discoveries++;
+        s_profile.shdl = slave->shdl;
+        s_profile.ehdl = slave->ehdl;
+        s_profile.write_hdl = slave->write_hdl;
+        s_profile.notif_hdl = slave->notif_hdl;
+    }
+    s_env.svc_write_handle = s_profile.write_hdl;
+    s_env.svc_notif_handle = s_profile.notif_hdl;
+    suble_svc_c_ntf_cfg_enable(CONIDX);
+}
+
+/*********************************************************
+ * flash, every write adds a record
+ */
+typedef struct {
+    bool    valid;
+    uint8_t data[64];
+} nv_t;
+
+static nv_t s_nv[CACHE_MAX_NUM];
+static uint32_t s_nv_writes = 0;
+static uint32_t s_nv_deletes = 0;
+
+uint32_t sf_nv_write(uint32_t area_id, uint16_t id, void *buf, uint8_t size)
+{
+    TEST_CHECK_EQ(area_id, SUBLE_SVC_C_CACHE_NV_AREA);
+    TEST_CHECK((id >= SUBLE_SVC_C_CACHE_NV_ID) && (id < SUBLE_SVC_C_CACHE_NV_ID + CACHE_MAX_NUM));
+    TEST_CHECK(size <= sizeof(s_nv[0].data));
+    s_nv[id - SUBLE_SVC_C_CACHE_NV_ID].valid = true;
+    memcpy(s_nv[id - SUBLE_SVC_C_CACHE_NV_ID].data, buf, size);
+    s_nv_writes++;
+    return SF_SUCCESS;
+}
+
+uint32_t sf_nv_read(uint32_t area_id, uint16_t id, void *buf, uint8_t size)
+{
+    if(!s_nv[id - SUBLE_SVC_C_CACHE_NV_ID].valid) {
+        return 1;
+    }
+    memcpy(buf, s_nv[id - SUBLE_SVC_C_CACHE_NV_ID].data, size);
+    return SF_SUCCESS;
+}
+
+uint32_t sf_nv_delete(uint32_t area_id, uint16_t id)
+{
+    s_nv[id - SUBLE_SVC_C_CACHE_NV_ID].valid = false;
+    s_nv_deletes++;
+    return SF_SUCCESS;
+}
+
+//slot of a slave in the flash, CACHE_MAX_NUM if it has none
+static uint32_t nv_slot(slave_t* slave)
+{
+    for(uint32_t slot=0; slot<CACHE_MAX_NUM; slot++) {
+        //| version | addr_type | mac |
+        if(s_nv[slot].valid && (memcmp(&s_nv[slot].data[2], slave->mac, SUBLE_BT_MAC_LEN) == 0)) {
+            return slot;
+        }
+    }
+    return CACHE_MAX_NUM;
+}
+
+/*********************************************************
+ * the rest of the firmware
+ */
+uint16_t suble_util_crc16(uint8_t* buf, uint32_t size, uint16_t* p_crc)
+{
+    uint16_t crc = 0xFFFF;
+    while(size--) {
+        crc ^= *buf++;
+        for(uint32_t bit=0; bit<8; bit++) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xA001 : 0);
+        }
+    }
+    return crc;
+}
+
+void suble_gap_link_traffic(void) {}
+void app_fff1_send_lvl(uint8_t* buf, uint8_t len) {}
+void tuya_ble_gatt_send_tx_complete(void) {}
+tuya_ble_status_t tuya_ble_gatt_receive_data(uint8_t* p_data, uint16_t len) { return TUYA_BLE_SUCCESS; }
+
+/*********************************************************
+ * cases
+ */
+//see svc_c_cache_t
+typedef struct {
+    uint8_t version;
+    uint8_t addr_type;
+    uint8_t mac[SUBLE_BT_MAC_LEN];
+    struct sdp_svc_cache svc;
+    uint16_t crc;
+} cache_record_t;
+
+//a record left by the last boot
+static void nv_record_put(uint32_t slot, slave_t* slave)
+{
+    cache_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.version = 0x02;
+    record.addr_type = slave->addr_type;
+    memcpy(record.mac, slave->mac, SUBLE_BT_MAC_LEN);
+    record.svc.shdl = slave->shdl;
+    record.svc.ehdl = slave->ehdl;
+    record.svc.write_hdl = slave->write_hdl;
+    record.svc.notif_hdl = slave->notif_hdl;
+    record.crc = suble_util_crc16((void*)&record, offsetof(cache_record_t, crc), NULL);
+    s_nv[slot].valid = true;
+    memcpy(s_nv[slot].data, &record, sizeof(record));
+}
+
+//after a reboot a new slave takes a free slot, the old ones are kept
+static void test_new_slot(void)
+{
+    nv_record_put(0, &s_slave[0]);
+    nv_record_put(1, &s_slave[1]);
+    nv_record_put(2, &s_slave[2]);
+    nv_record_put(4, &s_slave[4]);
+
+    connect(&s_slave[0]);
+    server_answer();
+    TEST_CHECK_EQ(s_discoveries, 0);
+    TEST_CHECK_EQ(s_nv_writes, 0);
+
+    connect(&s_slave[5]);
+    server_answer();
+    TEST_CHECK_EQ(nv_slot(&s_slave[5]), 3);
+    connect(&s_slave[6]);
+    server_answer();
+    TEST_CHECK_EQ(nv_slot(&s_slave[6]), 5);
+    TEST_CHECK_EQ(s_discoveries, 2);
+
+    static const uint8_t kept[] = {0, 1, 2, 4};
+    for(uint32_t idx=0; idx<sizeof(kept); idx++) {
+        TEST_CHECK_EQ(nv_slot(&s_slave[kept[idx]]), kept[idx]);
+    }
+}
+
+static void test_wear(void)
+{
+    uint8_t data[4] = {0};
+    uint32_t writes = s_nv_writes;
+    uint32_t discoveries = s_discoveries;
+    uint32_t completes = s_completes;
+
+    //the layout is saved once, after the ntf cfg write
+    connect(&s_slave[3]);
+    TEST_CHECK_EQ(s_nv_writes, writes);
+    server_answer();
+    TEST_CHECK_EQ(s_nv_writes, writes + 1);
+    TEST_CHECK_EQ(s_discoveries, discoveries + 1);
+    TEST_CHECK_EQ(s_completes, completes + 1);
+
+    //data writes leave the flash alone, failed or not
+    for(uint32_t idx=0; idx<20; idx++) {
+        suble_svc_c_send_data(CONIDX, data, sizeof(data));
+        write_complete((idx % 5 == 4) ? ATT_ERR_INVALID_HANDLE : ATT_ERR_NO_ERROR);
+    }
+    TEST_CHECK_EQ(s_nv_writes, writes + 1);
+    TEST_CHECK_EQ(s_nv_deletes, 0);
+    TEST_CHECK_EQ(s_disconnects, 0);
+
+    //the next link needs no discovery and no flash write
+    completes = s_completes;
+    connect(&s_slave[3]);
+    server_answer();
+    TEST_CHECK_EQ(s_discoveries, discoveries + 1);
+    TEST_CHECK_EQ(s_nv_writes, writes + 1);
+    TEST_CHECK_EQ(s_completes, completes + 1);
+
+    //a failed data write on a cached link keeps the cache and the link
+    suble_svc_c_send_data(CONIDX, data, sizeof(data));
+    write_complete(ATT_ERR_INVALID_HANDLE);
+    TEST_CHECK_EQ(s_nv_deletes, 0);
+    TEST_CHECK_EQ(s_disconnects, 0);
+    TEST_CHECK(nv_slot(&s_slave[3]) < CACHE_MAX_NUM);
+}
+
+//the slave got a firmware with other handles
+static void test_stale(void)
+{
+    uint32_t discoveries = s_discoveries;
+    uint32_t completes = s_completes;
+
+    s_slave[3].notif_hdl = 0x27;
+    connect(&s_slave[3]);
+    TEST_CHECK_EQ(s_discoveries, discoveries);
+    server_answer();
+    TEST_CHECK_EQ(s_completes, completes);
+    TEST_CHECK_EQ(s_disconnects, 1);
+    TEST_CHECK_EQ(nv_slot(&s_slave[3]), CACHE_MAX_NUM);
+
+    //the next link discovers again and saves the new layout
+    connect(&s_slave[3]);
+    TEST_CHECK_EQ(s_discoveries, discoveries + 1);
+    server_answer();
+    TEST_CHECK_EQ(s_completes, completes + 1);
+    TEST_CHECK(nv_slot(&s_slave[3]) < CACHE_MAX_NUM);
+    connect(&s_slave[3]);
+    server_answer();
+    TEST_CHECK_EQ(s_discoveries, discoveries + 1);
+    TEST_CHECK_EQ(s_disconnects, 1);
+
+    //a random address used by another device again
+    s_slave[3].addr_type = 1;
+    connect(&s_slave[3]);
+    TEST_CHECK_EQ(s_discoveries, discoveries + 2);
+    server_answer();
+    s_slave[3].addr_type = 0;
+}
+
+//with every slot used, a new slave replaces one and every other slave keeps its layout
+static void test_evict(void)
+{
+    uint32_t cached = 0;
+
+    for(uint32_t idx=0; idx<SLAVE_NUM; idx++) {
+        connect(&s_slave[idx]);
+        server_answer();
+    }
+    for(uint32_t idx=0; idx<SLAVE_NUM; idx++) {
+        if(nv_slot(&s_slave[idx]) < CACHE_MAX_NUM) {
+            cached++;
+        }
+    }
+    TEST_CHECK_EQ(cached, CACHE_MAX_NUM);
+    //the last ones connected are cached
+    for(uint32_t idx=SLAVE_NUM-4; idx<SLAVE_NUM; idx++) {
+        TEST_CHECK(nv_slot(&s_slave[idx]) < CACHE_MAX_NUM);
+    }
+}
+
+int main(void)
+{
+    slave_init();
+    suble_db_discovery_start(result_handler);
+
+    test_new_slot();
+    test_wear();
+    test_stale();
+    test_evict();
+    TEST_CHECK(!s_write_pending);
+    return TEST_RESULT();
+}
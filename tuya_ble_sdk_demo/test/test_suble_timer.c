@@ -0,0 +1,363 @@
+#include "test_common.h"
+#include "suble_common.h"
+#include "tuya_ble_mem.h"
+
+#define SLOT_CLOCK_MASK         0x07FFFFFF
+#define SLOTS_PER_SECOND        1600
+#define SLOTS_PER_TICK          16
+//the watchdog of rw_app_enter, 0x7FFF*250us
+#define WDT_PERIOD_SLOTS        (8191750/625)
+
+/*********************************************************
+ * chip stubs, the slot clock and the kernel timer run on virtual time
+ */
+static uint64_t s_now;                  //slots since the start of the test
+static uint32_t s_slot_base;            //slot clock at s_now 0
+static bool     s_ke_armed;
+static uint64_t s_rtc_start;            //s_now when the rtc was started
+static uint64_t s_ke_due;
+
+uint32_t lld_evt_time_get(void)
+{
+    return (uint32_t)(s_slot_base + s_now) & SLOT_CLOCK_MASK;
+}
+
+void ke_timer_set(uint16_t timer_id, uint16_t task, uint32_t delay)
+{
+    //the wheel never arms the kernel timer further than 1h
+    TEST_CHECK(delay <= 100*3600);
+    if(delay == 0) {
+        delay = 1;
+    }
+    s_ke_armed = true;
+    s_ke_due = s_now + (uint64_t)delay*SLOTS_PER_TICK;
+}
+
+void ke_timer_clear(uint16_t timer_id, uint16_t task)
+{
+    s_ke_armed = false;
+}
+
+void *tuya_ble_malloc(uint16_t size)
+{
+    return malloc(size);
+}
+
+tuya_ble_status_t tuya_ble_free(uint8_t *ptr)
+{
+    free(ptr);
+    return TUYA_BLE_SUCCESS;
+}
+
+void Delay_ms(int num)
+{
+}
+
+void Delay_us(int num)
+{
+}
+
+/*********************************************************
+ * rw_app_enter: run the kernel timer when due, feed the watchdog on every
+ * pass and sleep until the next kernel timer, the app queues are always empty
+ */
+typedef struct {
+    uint64_t last_feed;
+    uint64_t max_gap;
+    uint32_t wakeups;
+} duty_t;
+
+static void duty_reset(duty_t* duty)
+{
+    duty->last_feed = s_now;
+    duty->max_gap = 0;
+    duty->wakeups = 0;
+}
+
+static void duty_feed(duty_t* duty)
+{
+    if(s_now - duty->last_feed > duty->max_gap) {
+        duty->max_gap = s_now - duty->last_feed;
+    }
+    duty->last_feed = s_now;
+}
+
+static void run_main_loop(duty_t* duty, uint64_t slots)
+{
+    uint64_t end = s_now + slots;
+
+    while(s_now < end) {
+        if(s_ke_armed && (s_ke_due <= s_now)) {
+            s_ke_armed = false;
+            suble_timer_handler();
+        }
+        duty_feed(duty);
+        duty->wakeups++;
+        s_now = (s_ke_armed && (s_ke_due < end)) ? s_ke_due : end;
+    }
+    //the watchdog keeps counting through the rest of the sleep
+    duty_feed(duty);
+}
+
+/*********************************************************
+ * app timers of the duty cycle
+ */
+static uint32_t s_hourly_count = 0;
+static uint32_t s_burst_count = 0;
+
+static void hourly_handler(void* timer)
+{
+    s_hourly_count++;
+}
+
+static void burst_handler(void* timer)
+{
+    s_burst_count++;
+}
+
+/*********************************************************
+ * cascade and wrap, every expiry is checked against the time of its start
+ */
+#define REF_TIMER_NUM           32
+#define WHEEL_SPAN_TICKS        (1UL<<20)
+
+typedef struct {
+    suble_timer_t timer;        //first, the handler gets the timer
+    uint64_t start;
+    uint32_t ticks;
+    uint32_t count;             //expiries left
+    uint32_t fired;
+} ref_timer_t;
+
+static ref_timer_t s_ref[REF_TIMER_NUM];
+static uint32_t s_ref_expiries = 0;
+
+//the ideal time of the next expiry, the kernel timer runs on whole ticks
+static uint64_t ref_next_due(ref_timer_t* ref)
+{
+    return ref->start + (uint64_t)(ref->fired + 1)*ref->ticks*SLOTS_PER_TICK;
+}
+
+static void ref_handler(void* timer)
+{
+    ref_timer_t* ref = timer;
+    uint64_t due = ref_next_due(ref);
+
+    TEST_CHECK(ref->count > 0);
+    //not before the tick of the deadline, not after the next one
+    TEST_CHECK(s_now + SLOTS_PER_TICK > due);
+    TEST_CHECK(s_now < due + SLOTS_PER_TICK);
+    if(ref->count != SUBLE_TIMER_COUNT_ENDLESS) {
+        ref->count--;
+    }
+    ref->fired++;
+    s_ref_expiries++;
+    TEST_CHECK_EQ(suble_timer_is_running(&ref->timer), ref->count > 0);
+}
+
+static void ref_start(ref_timer_t* ref, uint32_t ms, uint32_t count)
+{
+    ref->timer.handler = ref_handler;
+    ref->start = s_now;
+    ref->ticks = (ms + 9)/10;
+    ref->count = count;
+    ref->fired = 0;
+    suble_timer_start_0(&ref->timer, ms, count);
+}
+
+static void ref_stop(ref_timer_t* ref)
+{
+    suble_timer_stop_0(&ref->timer);
+    ref->count = 0;
+}
+
+//no running timer missed its expiry
+static void ref_check_due(void)
+{
+    for(uint32_t idx=0; idx<REF_TIMER_NUM; idx++) {
+        if(s_ref[idx].count > 0) {
+            TEST_CHECK(ref_next_due(&s_ref[idx]) + 2*SLOTS_PER_TICK > s_now);
+        }
+    }
+}
+
+static void test_wheel_levels(void)
+{
+    //one tick around the span of each level and of the whole wheel
+    static const uint32_t ticks[] = {
+        1, 31, 32, 33, 1023, 1024, 1025, 32767, 32768, 32769,
+        WHEEL_SPAN_TICKS-1, WHEEL_SPAN_TICKS, WHEEL_SPAN_TICKS+1, WHEEL_SPAN_TICKS*2+7,
+    };
+    uint32_t num = sizeof(ticks)/sizeof(ticks[0]);
+    duty_t duty;
+
+    duty_reset(&duty);
+    //from several phases of the wheel position
+    for(uint32_t round=0; round<4; round++) {
+        run_main_loop(&duty, (uint64_t)test_rand()%(40*SLOTS_PER_SECOND));
+        s_ref_expiries = 0;
+        for(uint32_t idx=0; idx<num; idx++) {
+            ref_start(&s_ref[idx], ticks[idx]*10, 1);
+        }
+        duty_reset(&duty);
+        run_main_loop(&duty, (uint64_t)(WHEEL_SPAN_TICKS*2+8)*SLOTS_PER_TICK);
+        TEST_CHECK_EQ(s_ref_expiries, num);
+        ref_check_due();
+    }
+}
+
+static void test_wheel_random(void)
+{
+    duty_t duty;
+
+    s_ref_expiries = 0;
+    duty_reset(&duty);
+    //about 50 days, the slot clock wraps every 23.3h
+    for(uint32_t op=0; op<5000; op++) {
+        ref_timer_t* ref = &s_ref[test_rand() % REF_TIMER_NUM];
+        uint32_t ms;
+        uint32_t count;
+
+        switch(test_rand() % 4) {
+            case 0:  ms = 10 + test_rand() % 1000; break;
+            case 1:  ms = 1000 + test_rand() % 60000; break;
+            case 2:  ms = 60000 + test_rand() % 1800000; break;
+            default: ms = 3600000 + test_rand() % (4*3600000); break;
+        }
+        switch(test_rand() % 3) {
+            case 0:  count = 1; break;
+            case 1:  count = 3; break;
+            //no endless 10ms timers running for hours
+            default: count = (ms < 1000) ? 2 : SUBLE_TIMER_COUNT_ENDLESS; break;
+        }
+        if(test_rand() % 4 == 0) {
+            ref_stop(ref);
+        }
+        else {
+            ref_start(ref, ms, count);
+        }
+
+        switch(test_rand() % 4) {
+            case 0:  run_main_loop(&duty, test_rand() % (SLOTS_PER_SECOND/10)); break;
+            case 1:  run_main_loop(&duty, test_rand() % (10*SLOTS_PER_SECOND)); break;
+            case 2:  run_main_loop(&duty, test_rand() % (600*SLOTS_PER_SECOND)); break;
+            default: run_main_loop(&duty, (uint64_t)test_rand() % (7200ULL*SLOTS_PER_SECOND)); break;
+        }
+        ref_check_due();
+    }
+    TEST_CHECK(s_now > 40ULL*(SLOT_CLOCK_MASK+1));
+    TEST_CHECK(s_ref_expiries > 5000);
+
+    //nothing runs once all are stopped, the kernel timer is released
+    for(uint32_t idx=0; idx<REF_TIMER_NUM; idx++) {
+        ref_stop(&s_ref[idx]);
+    }
+    TEST_CHECK(!s_ke_armed);
+    run_main_loop(&duty, 6*3600ULL*SLOTS_PER_SECOND);
+}
+
+static void test_wdt_wake(void)
+{
+    duty_t duty;
+    void* hourly = NULL;
+    suble_timer_t burst = SUBLE_TIMER_DEF(burst_handler);
+    s_rtc_start = s_now;
+
+    //the rtc refresh alone lets the cpu sleep for 6h, the watchdog bites
+    suble_local_timer_start();
+    duty_reset(&duty);
+    run_main_loop(&duty, 3600ULL*SLOTS_PER_SECOND);
+    TEST_CHECK(duty.max_gap > WDT_PERIOD_SLOTS);
+
+    suble_wdt_wake_start();
+    TEST_CHECK_EQ(suble_timer_create(&hourly, 3600*1000, SUBLE_TIMER_REPEATED, hourly_handler), SUBLE_SUCCESS);
+    TEST_CHECK_EQ(suble_timer_start(hourly), SUBLE_SUCCESS);
+
+    //one minute of traffic, then idle for a day
+    duty_reset(&duty);
+    suble_timer_start_0(&burst, 100, SUBLE_TIMER_COUNT_ENDLESS);
+    run_main_loop(&duty, 60ULL*SLOTS_PER_SECOND + SLOTS_PER_TICK/2);
+    suble_timer_stop_0(&burst);
+    TEST_CHECK(duty.max_gap < WDT_PERIOD_SLOTS);
+    TEST_CHECK_EQ(s_burst_count, 600);
+
+    for(uint32_t hour=0; hour<24; hour++) {
+        duty_reset(&duty);
+        run_main_loop(&duty, 3600ULL*SLOTS_PER_SECOND);
+        //4s apart, the hourly timer and the rtc refresh may add a wake up
+        TEST_CHECK(duty.max_gap <= 4ULL*SLOTS_PER_SECOND);
+        TEST_CHECK(duty.max_gap < WDT_PERIOD_SLOTS);
+        TEST_CHECK((duty.wakeups >= 3600/4) && (duty.wakeups <= 3600/4 + 3));
+    }
+    TEST_CHECK_EQ(s_hourly_count, 24);
+    //the rtc counted through the wrap of the slot clock
+    TEST_CHECK_EQ(suble_get_local_timestamp(), (uint32_t)((s_now - s_rtc_start)/SLOTS_PER_SECOND));
+
+    TEST_CHECK_EQ(suble_timer_delete(hourly), SUBLE_SUCCESS);
+}
+
+//the timestamp and its milliseconds against the slots since the rtc start
+static void test_rtc(void)
+{
+    duty_t duty;
+    const uint32_t app_timestamp = 1700000000;
+    uint32_t local_when_update;
+    uint32_t old_local = 0;
+    uint32_t old_expect = 0;
+    uint64_t last = 0;
+    uint16_t ms;
+
+    duty_reset(&duty);
+    local_when_update = suble_get_local_timestamp();
+    suble_update_timestamp(app_timestamp);
+    TEST_CHECK_EQ(suble_get_app_timestamp_when_update(), app_timestamp);
+
+    for(uint32_t step=0; step<50000; step++) {
+        switch(test_rand() % 64) {
+            //long enough for the slot clock to wrap a few times
+            case 0:  run_main_loop(&duty, (uint64_t)test_rand() % (6*3600ULL*SLOTS_PER_SECOND)); break;
+            case 1:  run_main_loop(&duty, test_rand() % (60*SLOTS_PER_SECOND)); break;
+            //the next read comes before any timer, a whole second may be pending
+            case 2:
+            case 3:  s_now += test_rand() % (3*SLOTS_PER_SECOND); break;
+            default: s_now += test_rand() % SLOTS_PER_SECOND; break;
+        }
+
+        uint64_t slots = s_now - s_rtc_start;
+        uint32_t seconds = (uint32_t)(slots / SLOTS_PER_SECOND);
+        uint32_t timestamp = app_timestamp + (seconds - local_when_update);
+
+        if(step & 1) {
+            TEST_CHECK_EQ(suble_get_timestamp_with_ms(&ms), timestamp);
+            TEST_CHECK_EQ(ms, (slots % SLOTS_PER_SECOND)*5/8);
+            TEST_CHECK(ms < 1000);
+            //never goes back
+            TEST_CHECK((uint64_t)timestamp*1000 + ms >= last);
+            last = (uint64_t)timestamp*1000 + ms;
+        } else {
+            //the seconds not counted yet are part of the old timestamp as well
+            if(old_expect != 0) {
+                TEST_CHECK_EQ(suble_get_old_timestamp(old_local), old_expect);
+            }
+            if(step % 1000 == 0) {
+                old_local = suble_get_local_timestamp();
+                old_expect = timestamp;
+                TEST_CHECK_EQ(old_local, seconds);
+            }
+        }
+    }
+    TEST_CHECK_EQ(suble_get_timestamp(), app_timestamp + (uint32_t)((s_now - s_rtc_start)/SLOTS_PER_SECOND) - local_when_update);
+}
+
+int main(void)
+{
+    //the slot clock wraps 90s into the test and every 23.3h after
+    s_slot_base = SLOT_CLOCK_MASK + 1 - 90*SLOTS_PER_SECOND;
+
+    test_wheel_levels();
+    test_wheel_random();
+    //leaves the rtc and the watchdog wake up running
+    test_wdt_wake();
+    test_rtc();
+    return TEST_RESULT();
+}
@@ -0,0 +1,237 @@
+#include "test_common.h"
+#include "tuya_ble_port.h"
+#include "tuya_ble_mem.h"
+#include "tuya_ble_api.h"
+#include "tuya_ble_app_uart_common_handler.h"
+
+#define UART_TX_QUEUE_SIZE      511 //UART0_TX_FIFO_MAX_COUNT - 1
+#define FRAME_NUM_MAX           20000
+#define WIRE_SIZE               (FRAME_NUM_MAX * 64)
+#define EVENT_QUEUE_SIZE        4
+
+/*********************************************************
+ * the uart driver, a queue drained onto the wire by the tx interrupt
+ */
+static uint8_t  s_queue[UART_TX_QUEUE_SIZE];
+static uint32_t s_queue_len = 0;
+static uint8_t  s_wire[WIRE_SIZE];
+static uint32_t s_wire_len = 0;
+static uint32_t s_busy = 0;
+
+//uart_send_async through suble_uart1_send, the whole buffer or nothing
+tuya_ble_status_t tuya_ble_common_uart_send_data(const uint8_t *p_data,uint16_t len)
+{
+    if(s_queue_len + len > UART_TX_QUEUE_SIZE) {
+        s_busy++;
+        return TUYA_BLE_ERR_BUSY;
+    }
+    memcpy(&s_queue[s_queue_len], p_data, len);
+    s_queue_len += len;
+    return TUYA_BLE_SUCCESS;
+}
+
+//the isr, tx complete once the queue is drained
+static void uart_tx_isr(uint32_t bytes)
+{
+    if(s_queue_len == 0) {
+        return;
+    }
+    if(bytes > s_queue_len) {
+        bytes = s_queue_len;
+    }
+    TEST_CHECK(s_wire_len + bytes <= WIRE_SIZE);
+    memcpy(&s_wire[s_wire_len], s_queue, bytes);
+    s_wire_len += bytes;
+    memmove(s_queue, &s_queue[bytes], s_queue_len - bytes);
+    s_queue_len -= bytes;
+    if(s_queue_len == 0) {
+        tuya_ble_uart_common_tx_complete();
+    }
+}
+
+/*********************************************************
+ * the sdk event loop
+ */
+static tuya_ble_custom_evt_t s_event[EVENT_QUEUE_SIZE];
+static uint32_t s_event_num = 0;
+static bool     s_event_lost = false;
+
+uint8_t tuya_ble_custom_event_send(tuya_ble_custom_evt_t evt)
+{
+    if(s_event_lost || (s_event_num >= EVENT_QUEUE_SIZE)) {
+        return 1;
+    }
+    s_event[s_event_num++] = evt;
+    return 0;
+}
+
+static void event_run(void)
+{
+    while(s_event_num > 0) {
+        tuya_ble_custom_evt_t evt = s_event[0];
+        s_event_num--;
+        memmove(s_event, &s_event[1], s_event_num * sizeof(tuya_ble_custom_evt_t));
+        evt.custom_event_handler(evt.evt_id, evt.data);
+    }
+}
+
+/*********************************************************
+ * the rest of the sdk
+ */
+void *tuya_ble_malloc(uint16_t size) { return malloc(size); }
+tuya_ble_status_t tuya_ble_free(uint8_t *ptr) { free(ptr); return TUYA_BLE_SUCCESS; }
+void tuya_ble_custom_app_uart_common_process(uint8_t *p_in_data,uint16_t in_len) {}
+tuya_ble_connect_status_t tuya_ble_connect_status_get(void) { return BONDING_CONN; }
+uint8_t tuya_ble_commData_send(uint16_t cmd,uint32_t ack_sn,uint8_t *data,uint16_t len,uint8_t encryption_mode) { return 0; }
+
+uint8_t tuya_ble_check_sum(uint8_t *pbuf,uint16_t len)
+{
+    uint32_t sum = 0;
+    while(len--) {
+        sum += *pbuf++;
+    }
+    return (uint8_t)sum;
+}
+
+/*********************************************************
+ * frames, each one carries its number so a dropped one is found on the wire
+ */
+static uint16_t s_frame_len[FRAME_NUM_MAX];
+static uint32_t s_frame_num = 0;
+
+static void frame_build(uint32_t id, uint8_t* buf, uint16_t len)
+{
+    buf[0] = 0x55;
+    buf[1] = 0xAA;
+    memcpy(&buf[2], &id, sizeof(id));
+    for(uint32_t idx=6; idx<len; idx++) {
+        buf[idx] = (uint8_t)(id + idx);
+    }
+}
+
+static void frame_send(uint16_t len)
+{
+    uint8_t buf[300];
+    TEST_CHECK(s_frame_num < FRAME_NUM_MAX);
+    frame_build(s_frame_num, buf, len);
+    s_frame_len[s_frame_num++] = len;
+    tuya_ble_uart_common_send_data(buf, len);
+}
+
+//every frame on the wire is whole and in order, returns the dropped ones
+static uint32_t wire_check(void)
+{
+    uint8_t buf[300];
+    uint32_t pos = 0;
+    uint32_t dropped = 0;
+
+    for(uint32_t id=0; id<s_frame_num; id++) {
+        frame_build(id, buf, s_frame_len[id]);
+        if((pos + s_frame_len[id] <= s_wire_len) && (memcmp(&s_wire[pos], buf, s_frame_len[id]) == 0)) {
+            pos += s_frame_len[id];
+        } else {
+            dropped++;
+        }
+    }
+    TEST_CHECK_EQ(pos, s_wire_len);
+    return dropped;
+}
+
+static void model_drain(void)
+{
+    for(uint32_t idx=0; idx<100; idx++) {
+        uart_tx_isr(UART_TX_QUEUE_SIZE);
+        event_run();
+    }
+    TEST_CHECK_EQ(s_queue_len, 0);
+}
+
+static void model_reset(void)
+{
+    model_drain();
+    s_wire_len = 0;
+    s_frame_num = 0;
+    s_busy = 0;
+}
+
+/*********************************************************
+ * cases
+ */
+//bursts the queue can not take at once, the frames wait and none is lost
+static void test_burst(void)
+{
+    model_reset();
+    for(uint32_t tick=0; tick<40000; tick++) {
+        //a burst of up to 743 bytes every 100 ticks, 12 bytes a tick on the wire,
+        //what the queue does not take fits into the kept frames
+        if(tick % 100 == 0) {
+            uint32_t burst = 0;
+            while(burst < 680) {
+                uint16_t len = 7 + test_rand() % 58;
+                frame_send(len);
+                burst += len;
+            }
+        }
+        uart_tx_isr(12);
+        event_run();
+    }
+    model_drain();
+    TEST_CHECK(s_busy > 0);
+    TEST_CHECK_EQ(wire_check(), 0);
+}
+
+//more than the queue and the pending frames hold, whole frames are dropped and it recovers
+static void test_overflow(void)
+{
+    uint32_t dropped;
+
+    model_reset();
+    for(uint32_t idx=0; idx<20; idx++) {
+        frame_send(200);
+    }
+    for(uint32_t idx=0; idx<200; idx++) {
+        uart_tx_isr(16);
+        event_run();
+    }
+    dropped = wire_check();
+    TEST_CHECK(dropped > 0);
+    //the queue, one kept frame
+    TEST_CHECK_EQ(20 - dropped, 3);
+
+    for(uint32_t idx=0; idx<100; idx++) {
+        frame_send(7 + idx % 40);
+        uart_tx_isr(64);
+        event_run();
+    }
+    model_drain();
+    TEST_CHECK_EQ(wire_check(), dropped);
+}
+
+//a lost tx complete event, the next frame sends the kept ones first
+static void test_event_lost(void)
+{
+    model_reset();
+    frame_send(250);
+    frame_send(250);
+    frame_send(250);
+    TEST_CHECK(s_busy > 0);
+
+    s_event_lost = true;
+    uart_tx_isr(UART_TX_QUEUE_SIZE);
+    event_run();
+    s_event_lost = false;
+    TEST_CHECK_EQ(s_queue_len, 0);
+
+    frame_send(20);
+    TEST_CHECK_EQ(s_queue_len, 270);
+    model_drain();
+    TEST_CHECK_EQ(wire_check(), 0);
+}
+
+int main(void)
+{
+    test_burst();
+    test_overflow();
+    test_event_lost();
+    return TEST_RESULT();
+}
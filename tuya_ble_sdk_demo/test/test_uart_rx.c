@@ -0,0 +1,378 @@
+#include <time.h>
+#include "test_common.h"
+#include "tuya_ble_port.h"
+#include "tuya_ble_mem.h"
+#include "tuya_ble_main.h"
+#include "tuya_ble_api.h"
+#include "tuya_ble_event.h"
+#include "tuya_ble_mutli_tsf_protocol.h"
+
+#define STREAM_SIZE             (4*1024*1024)
+#define FRAME_NUM_MAX           40000
+
+/*********************************************************
+ * what the parser hands on, every frame goes through the event queue
+ */
+typedef struct {
+    uint8_t  buf[STREAM_SIZE];
+    uint32_t len;
+    uint16_t frame_len[FRAME_NUM_MAX];
+    uint32_t frame_num;
+} frames_t;
+
+static frames_t s_out;
+static frames_t s_ref;
+static int32_t  s_heap_blocks = 0;
+
+static void frames_add(frames_t* frames, const uint8_t* buf, uint16_t len)
+{
+    if((frames->frame_num >= FRAME_NUM_MAX) || (frames->len + len > sizeof(frames->buf))) {
+        TEST_CHECK(false);
+        return;
+    }
+    memcpy(&frames->buf[frames->len], buf, len);
+    frames->len += len;
+    frames->frame_len[frames->frame_num++] = len;
+}
+
+static void frames_check(void)
+{
+    TEST_CHECK_EQ(s_out.frame_num, s_ref.frame_num);
+    TEST_CHECK_EQ(s_out.len, s_ref.len);
+    TEST_CHECK(memcmp(s_out.frame_len, s_ref.frame_len, s_ref.frame_num * sizeof(uint16_t)) == 0);
+    TEST_CHECK(memcmp(s_out.buf, s_ref.buf, s_ref.len) == 0);
+}
+
+void *tuya_ble_malloc(uint16_t size)
+{
+    s_heap_blocks++;
+    return malloc(size);
+}
+
+tuya_ble_status_t tuya_ble_free(uint8_t *ptr)
+{
+    s_heap_blocks--;
+    free(ptr);
+    return TUYA_BLE_SUCCESS;
+}
+
+uint8_t tuya_ble_event_send(tuya_ble_evt_param_t *evt)
+{
+    TEST_CHECK_EQ(evt->hdr.event, TUYA_BLE_EVT_UART_CMD);
+    frames_add(&s_out, evt->uart_cmd_data.p_data, evt->uart_cmd_data.data_len);
+    tuya_ble_free(evt->uart_cmd_data.p_data);
+    return 0;
+}
+
+/*********************************************************
+ * the rest of the sdk, tuya_ble_api.c links against it
+ */
+tuya_ble_parameters_settings_t tuya_ble_current_para;
+tuya_ble_callback_t m_cb_table[TUYA_BLE_MAX_CALLBACKS];
+
+mtp_ret klv_data_check(uint8_t *data,uint32_t len,uint8_t type) { return 0; }
+void tuya_ble_adv_change(void) {}
+bool tuya_ble_buffer_value_is_all_x(uint8_t *buffer,uint16_t len,uint8_t value) { return false; }
+tuya_ble_status_t tuya_ble_common_uart_init(void) { return TUYA_BLE_SUCCESS; }
+tuya_ble_connect_status_t tuya_ble_connect_status_get(void) { return BONDING_CONN; }
+void tuya_ble_connect_status_set(tuya_ble_connect_status_t status) {}
+void tuya_ble_device_enter_critical(void) {}
+void tuya_ble_device_exit_critical(void) {}
+void tuya_ble_device_id_16_to_20(uint8_t *in,uint8_t *out) {}
+void tuya_ble_device_id_20_to_16(uint8_t *in,uint8_t *out) {}
+void tuya_ble_event_init(void) {}
+tuya_ble_status_t tuya_ble_gap_disconnect(void) { return TUYA_BLE_SUCCESS; }
+void tuya_ble_gatt_send_queue_init(void) {}
+uint16_t tuya_ble_sched_queue_events_get(void) { return 0; }
+uint16_t tuya_ble_sched_queue_size_get(void) { return 0; }
+uint16_t tuya_ble_sched_queue_space_get(void) { return 0; }
+void tuya_ble_set_device_version(uint32_t firmware_version,uint32_t hardware_version) {}
+void tuya_ble_set_external_mcu_version(uint32_t firmware_version,uint32_t hardware_version) {}
+uint32_t tuya_ble_storage_init(void) { return 0; }
+uint32_t tuya_ble_storage_save_auth_settings(void) { return 0; }
+uint32_t tuya_ble_storage_save_sys_settings(void) { return 0; }
+tuya_ble_status_t tuya_ble_timer_create(void** p_timer_id,uint32_t timeout_value_ms, tuya_ble_timer_mode mode,tuya_ble_timer_handler_t timeout_handler) { return TUYA_BLE_SUCCESS; }
+tuya_ble_status_t tuya_ble_timer_start(void* timer_id) { return TUYA_BLE_SUCCESS; }
+tuya_ble_status_t tuya_ble_timer_stop(void* timer_id) { return TUYA_BLE_SUCCESS; }
+
+/*********************************************************
+ * the byte parser tuya_ble_api.c had before the span one, the reference
+ */
+static uint8_t  s_ref_buffer[300];
+static uint8_t  s_ref_temp[3];
+static uint32_t s_ref_state = 0;   //null, head, cmd, len_h, len_l, data
+static uint16_t s_ref_data_len = 0;
+static uint16_t s_ref_count = 0;
+
+static void ref_reset(void)
+{
+    memset(s_ref_temp, 0, 3);
+    s_ref_count = 0;
+    s_ref_state = 0;
+    s_ref_data_len = 0;
+}
+
+static bool ref_unpack(uint8_t data)
+{
+    s_ref_temp[0] = s_ref_temp[1];
+    s_ref_temp[1] = s_ref_temp[2];
+    s_ref_temp[2] = data;
+
+    if(((s_ref_temp[0]==0x55)||(s_ref_temp[0]==0x66))&&(s_ref_temp[1]==0xAA)&&((s_ref_temp[2]==0x00)||(s_ref_temp[2]==0x01))) {
+        memcpy(s_ref_buffer, s_ref_temp, 3);
+        memset(s_ref_temp, 0, 3);
+        s_ref_count = 3;
+        s_ref_state = 1;
+        s_ref_data_len = 0;
+        return false;
+    }
+
+    switch(s_ref_state) {
+        case 1:
+        case 2: {
+            s_ref_buffer[s_ref_count++] = data;
+            s_ref_state++;
+        } break;
+        case 3: {
+            s_ref_buffer[s_ref_count++] = data;
+            s_ref_data_len = (s_ref_buffer[s_ref_count-2]<<8) | s_ref_buffer[s_ref_count-1];
+            if(s_ref_data_len > 249) {
+                ref_reset();
+            } else {
+                s_ref_state = (s_ref_data_len > 0) ? 4 : 5;
+            }
+        } break;
+        case 4: {
+            s_ref_buffer[s_ref_count++] = data;
+            if(--s_ref_data_len == 0) {
+                s_ref_state = 5;
+            }
+        } break;
+        case 5: {
+            s_ref_buffer[s_ref_count++] = data;
+            return true;
+        }
+        default: {
+        } break;
+    }
+    return false;
+}
+
+static void ref_receive(const uint8_t* buf, uint32_t len)
+{
+    for(uint32_t idx=0; idx<len; idx++) {
+        if(ref_unpack(buf[idx])) {
+            frames_add(&s_ref, s_ref_buffer, s_ref_count);
+            ref_reset();
+        }
+    }
+}
+
+/*********************************************************
+ * streams of frames mixed with junk
+ */
+static uint8_t  s_stream[STREAM_SIZE];
+static uint32_t s_stream_len = 0;
+
+static void stream_put(const uint8_t* buf, uint32_t len)
+{
+    if(s_stream_len + len > STREAM_SIZE) {
+        TEST_CHECK(false);
+        return;
+    }
+    memcpy(&s_stream[s_stream_len], buf, len);
+    s_stream_len += len;
+}
+
+static void stream_frame(uint8_t head, uint8_t version, uint8_t cmd, const uint8_t* data, uint16_t len, bool bad_sum)
+{
+    uint8_t buf[6 + 300 + 1];
+    uint8_t sum = 0;
+
+    buf[0] = head;
+    buf[1] = 0xAA;
+    buf[2] = version;
+    buf[3] = cmd;
+    buf[4] = len >> 8;
+    buf[5] = len & 0xFF;
+    memcpy(&buf[6], data, len);
+    for(uint32_t idx=0; idx<6u+len; idx++) {
+        sum += buf[idx];
+    }
+    buf[6+len] = bad_sum ? (uint8_t)(sum + 1) : sum;
+    stream_put(buf, 7 + len);
+}
+
+//random frames, junk with broken headers between them, headers inside the data
+static void stream_random(uint32_t frame_num)
+{
+    static const struct {
+        uint8_t len;
+        uint8_t buf[3];
+    } junk[] = {
+        {3, {0x55, 0xAA, 0x02}}, {3, {0x55, 0x55, 0xAA}}, {2, {0x66, 0xAA}}, {2, {0xAA, 0x00}}, {1, {0x55}},
+    };
+    uint8_t data[300];
+
+    s_stream_len = 0;
+    for(uint32_t idx=0; idx<frame_num; idx++) {
+        uint32_t junk_len = (test_rand() % 4 == 0) ? test_rand() % 8 : 0;
+        for(uint32_t pos=0; pos<junk_len; pos++) {
+            uint8_t byte = test_rand();
+            stream_put(&byte, 1);
+        }
+        if(test_rand() % 8 == 0) {
+            uint32_t pick = test_rand() % 5;
+            stream_put(junk[pick].buf, junk[pick].len);
+        }
+
+        uint16_t len = (test_rand() % 4 == 0) ? test_rand() % 250 : test_rand() % 24;
+        for(uint32_t pos=0; pos<len; pos++) {
+            data[pos] = test_rand();
+        }
+        if((len >= 3) && (test_rand() % 16 == 0)) {
+            uint32_t pos = test_rand() % (len - 2);
+            data[pos] = (test_rand() % 2) ? 0x55 : 0x66;
+            data[pos+1] = 0xAA;
+            data[pos+2] = test_rand() % 2;
+        }
+        if((test_rand() % 32 == 0) && (idx + 1 < frame_num)) {
+            //too long, the header is dropped and the hunt goes on in the data
+            stream_frame(0x55, 0x00, 0x01, data, 250 + test_rand() % 8, false);
+            continue;
+        }
+        stream_frame((test_rand() % 4) ? 0x55 : 0x66, test_rand() % 2, test_rand(), data, len, test_rand() % 16 == 0);
+    }
+}
+
+/*********************************************************
+ * replay, chunk 0 picks a random size for every span
+ */
+static void replay(uint32_t chunk)
+{
+    uint32_t pos = 0;
+
+    while(pos < s_stream_len) {
+        uint32_t len = chunk ? chunk : 1 + test_rand() % 255;
+        if(len > s_stream_len - pos) {
+            len = s_stream_len - pos;
+        }
+        tuya_ble_common_uart_receive_data(&s_stream[pos], len);
+        pos += len;
+    }
+}
+
+//both parsers keep their state from the previous replay
+static void replay_check(uint32_t chunk)
+{
+    memset(&s_ref, 0, sizeof(s_ref));
+    ref_receive(s_stream, s_stream_len);
+
+    memset(&s_out, 0, sizeof(s_out));
+    replay(chunk);
+    frames_check();
+    TEST_CHECK_EQ(s_heap_blocks, 0);
+}
+
+/*********************************************************
+ * cases
+ */
+//a frame split anywhere, behind junk that ends in a broken header
+static void test_split(void)
+{
+    static const uint8_t junk[] = {0x12, 0x55, 0xAA, 0x02, 0x66, 0xAA};
+    uint8_t data[40];
+
+    for(uint32_t idx=0; idx<sizeof(data); idx++) {
+        data[idx] = idx * 7;
+    }
+    s_stream_len = 0;
+    stream_put(junk, sizeof(junk));
+    stream_frame(0x55, 0x00, 0x06, data, sizeof(data), false);
+
+    for(uint32_t cut=1; cut<s_stream_len; cut++) {
+        memset(&s_out, 0, sizeof(s_out));
+        tuya_ble_common_uart_receive_data(s_stream, cut);
+        tuya_ble_common_uart_receive_data(&s_stream[cut], s_stream_len - cut);
+        TEST_CHECK_EQ(s_out.frame_num, 1);
+        TEST_CHECK_EQ(s_out.len, 7 + sizeof(data));
+        TEST_CHECK(memcmp(s_out.buf, &s_stream[sizeof(junk)], s_out.len) == 0);
+    }
+}
+
+//a header inside the data restarts the frame, a bad sum is left to the event handler
+static void test_resync(void)
+{
+    uint8_t data[20] = {0};
+    uint8_t inner[] = {0x55, 0xAA, 0x00, 0x08, 0x00, 0x00};
+
+    memcpy(&data[10], inner, sizeof(inner));
+    for(uint32_t chunk=1; chunk<=32; chunk++) {
+        s_stream_len = 0;
+        stream_frame(0x55, 0x00, 0x07, data, sizeof(data), false);
+        stream_frame(0x66, 0x00, 0xF1, data, 4, true);
+        memset(&s_out, 0, sizeof(s_out));
+        replay(chunk);
+
+        //the inner frame ends on the first byte behind it, the outer one is gone
+        TEST_CHECK_EQ(s_out.frame_num, 2);
+        TEST_CHECK_EQ(s_out.frame_len[0], 7);
+        TEST_CHECK(memcmp(s_out.buf, inner, sizeof(inner)) == 0);
+        TEST_CHECK_EQ(s_out.frame_len[1], 7 + 4);
+        TEST_CHECK_EQ(s_out.buf[7 + 3], 0xF1);
+    }
+
+    //a header in the cmd and length bytes of another one
+    s_stream_len = 0;
+    stream_put(inner, 3);
+    stream_frame(0x55, 0x01, 0x02, data, 2, false);
+    memset(&s_out, 0, sizeof(s_out));
+    replay(1);
+    TEST_CHECK_EQ(s_out.frame_num, 1);
+    TEST_CHECK_EQ(s_out.frame_len[0], 7 + 2);
+    TEST_CHECK_EQ(s_out.buf[2], 0x01);
+}
+
+//the span parser gives what the byte parser gave, at every chunking
+static void test_replay(void)
+{
+    static const uint32_t chunks[] = {1, 2, 7, 16, 64, 255, 0};
+
+    stream_random(20000);
+    ref_reset();
+    for(uint32_t idx=0; idx<sizeof(chunks)/sizeof(chunks[0]); idx++) {
+        replay_check(chunks[idx]);
+    }
+    TEST_CHECK(s_ref.frame_num > 15000);
+}
+
+//throughput for the record, not checked
+static void test_speed(void)
+{
+    static const uint32_t chunks[] = {1, 16, 64, 255};
+
+    stream_random(20000);
+    for(uint32_t idx=0; idx<sizeof(chunks)/sizeof(chunks[0]); idx++) {
+        uint32_t frames = 0;
+        clock_t start = clock();
+        for(uint32_t round=0; round<5; round++) {
+            memset(&s_out, 0, sizeof(s_out));
+            replay(chunks[idx]);
+            frames += s_out.frame_num;
+        }
+        double sec = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if(sec <= 0) {
+            sec = 1e-6;
+        }
+        printf("chunk %3u: %7.1f MB/s, %9.0f frames/s\n", chunks[idx], 5.0 * s_stream_len / sec / 1e6, frames / sec);
+    }
+}
+
+int main(void)
+{
+    test_split();
+    test_resync();
+    test_replay();
+    test_speed();
+    return TEST_RESULT();
+}
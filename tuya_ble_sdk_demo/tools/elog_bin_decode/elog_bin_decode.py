@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""
+Decode the binary tokenized log of easylogger (ELOG_BIN_OUTPUT_ENABLE).
+
+The device sends the flash address of every format string instead of the
+text, this script looks the strings up in the .axf image that was flashed.
+
+usage: elog_bin_decode.py <bk3435_ble_app.axf> [capture.bin]
+       the capture defaults to stdin, e.g. a raw dump of the log UART.
+Bytes outside of frames (assert output, drop notices) are passed through.
+"""
+
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+TYPE_PRINTF = 0x01
+TYPE_HEXDUMP = 0x02
+# bit 7 of a string length, the device cut the string
+STR_CUT = 0x80
+
+SPEC_RE = re.compile(r"%([-+ #0]*)(\d+|\*)?(\.(\d+|\*))?(hh|h|ll|l|z|j|t)?([diouxXcspfFeEgG%])")
+
+
+class Image(object):
+    """loadable sections of an ELF32 little endian image"""
+
+    def __init__(self, path):
+        data = open(path, "rb").read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("not an ELF32 little endian image")
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x2E)
+        self.sections = []
+        for idx in range(shnum):
+            sh = struct.unpack_from("<IIIIIIIIII", data, shoff + idx * shentsize)
+            sh_type, sh_flags, sh_addr, sh_offset, sh_size = sh[1], sh[2], sh[3], sh[4], sh[5]
+            # SHT_PROGBITS and SHF_ALLOC
+            if sh_type == 1 and (sh_flags & 0x2) and sh_size:
+                self.sections.append((sh_addr, data[sh_offset:sh_offset + sh_size]))
+
+    def string(self, addr):
+        for base, body in self.sections:
+            if base <= addr < base + len(body):
+                end = body.find(b"\x00", addr - base)
+                return body[addr - base:end].decode("latin-1")
+        return "<fmt@0x%08X>" % addr
+
+
+def format_printf(fmt, args):
+    out = []
+    pos = 0
+    for m in SPEC_RE.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, _, prec, length, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        # a full frame drops the arguments at its end
+        need = (width == "*") * 4 + (prec == "*") * 4 + \
+            (1 if conv == "s" else 8 if conv in "fFeEgG" or length == "ll" else 4)
+        if len(args) < need or (conv == "s" and len(args) < 1 + (args[0] & ~STR_CUT)):
+            out.append("<cut>")
+            pos = len(fmt)
+            break
+        if width == "*":
+            width = str(struct.unpack("<i", args[:4])[0])
+            args = args[4:]
+        if prec == "*":
+            prec = str(struct.unpack("<i", args[:4])[0])
+            args = args[4:]
+        spec = "%" + (flags or "") + (width or "") + ("." + prec if prec is not None else "")
+        if conv == "s":
+            size = args[0] & ~STR_CUT
+            text = args[1:1 + size].decode("latin-1")
+            if args[0] & STR_CUT:
+                text += "..."
+            out.append((spec + "s") % text)
+            args = args[1 + size:]
+        elif conv in "fFeEgG":
+            out.append((spec + conv) % struct.unpack("<d", args[:8])[0])
+            args = args[8:]
+        elif length == "ll":
+            signed, unsigned = struct.unpack("<q", args[:8])[0], struct.unpack("<Q", args[:8])[0]
+            args = args[8:]
+            if conv in "di":
+                out.append((spec + "d") % signed)
+            elif conv == "u":
+                out.append((spec + "d") % unsigned)
+            else:
+                out.append((spec + conv) % unsigned)
+        else:
+            signed, unsigned = struct.unpack("<i", args[:4])[0], struct.unpack("<I", args[:4])[0]
+            args = args[4:]
+            if conv in "di":
+                out.append((spec + "d") % signed)
+            elif conv == "c":
+                out.append((spec + "c") % chr(unsigned & 0xFF))
+            elif conv == "p":
+                out.append("0x%08x" % unsigned)
+            elif conv == "u":
+                out.append((spec + "d") % unsigned)
+            else:
+                out.append((spec + conv) % unsigned)
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def format_hexdump(name, data, width=8):
+    lines = ["D/HEX %s: len=%d" % (name, len(data))]
+    for idx in range(0, len(data), width):
+        chunk = data[idx:idx + width]
+        lines.append("D/HEX %s: %04X-%04X: %s" % (name, idx, idx + len(chunk) - 1,
+                                                  " ".join("%02X" % b for b in chunk)))
+    return "\n".join(lines)
+
+
+def decode(image, stream):
+    """yield text lines from a raw capture"""
+    text = bytearray()
+    idx = 0
+    while idx < len(stream):
+        byte = stream[idx]
+        if byte == SYNC and idx + 3 <= len(stream):
+            ftype, flen = stream[idx + 1], stream[idx + 2]
+            end = idx + 3 + flen
+            if ftype in (TYPE_PRINTF, TYPE_HEXDUMP) and flen >= 5 and end < len(stream) \
+                    and (sum(stream[idx + 1:end]) & 0xFF) == stream[end]:
+                if text:
+                    yield text.decode("latin-1")
+                    text = bytearray()
+                payload = bytes(stream[idx + 3:end])
+                addr, = struct.unpack_from("<I", payload, 1)
+                if ftype == TYPE_PRINTF:
+                    yield format_printf(image.string(addr), payload[5:])
+                else:
+                    yield format_hexdump(image.string(addr), payload[5:])
+                idx = end + 1
+                continue
+        text.append(byte)
+        idx += 1
+    if text:
+        yield text.decode("latin-1")
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write(__doc__)
+        return 1
+    image = Image(argv[1])
+    stream = open(argv[2], "rb").read() if len(argv) > 2 else sys.stdin.buffer.read()
+    for line in decode(image, stream):
+        sys.stdout.write(line if line.endswith("\n") else line + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))